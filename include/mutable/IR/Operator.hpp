@@ -4,6 +4,7 @@
 #include <mutable/catalog/Schema.hpp>
 #include <mutable/IR/CNF.hpp>
 #include <mutable/IR/QueryGraph.hpp>
+#include <mutable/IR/ResultBatch.hpp>
 #include <mutable/storage/Store.hpp>
 #include <mutable/util/enum_ops.hpp>
 #include <mutable/util/macro.hpp>
@@ -187,14 +188,32 @@ struct M_EXPORT Consumer : virtual Operator
 struct M_EXPORT CallbackOperator : Consumer
 {
     using callback_type = std::function<void(const Schema &, const Tuple&)>;
+    ///> the type of callbacks consuming the produced tuples in batches, see `ResultBatch`
+    using batch_callback_type = std::function<void(const Schema &, const ResultBatch&)>;
 
     private:
     callback_type callback_;
+    batch_callback_type batch_callback_;
+    std::size_t batch_size_ = 0;
 
     public:
     CallbackOperator(callback_type callback) : callback_(callback) { }
+    /** Creates a `CallbackOperator` that passes the produced tuples to \p batch_callback in columnar `ResultBatch`es of
+     * exactly \p batch_size tuples, except for the last batch which may be smaller.  The batches omit constants and
+     * duplicate entries of the operator's schema; \p batch_callback receives the schema of the batch. */
+    CallbackOperator(batch_callback_type batch_callback, std::size_t batch_size)
+        : batch_callback_(batch_callback)
+        , batch_size_(batch_size)
+    {
+        M_insist(batch_size != 0, "batch size must not be zero");
+    }
 
     const auto & callback() const { return callback_; }
+    const auto & batch_callback() const { return batch_callback_; }
+    /** Returns `true` iff this operator passes the produced tuples in batches to `batch_callback()`. */
+    bool is_batched() const { return bool(batch_callback_); }
+    /** Returns the number of tuples per batch; must only be called if `is_batched()`. */
+    std::size_t batch_size() const { M_insist(is_batched()); return batch_size_; }
 
     void accept(OperatorVisitor &v) override;
     void accept(ConstOperatorVisitor &v) const override;
@@ -277,15 +296,60 @@ struct M_EXPORT DisjunctiveFilterOperator : FilterOperator
     void accept(ConstOperatorVisitor &v) const override;
 };
 
+/** Joins its children by its predicate.  An *inner* join produces the combination of each pair of matching tuples.  A
+ * *semi-join* or *anti-join* instead filters the tuples of its second child, the *probe* side, by whether a matching
+ * tuple of its first child, the *build* side, exists.  It produces each tuple of the probe side at most once and only
+ * the attributes of the probe side. */
 struct M_EXPORT JoinOperator : Producer, Consumer
 {
+    enum kind_t
+    {
+        J_Inner,            ///< inner join
+        J_Semi,             ///< produces the probe tuples *with* a match
+        J_Anti,             ///< produces the probe tuples *without* a match
+        J_NullAwareAnti,    ///< like `J_Anti`, but a predicate `x IN y` evaluating to `NULL` counts as a match
+    };
+
     private:
     cnf::CNF predicate_;
+    kind_t kind_;
 
     public:
-    JoinOperator(cnf::CNF predicate) : predicate_(std::move(predicate)) { }
+    JoinOperator(cnf::CNF predicate, kind_t kind = J_Inner) : predicate_(std::move(predicate)), kind_(kind) { }
 
     const cnf::CNF & predicate() const { return predicate_; }
+    kind_t kind() const { return kind_; }
+    /** Returns `true` iff this is a semi-join or an anti-join, i.e.\ produces only the tuples of the probe side. */
+    bool is_semi_or_anti() const { return kind_ != J_Inner; }
+    /** Returns `true` iff this is an anti-join, i.e.\ produces only the tuples of the probe side *without* a match. */
+    bool is_anti() const { return kind_ == J_Anti or kind_ == J_NullAwareAnti; }
+
+    /*----- Override child setters s.t. semi-joins and anti-joins have the schema of their probe side. ---------------*/
+    virtual void add_child(Producer *child) override {
+        if (not is_semi_or_anti())
+            return Consumer::add_child(child);
+        if (not child)
+            throw invalid_argument("no child given");
+        M_insist(children().size() < 2, "semi-joins and anti-joins have exactly two children");
+        children().push_back(child);
+        child->parent(this);
+        if (children().size() == 2)
+            schema() = child->schema();
+    }
+    virtual Producer * set_child(Producer *child, std::size_t i) override {
+        if (not is_semi_or_anti())
+            return Consumer::set_child(child, i);
+        if (not child)
+            throw invalid_argument("no child given");
+        if (i >= children().size())
+            throw out_of_range("index i out of bounds");
+        auto old = children()[i];
+        children()[i] = child;
+        child->parent(this);
+        if (i == 1)
+            schema() = child->schema();
+        return old;
+    }
 
     void accept(OperatorVisitor &v) override;
     void accept(ConstOperatorVisitor &v) const override;
@@ -25,6 +25,7 @@ struct Stmt;
 struct DataSource;
 struct Join;
 struct QueryGraph;
+struct SemiJoin;
 
 /** A `DataSource` in a `QueryGraph`.  Represents something that can be evaluated to a sequence of tuples, optionally
  * filtered by a filter condition.  A `DataSource` can be joined with one or more other `DataSource`s by a `Join`. */
@@ -163,6 +164,44 @@ struct M_EXPORT Join
     bool operator!=(const Join &other) const { return not operator==(other); }
 };
 
+/** A `SemiJoin` in a `QueryGraph` filters the result of the graph's joins by membership in the result of a nested
+ * query, as expressed by `EXISTS` and `IN`.  A *semi-join* retains a tuple iff the nested query produces at least one
+ * tuple satisfying the condition together with it; an *anti-join* retains a tuple iff the nested query produces no such
+ * tuple.  Either way, each tuple is retained at most once and no attributes of the nested query are added to it.
+ *
+ * The condition consists of the correlated clauses of the nested query and, for `IN`, of the predicate `x IN Q` itself,
+ * which compares `x` with the value `$res` of each tuple of the nested query `Q`. */
+struct M_EXPORT SemiJoin
+{
+    enum kind_t
+    {
+        SJ_Semi,            ///< `EXISTS` or `IN`
+        SJ_Anti,            ///< `NOT EXISTS`
+        SJ_NullAwareAnti,   ///< `NOT IN`; a tuple for which the `IN` predicate evaluates to `NULL` counts as a match
+    };
+
+    private:
+    kind_t kind_; ///< the kind of this semi-join
+    const char *alias_; ///< the alias of the nested query
+    std::unique_ptr<QueryGraph> query_graph_; ///< query graph of the nested query
+    cnf::CNF condition_; ///< the condition a tuple of the nested query must satisfy to match
+
+    public:
+    SemiJoin(kind_t kind, const char *alias, std::unique_ptr<QueryGraph> query_graph, cnf::CNF condition);
+    ~SemiJoin();
+
+    /** Returns the kind of this `SemiJoin`. */
+    kind_t kind() const { return kind_; }
+    /** Returns `true` iff this `SemiJoin` is an anti-join. */
+    bool is_anti() const { return kind_ != SJ_Semi; }
+    /** Returns the alias of the nested query. */
+    const char * alias() const { return alias_; }
+    /** Returns a reference to the `QueryGraph` of the nested query. */
+    QueryGraph & query_graph() const { return *query_graph_; }
+    /** Returns the condition. */
+    const cnf::CNF & condition() const { return condition_; }
+};
+
 /** The query graph represents all data sources and joins in a graph structure.  It is used as an intermediate
  * representation of a query. */
 struct M_EXPORT QueryGraph
@@ -179,6 +218,8 @@ struct M_EXPORT QueryGraph
     private:
     std::vector<std::unique_ptr<DataSource>> sources_; ///< collection of all data sources in this query graph
     std::vector<std::unique_ptr<Join>> joins_; ///< collection of all joins in this query graph
+    ///> collection of all semi-joins and anti-joins applied to the joined data sources
+    std::vector<std::unique_ptr<SemiJoin>> semi_joins_;
 
     std::vector<group_type> group_by_; ///< the grouping keys
     std::vector<std::reference_wrapper<const ast::FnApplicationExpr>> aggregates_; ///< the aggregates to compute
@@ -193,6 +234,7 @@ struct M_EXPORT QueryGraph
         using std::swap;
         swap(first.sources_,        second.sources_);
         swap(first.joins_,          second.joins_);
+        swap(first.semi_joins_,     second.semi_joins_);
         swap(first.group_by_,       second.group_by_);
         swap(first.projections_,    second.projections_);
         swap(first.order_by_,       second.order_by_);
@@ -245,6 +287,7 @@ struct M_EXPORT QueryGraph
 
     const auto & sources() const { return sources_; }
     const auto & joins() const { return joins_; }
+    const auto & semi_joins() const { return semi_joins_; }
     const auto & group_by() const { return group_by_; }
     const auto & aggregates() const { return aggregates_; }
     const std::vector<projection_type> & projections() const { return projections_; }
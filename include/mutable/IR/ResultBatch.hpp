@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <mutable/mutable-config.hpp>
+#include <mutable/util/macro.hpp>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+
+namespace m {
+
+/*----- forward declarations -----------------------------------------------------------------------------------------*/
+struct Schema;
+struct Type;
+namespace storage { struct DataLayout; }
+
+/** A batch of result tuples in columnar form.  The columns point directly into the memory of the result set, e.g.\ into
+ * the linear memory of a Wasm module, hence the values are neither copied nor boxed into `Value`s.  The memory is only
+ * valid while the batch is passed to a callback.  Column `i` holds the values of the `i`-th entry of the schema passed
+ * along with the batch. */
+struct M_EXPORT ResultBatch
+{
+    /** A column of the batch, i.e.\ the values of a single attribute of all tuples of the batch. */
+    struct column_t
+    {
+        const Type *type; ///< the type of the values
+        const uint8_t *data; ///< the address of the byte containing the value of the first tuple
+        uint8_t bit_offset; ///< the offset in bits of the value of the first tuple within the byte at `data`
+        uint64_t stride_in_bits; ///< the distance in bits between the values of consecutive tuples
+    };
+
+    private:
+    std::size_t num_tuples_; ///< the number of tuples in this batch
+    std::vector<column_t> columns_; ///< the columns of this batch
+    ///> the NULL bitmaps of the tuples, holding the NULL bit of the value of column `i` at bit `i`
+    column_t null_bitmap_;
+
+    public:
+    ResultBatch(std::size_t num_tuples, std::vector<column_t> columns, column_t null_bitmap)
+        : num_tuples_(num_tuples)
+        , columns_(std::move(columns))
+        , null_bitmap_(null_bitmap)
+    { }
+
+    /** Returns a batch of the first \p num_tuples tuples of schema \p schema laid out by \p layout at \p address.  The
+     * tuples must be contained in a single block of \p layout, s.t. the address of each value is linear in the ID of
+     * its tuple, e.g.\ a PAX block of at least \p num_tuples tuples. */
+    static ResultBatch Make(const storage::DataLayout &layout, const Schema &schema, const void *address,
+                            std::size_t num_tuples);
+
+    /** Returns a batch of the \p num_tuples tuples of this batch starting at the tuple with index \p first.  The
+     * returned batch points into the same memory as this batch. */
+    ResultBatch slice(std::size_t first, std::size_t num_tuples) const;
+
+    /** Returns the number of tuples in this batch. */
+    std::size_t num_tuples() const { return num_tuples_; }
+    /** Returns the number of columns of this batch. */
+    std::size_t num_columns() const { return columns_.size(); }
+    /** Returns the column with index \p col. */
+    const column_t & column(std::size_t col) const { M_insist(col < num_columns()); return columns_[col]; }
+
+    /** Returns `true` iff the value of column \p col of the tuple with index \p row is NULL. */
+    bool is_null(std::size_t col, std::size_t row) const {
+        M_insist(col < num_columns() and row < num_tuples());
+        return get_bit(null_bitmap_, row, col);
+    }
+
+    /** Returns the values of column \p col as a contiguous span of `T`s.  The values must be stored consecutively as
+     * `T`s, e.g.\ `int32_t` for an `INT(4)` column of a PAX block.  The values of NULL entries are unspecified. */
+    template<typename T>
+    requires std::is_arithmetic_v<T>
+    std::span<const T> values(std::size_t col) const {
+        auto &c = column(col);
+        M_insist(c.stride_in_bits == 8 * sizeof(T) and c.bit_offset == 0, "values must be stored consecutively");
+        return { reinterpret_cast<const T*>(c.data), num_tuples_ };
+    }
+
+    /** Returns the value of the boolean column \p col of the tuple with index \p row. */
+    bool as_bool(std::size_t col, std::size_t row) const {
+        M_insist(row < num_tuples());
+        return get_bit(column(col), row, 0);
+    }
+
+    /** Returns the address of the string of the character sequence column \p col of the tuple with index \p row.  As
+     * in the result set, a `CHAR(N)` string of length N is not NUL-terminated. */
+    const char * as_string(std::size_t col, std::size_t row) const {
+        auto &c = column(col);
+        M_insist(row < num_tuples() and c.bit_offset == 0 and c.stride_in_bits % 8 == 0);
+        return reinterpret_cast<const char*>(c.data + row * (c.stride_in_bits / 8));
+    }
+
+    private:
+    /** Returns the bit \p bit of the value of column \p c of the tuple with index \p row. */
+    static bool get_bit(const column_t &c, std::size_t row, std::size_t bit) {
+        const uint64_t offset = c.bit_offset + row * c.stride_in_bits + bit;
+        return (c.data[offset / 8] >> (offset % 8)) & 0x1;
+    }
+};
+
+}
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <map>
 #include <memory>
 #include <mutable/backend/Backend.hpp>
 #include <mutable/IR/Operator.hpp>
@@ -7,6 +10,7 @@
 #include <mutable/util/macro.hpp>
 #include <mutable/util/memory.hpp>
 #include <unordered_map>
+#include <vector>
 
 
 namespace m {
@@ -16,7 +20,9 @@ struct WasmEngine
 {
     /** the size of a WebAssembly memory page, 64 KiB. */
     static constexpr std::size_t WASM_PAGE_SIZE = 1UL << 16;
-    /** The maximum memory of a WebAssembly module:  2^32 - 2^16 bytes ≈ 4 GiB */
+    /** The maximum memory of a WebAssembly module:  2^32 - 2^16 bytes ≈ 4 GiB.  Since the generated code addresses
+     * linear memory by 32-bit pointers, i.e.\ memory64 is not supported, the tables accessed by a query together with
+     * its hash tables and buffers must fit into this limit. */
     static constexpr std::size_t WASM_MAX_MEMORY = (1UL << 32) - (1UL << 16);
     /** The alignment that is suitable for all built-in types. */
     static constexpr std::size_t WASM_ALIGNMENT = 8;
@@ -29,12 +35,50 @@ struct WasmEngine
             TRAP_GUARD_PAGES = 0b1, ///< map guard pages with PROT_NONE to trap any accesses
         };
 
+        using duration = std::chrono::high_resolution_clock::duration;
+
         private:
+        /** A table mapped into linear memory.  The mapping is retained when the context is reused by a later query. */
+        struct table_mapping_t
+        {
+            const Table *table; ///< the mapped table
+            const void *store_addr; ///< the address of the table's store memory at the time of mapping
+            std::size_t size; ///< the size in bytes of the mapping, aligned to whole pages, excluding the guard page
+            uint32_t offset; ///< the offset of the mapping in linear memory
+            duration setup_time; ///< the time spent to create the mapping
+        };
+
+        /** The zones of a table that may contain rows satisfying the filter of a scan, see `ZoneMap`. */
+        struct qualifying_zones_t
+        {
+            std::size_t zone_size; ///< the number of rows of a zone
+            std::vector<bool> qualifies; ///< whether each zone qualifies
+        };
+
         config_t config_;
+        ///> maps the ID of each scan pruned by a zone map to the qualifying zones of the scanned table
+        std::unordered_map<uint32_t, qualifying_zones_t> qualifying_zones_;
+        ///> maps the IDs of each scan and of each of its dictionary encoded attributes decided by codes to whether NULL
+        ///> and each code qualify, see `qualifying_codes()`
+        std::map<std::pair<uint32_t, uint32_t>, std::vector<uint8_t>> qualifying_codes_;
+        ///> the tables mapped into linear memory, in the order of their offsets
+        std::vector<table_mapping_t> table_mappings_;
+        ///> the number of entries of `table_mappings_` that are mapped for the current plan
+        std::size_t num_table_mappings_ = 0;
+        ///> the allocator of the memory backing the heap; owned by this context s.t. the heap can outlive a query
+        memory::LinearAllocator heap_allocator_;
+        ///> the memory backing the heap
+        memory::Memory heap_memory_;
+        ///> the offset in linear memory where `heap_memory_` is mapped to, or 0 if it is not mapped
+        uint32_t heap_memory_offset_ = 0;
+        ///> the time spent to map `heap_memory_`
+        duration heap_setup_time_ = duration::zero();
+        ///> the time saved for the current plan by reusing mappings of previous plans
+        duration saved_setup_time_ = duration::zero();
 
         public:
         unsigned id; ///< a unique ID
-        const Operator &plan; ///< current plan
+        const Operator *plan; ///< current plan
         ///> factory used to create the result set data layout
         std::unique_ptr<const storage::DataLayoutFactory> result_set_factory;
         memory::AddressSpace vm; ///<  WebAssembly module instance's virtual address space aka.\ *linear memory*
@@ -43,20 +87,79 @@ struct WasmEngine
         WasmContext(uint32_t id, config_t configuration, const Operator &plan, std::size_t size);
 
         bool config(config_t cfg) const { return bool(cfg & config_); }
+        config_t configuration() const { return config_; }
+
+        /** Returns the time saved for the current plan by reusing the table mappings and the heap of previous plans. */
+        duration saved_setup_time() const { return saved_setup_time_; }
+
+        /** Prepares this context to execute \p plan as context with ID \p id.  Resets all state of the previous plan but
+         * retains the table mappings and the heap, s.t. `map_table()` and `map_heap()` can reuse them. */
+        void reuse(unsigned id, const Operator &plan);
+
+        /** Discards the contents of the heap and all table mappings not required by the current plan.  Must be called
+         * before this context is reused. */
+        void release();
+
+        /** Returns the number of bytes, aligned to whole pages, that `map_table()` maps for \p table, excluding the
+         * guard page.  This includes the entries of the dictionaries of all dictionary encoded attributes. */
+        static std::size_t Table_Mapping_Size(const Table &table);
+
+        /** Returns the offset of the entries of the dictionary of the dictionary encoded attribute \p attr relative to
+         * the address returned by `map_table()` for the table of \p attr.  The dictionaries of a table are mapped
+         * directly after its store, in the order of their attributes. */
+        static std::size_t Dictionary_Mapping_Offset(const Attribute &attr);
 
         /** Maps a table at the current start of `heap` and advances `heap` past the mapped region.  Returns the address
          * (in linear memory) of the mapped table.  Installs guard pages after each mapping.  Acknowledges
-         * `TRAP_GUARD_PAGES`.  */
+         * `TRAP_GUARD_PAGES`.  Retains the mapping of a previous plan if \p table is mapped at the same address and its
+         * store has not grown since.  Throws `backend_exception` if the table does not fit into the remaining virtual
+         * address space.  */
         uint32_t map_table(const Table &table);
 
+        /** Maps the remaining virtual address space, starting at `heap`, to fresh memory that serves as the heap of the
+         * Wasm module.  Retains the mapping of a previous plan if `heap` is unchanged. */
+        void map_heap();
+
         /** Installs a guard page at the current `heap` and increments `heap` to the next page.  Acknowledges
          * `TRAP_GUARD_PAGES`. */
         void install_guard_page();
+
+        /** Installs the zones \p qualifying_zones, each of \p zone_size rows, for the scan with ID \p scan_id.  Must be
+         * called before the scan is executed. */
+        void add_qualifying_zones(uint32_t scan_id, std::size_t zone_size, std::vector<bool> qualifying_zones) {
+            qualifying_zones_[scan_id] = qualifying_zones_t{ zone_size, std::move(qualifying_zones) };
+        }
+
+        /** Installs \p qualifying_codes, as computed by `qualifying_codes()`, for the dictionary encoded attribute with
+         * ID \p attr_id of the scan with ID \p scan_id.  Must be called before the scan is executed. */
+        void add_qualifying_codes(uint32_t scan_id, uint32_t attr_id, std::vector<uint8_t> qualifying_codes) {
+            qualifying_codes_[{ scan_id, attr_id }] = std::move(qualifying_codes);
+        }
+
+        /** Returns the qualifying codes installed for the attribute with ID \p attr_id of the scan with ID \p
+         * scan_id. */
+        const std::vector<uint8_t> & qualifying_codes(uint32_t scan_id, uint32_t attr_id) const {
+            auto it = qualifying_codes_.find({ scan_id, attr_id });
+            M_insist(it != qualifying_codes_.end(), "no qualifying codes installed");
+            return it->second;
+        }
+
+        /** Returns the first row ID not less than \p row_id that lies within a qualifying zone of the scan with ID \p
+         * scan_id, or `UINT32_MAX` if there is none.  Returns \p row_id if no zones are installed for the scan. */
+        uint32_t next_qualifying_row(uint32_t scan_id, uint32_t row_id) const;
+
+        /** Returns the first row ID after \p row_id that lies within a non-qualifying zone of the scan with ID \p
+         * scan_id, or `UINT32_MAX` if there is none.  Hence, all rows in between lie within qualifying zones. */
+        uint32_t end_of_qualifying_rows(uint32_t scan_id, uint32_t row_id) const;
     };
 
     private:
     ///> maps unique IDs to `WasmContext` instances
     static inline std::unordered_map<unsigned, std::unique_ptr<WasmContext>> contexts_;
+    ///> released `WasmContext` instances that retain their table mappings and heap for reuse by later plans
+    static inline std::vector<std::unique_ptr<WasmContext>> context_pool_;
+    ///> the maximum number of `WasmContext` instances in `context_pool_`
+    static constexpr std::size_t MAX_POOLED_CONTEXTS = 4;
 
     public:
     /** Creates a new `WasmContext` for ID `id` with `size` bytes of virtual address space. */
@@ -84,6 +187,41 @@ struct WasmEngine
         return { std::ref(*it->second), inserted };
     }
 
+    /** Creates a new `WasmContext` for ID `id` with `size` bytes of virtual address space.  Reuses a pooled context
+     * with the same configuration and size, if any.  Returns the context and whether it was taken from the pool. */
+    static std::pair<std::reference_wrapper<WasmContext>, bool>
+    Acquire_Wasm_Context_For_ID(unsigned id,
+                                WasmContext::config_t configuration = WasmContext::config_t(0x0),
+                                const Operator &plan = NoOpOperator(std::cout),
+                                std::size_t size = WASM_MAX_MEMORY)
+    {
+        auto pooled = std::find_if(context_pool_.begin(), context_pool_.end(), [&](auto &ctx) {
+            return ctx->configuration() == configuration and ctx->vm.size() == Ceil_To_Next_Page(size);
+        });
+        if (pooled == context_pool_.end())
+            return { std::ref(Create_Wasm_Context_For_ID(id, configuration, plan, size)), false };
+
+        auto wasm_context = std::move(*pooled);
+        context_pool_.erase(pooled);
+        wasm_context->reuse(id, plan);
+        auto [it, inserted] = contexts_.emplace(id, std::move(wasm_context));
+        M_insist(inserted, "WasmContext with that ID already exists");
+        return { std::ref(*it->second), true };
+    }
+
+    /** Releases the `WasmContext` `ctx` into the pool of contexts, s.t. `Acquire_Wasm_Context_For_ID()` can reuse it.
+     * Evicts the least recently released context if the pool is full. */
+    static void Release_Wasm_Context(const WasmContext &ctx) {
+        auto it = contexts_.find(ctx.id);
+        M_insist(it != contexts_.end(), "There is no context with the given ID to release");
+        auto wasm_context = std::move(it->second);
+        contexts_.erase(it);
+        wasm_context->release();
+        if (context_pool_.size() == MAX_POOLED_CONTEXTS)
+            context_pool_.erase(context_pool_.begin());
+        context_pool_.push_back(std::move(wasm_context));
+    }
+
     /** Disposes the `WasmContext` with ID `id`. */
     static void Dispose_Wasm_Context(unsigned id) {
         auto res = contexts_.erase(id);
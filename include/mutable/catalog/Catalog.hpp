@@ -224,6 +224,8 @@ struct M_EXPORT Catalog
     Database *database_in_use_ = nullptr; ///< the currently used database
     std::unordered_map<const char*, Function*> standard_functions_; ///< functions defined by the SQL standard
     Timer timer_; ///< a global timer
+    ///> the timer of the calling thread, if it records its measurements separately from the global timer
+    static inline thread_local Timer *thread_timer_ = nullptr;
 
     private:
     Catalog();
@@ -259,10 +261,13 @@ struct M_EXPORT Catalog
     /** Returns a reference to the `StringPool`. */
     const StringPool & get_pool() const { return pool_; }
 
-    /** Returns the global `Timer` instance. */
-    Timer & timer() { return timer_; }
-    /** Returns the global `Timer` instance. */
-    const Timer & timer() const { return timer_; }
+    /** Returns the `Timer` of the calling thread, i.e.\ the global `Timer` instance unless set by `Thread_Timer()`. */
+    Timer & timer() { return thread_timer_ ? *thread_timer_ : timer_; }
+    /** Returns the `Timer` of the calling thread, i.e.\ the global `Timer` instance unless set by `Thread_Timer()`. */
+    const Timer & timer() const { return thread_timer_ ? *thread_timer_ : timer_; }
+    /** Makes the calling thread record its measurements in \p timer rather than in the global `Timer` instance, or
+     * again in the global one if \p timer is `nullptr`. */
+    static void Thread_Timer(Timer *timer) { thread_timer_ = timer; }
 
     /** Returns a reference to the `memory::Allocator`. */
     memory::Allocator & allocator() { return *allocator_; }
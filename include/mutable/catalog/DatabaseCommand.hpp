@@ -74,8 +74,21 @@ struct learn_spns : DatabaseInstruction
     void execute(Diagnostic &diag) override;
 };
 
+/** Compress the integral attributes of the tables given as arguments, or of every table in the database that is
+ * currently in use if no table is given, by frame of reference.  See `storage::compress()`. */
+struct compress : DatabaseInstruction
+{
+    compress(std::vector<std::string> args) : DatabaseInstruction(std::move(args)) { }
+
+    void accept(DatabaseCommandVisitor &v) override;
+    void accept(ConstDatabaseCommandVisitor &v) const override;
+
+    void execute(Diagnostic &diag) override;
+};
+
 #define M_DATABASE_INSTRUCTION_LIST(X) \
-    X(learn_spns)
+    X(learn_spns) \
+    X(compress)
 
 
 /*======================================================================================================================
@@ -213,10 +226,26 @@ struct CreateTable : DDLCommand
     void execute(Diagnostic &diag) override;
 };
 
+struct CreateIndex : DDLCommand
+{
+    private:
+    const char *index_name_;
+    const Attribute &attr_;
+
+    public:
+    CreateIndex(const char *index_name, const Attribute &attr) : index_name_(M_notnull(index_name)), attr_(attr) { }
+
+    void accept(DatabaseCommandVisitor &v) override;
+    void accept(ConstDatabaseCommandVisitor &v) const override;
+
+    void execute(Diagnostic &diag) override;
+};
+
 #define M_DATABASE_DDL_LIST(X)\
     X(CreateDatabase) \
     X(UseDatabase) \
-    X(CreateTable)
+    X(CreateTable) \
+    X(CreateIndex)
 
 #define M_DATABASE_SQL_LIST(X) \
     M_DATABASE_DML_LIST(X) \
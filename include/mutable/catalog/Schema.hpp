@@ -9,12 +9,15 @@
 #include <mutable/catalog/Type.hpp>
 #include <mutable/mutable-config.hpp>
 #include <mutable/storage/DataLayout.hpp>
+#include <mutable/storage/Dictionary.hpp>
+#include <mutable/storage/Index.hpp>
 #include <mutable/storage/Store.hpp>
 #include <mutable/util/ADT.hpp>
 #include <mutable/util/enum_ops.hpp>
 #include <mutable/util/exception.hpp>
 #include <mutable/util/fn.hpp>
 #include <mutable/util/macro.hpp>
+#include <optional>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -289,6 +292,20 @@ struct M_EXPORT Attribute
     ///> the flag indicating whether the attribute is unique; note that a singleton primary key is also unique
     bool unique = false;
     const Attribute *reference = nullptr; ///< the referenced attribute
+    ///> the dictionary by which the attribute is dictionary encoded, or `nullptr` if it is stored inline
+    std::unique_ptr<Dictionary> dictionary;
+
+    /** The frame of reference of a compressed attribute of integral type.  Each value is stored as its difference to
+     * `reference` in the narrower integral `type`. */
+    struct frame_of_reference_t
+    {
+        const Numeric *type; ///< the type of the stored differences
+        int64_t reference; ///< the value the differences are relative to
+
+        bool operator==(const frame_of_reference_t&) const = default;
+    };
+    ///> the frame of reference of the attribute's values if they are compressed, see `storage::compress()`
+    std::optional<frame_of_reference_t> frame_of_reference;
 
     private:
     explicit Attribute(std::size_t id, const Table &table, const PrimitiveType *type, const char *name)
@@ -309,6 +326,10 @@ struct M_EXPORT Attribute
      * a singleton primary key of the corresponding table. */
     bool is_unique() const;
 
+    /** Dictionary encodes `this` `Attribute`.  Must be called before the data layout of the table is created.  Throws
+     * `m::invalid_argument` if `this` `Attribute` is not of `CharacterSequence` type. */
+    void encode_by_dictionary();
+
     /** Compares to attributes.  Attributes are equal if they have the same `id` and belong to the same `table`. */
     bool operator==(const Attribute &other) const { return &this->table == &other.table and this->id == other.id; }
     bool operator!=(const Attribute &other) const { return not operator==(other); }
@@ -439,7 +460,9 @@ struct M_EXPORT Table
     const storage::DataLayout & layout() const { M_insist(bool(layout_)); return layout_; }
     /** Sets the physical data layout for this table. */
     void layout(storage::DataLayout &&new_layout) { layout_ = std::move(new_layout); }
-    /** Sets the physical data layout for this table by calling `factory.make()`. */
+    /** Sets the physical data layout for this table by calling `factory.make()`.  Lays out the codes of dictionary
+     * encoded attributes instead of their strings and the differences of compressed attributes to their frame of
+     * reference instead of their values. */
     void layout(const storage::DataLayoutFactory &factory);
 
     /** Returns all attributes forming the primary key. */
@@ -514,7 +537,7 @@ struct M_EXPORT Function
 #undef kind_t
 };
 
-/** A `Database` is a set of `Table`s, `Function`s, and `Statistics`. */
+/** A `Database` is a set of `Table`s, `Index`es, `Function`s, and `Statistics`. */
 struct M_EXPORT Database
 {
     friend struct Catalog;
@@ -523,6 +546,7 @@ struct M_EXPORT Database
     const char *name; ///< the name of the database
     private:
     std::unordered_map<const char*, Table*> tables_; ///< the tables of this database
+    std::unordered_map<const char*, Index*> indexes_; ///< the indexes on tables of this database
     std::unordered_map<const char*, Function*> functions_; ///< functions defined in this database
     std::unique_ptr<CardinalityEstimator> cardinality_estimator_; ///< the `CardinalityEstimator` of this `Database`
 
@@ -557,6 +581,19 @@ struct M_EXPORT Database
         return *it->second;
     }
 
+    /*===== Indexes ==================================================================================================*/
+    /** Returns a reference to the `Index` with the given `name`.  Throws `std::out_of_range` if no `Index` with the
+     * given `name` exists in this `Database`. */
+    Index & get_index(const char *name) const { return *indexes_.at(name); }
+    /** Returns a reference to the `Index` with the given `id`.  Throws `std::out_of_range` if no `Index` with the
+     * given `id` exists in this `Database`. */
+    Index & get_index(uint32_t id) const;
+    /** Adds a new `Index` with the given `name` on attribute `attr` to this `Database` and indexes all rows of the
+     * table of `attr`.  Throws `std::invalid_argument` if an `Index` with the given `name` already exists. */
+    Index & add_index(const char *name, const Attribute &attr);
+    /** Returns all `Index`es on attributes of `table`, ordered by their ID. */
+    std::vector<Index*> indexes_of(const Table &table) const;
+
     /*===== Functions ================================================================================================*/
     /** Returns a reference to the `Function` with the given `name`.  First searches this `Database` instance.  If no
      * `Function` with the given `name` is found, searches the global `Catalog`.  Throws `std::invalid_argument` if no
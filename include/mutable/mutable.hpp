@@ -3,6 +3,7 @@
 #include <mutable/mutable-config.hpp>
 
 #include <filesystem>
+#include <memory>
 #include <mutable/backend/Backend.hpp>
 #include <mutable/catalog/CardinalityEstimator.hpp>
 #include <mutable/catalog/Catalog.hpp>
@@ -16,6 +17,7 @@
 #include <mutable/IR/PlanEnumerator.hpp>
 #include <mutable/IR/PlanTable.hpp>
 #include <mutable/IR/QueryGraph.hpp>
+#include <mutable/IR/ResultBatch.hpp>
 #include <mutable/IR/Tuple.hpp>
 #include <mutable/lex/Token.hpp>
 #include <mutable/lex/TokenType.hpp>
@@ -36,6 +38,7 @@
 #include <mutable/util/StringPool.hpp>
 #include <mutable/util/Timer.hpp>
 #include <mutable/version.hpp>
+#include <thread>
 
 
 namespace m {
@@ -67,6 +70,94 @@ void M_EXPORT execute_instruction(Diagnostic &diag, const ast::Instruction &inst
 /** Optimizes and executes the given `SelectStmt`.  Result tuples are passed to the given `consumer`. */
 void M_EXPORT execute_query(Diagnostic &diag, const ast::SelectStmt &stmt, std::unique_ptr<Consumer> consumer);
 
+/** A `SELECT` statement with placeholders `?`, that is parsed and semantically analyzed once by `prepare_query()` and
+ * can then be executed repeatedly with different values bound to its placeholders by `execute_query()`. */
+struct M_EXPORT PreparedStatement
+{
+    private:
+    std::unique_ptr<ast::SelectStmt> stmt_; ///< the analyzed statement
+    ///> the types of the placeholders, in order of their appearance in the statement
+    std::vector<const PrimitiveType*> parameter_types_;
+
+    public:
+    PreparedStatement(std::unique_ptr<ast::SelectStmt> stmt, std::vector<const PrimitiveType*> parameter_types)
+        : stmt_(std::move(stmt))
+        , parameter_types_(std::move(parameter_types))
+    {
+        M_insist(bool(stmt_));
+    }
+
+    /** Returns the analyzed statement. */
+    const ast::SelectStmt & stmt() const { return *stmt_; }
+    /** Returns the number of placeholders of the statement. */
+    std::size_t num_parameters() const { return parameter_types_.size(); }
+    /** Returns the type of the \p idx-th placeholder of the statement.  A placeholder adopts the scalar type of the
+     * other operand of the binary expression it occurs in. */
+    const PrimitiveType * parameter_type(std::size_t idx) const { return parameter_types_.at(idx); }
+};
+
+/** Use lexer, parser, and semantic analysis to create a `PreparedStatement` from the `SELECT` statement `str`. */
+std::unique_ptr<PreparedStatement> M_EXPORT prepare_query(Diagnostic &diag, const std::string &str);
+
+/** Binds `params` to the placeholders of `stmt`, then optimizes and executes `stmt`.  Result tuples are passed to the
+ * given `consumer`.  The i-th value is bound to the i-th placeholder and must be given in the representation of
+ * `stmt.parameter_type(i)`, e.g. a decimal as integer scaled by its scale; values must not be NULL.  The backend reads
+ * the bound values upon execution rather than embedding them into the code, hence with the WasmV8 backend and
+ * `--wasm-compilation-cache`, all executions of `stmt` with equal plans share a single compiled module. */
+void M_EXPORT execute_query(Diagnostic &diag, const PreparedStatement &stmt, const std::vector<Value> &params,
+                            std::unique_ptr<Consumer> consumer);
+
+/** A pull-based cursor over the results of a query, created by `open_query()`.  The query is executed by a separate
+ * thread, that passes the results in `ResultBatch`es to the client.  After passing a batch, the executing thread is
+ * suspended until the client requests the next batch.  Hence, at most one batch of results is held in memory, and a
+ * client may stop early by cancelling the query or destroying the handle, without computing the remaining results.
+ *
+ * The library is not thread-safe, e.g.\ the `Catalog` and its string pool, the contexts of the Wasm engine, and the
+ * lazily built zone maps and indexes are shared without synchronization.  Therefore, the executing thread only runs
+ * while the client waits for it in `next_batch()`, `cancel()`, or the destructor, and it starts only upon the first
+ * call to `next_batch()`.  Thus, execution is serialized with the client and with the queries of other handles.  The
+ * executing thread records its measurements in a timer of its own rather than in `Catalog::timer()`.  All methods of
+ * a handle must be called by the thread that opened the query. */
+struct M_EXPORT QueryHandle
+{
+    struct channel_t; ///< hands batches over from the executing thread to the client
+
+    private:
+    Schema schema_; ///< the schema of the batches, i.e.\ of the results without constants and duplicates
+    std::shared_ptr<channel_t> channel_; ///< the channel shared with the executing thread
+    std::thread executor_; ///< the thread executing the query
+    std::thread::id client_; ///< the thread that opened the query
+
+    public:
+    QueryHandle(Schema schema, std::shared_ptr<channel_t> channel, std::thread executor);
+    QueryHandle(const QueryHandle&) = delete;
+    /** Cancels the query, if not yet finished, and waits for the executing thread. */
+    ~QueryHandle();
+
+    /** Returns the schema of the batches returned by `next_batch()`. */
+    const Schema & schema() const { return schema_; }
+
+    /** Returns the next batch of results, or `nullptr` if all results have been returned or the query has been
+     * cancelled.  Resumes the executing thread and waits until it passes the next batch.  The returned batch references
+     * memory of the executing thread and remains valid until the next call to `next_batch()` or `cancel()`.  Rethrows
+     * an exception thrown during the execution of the query. */
+    const ResultBatch * next_batch();
+
+    /** Cancels the query and waits until the executing thread has aborted it.  Subsequent calls to `next_batch()`
+     * return `nullptr`. */
+    void cancel();
+};
+
+/** Optimizes \p stmt and prepares its execution by a separate thread, that starts upon the first request of a batch.
+ * Returns a `QueryHandle` to pull the results in batches of exactly \p batch_size tuples, except for the last batch
+ * which may be smaller.  This holds for every backend.  \p stmt must outlive the returned handle. */
+std::unique_ptr<QueryHandle> M_EXPORT open_query(Diagnostic &diag, const ast::SelectStmt &stmt,
+                                                 std::size_t batch_size = 1024);
+
+/** Like `open_query()` above, but first binds \p params to the placeholders of \p stmt, see `execute_query()`. */
+std::unique_ptr<QueryHandle> M_EXPORT open_query(Diagnostic &diag, const PreparedStatement &stmt,
+                                                 const std::vector<Value> &params, std::size_t batch_size = 1024);
+
 /**
  * Loads a CSV file into a `Table`.
  *
@@ -96,19 +187,21 @@ void M_EXPORT execute_file(Diagnostic &diag, const std::filesystem::path &path);
 struct M_EXPORT StoreWriter
 {
     private:
+    Table &table_; ///< the table to write to; its data layout changes if frames of reference must be widened
     Store &store_; ///< the store to access
     Schema S; ///< the schema of the tuples to read/write
     mutable std::unique_ptr<m::StackMachine> writer_; ///< the writing `StackMachine`
     mutable const storage::DataLayout *layout_ = nullptr; ///< the last seen `DataLayout`; used to observe updates
 
     public:
-    StoreWriter(Store &store);
+    StoreWriter(Table &table);
     ~StoreWriter();
 
     /** Returns the `Schema` of `Tuple`s to write. */
     const Schema & schema() const { return S; }
 
-    /** Appends `tup` to the store. */
+    /** Appends `tup` to the store.  Widens the frames of reference of compressed attributes that `tup` does not fit
+     * into, see `storage::widen_frames_of_reference()`. */
     void append(const Tuple &tup) const;
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdlib>
 #include <iostream>
 #include <memory>
 #include <mutable/catalog/Schema.hpp>
@@ -201,7 +202,8 @@ struct M_EXPORT Designator : Expr
     void decrease_binding_depth() { M_insist(binding_depth_ > 0); --binding_depth_; }
 };
 
-/** A constant: a string literal or a numeric constant. */
+/** A constant: a string literal or a numeric constant.  A placeholder `?` of a prepared statement is a constant, too,
+ * whose value is only bound upon execution of the statement. */
 struct M_EXPORT Constant : Expr
 {
     Constant(Token tok) : Expr(tok) {}
@@ -226,6 +228,13 @@ struct M_EXPORT Constant : Expr
     bool is_string() const { return tok.type == TK_STRING_LITERAL; }
     bool is_date() const { return tok.type == TK_DATE; }
     bool is_datetime() const { return tok.type == TK_DATE_TIME; }
+    bool is_placeholder() const { return tok.type == TK_QMARK; }
+
+    /** Returns the index of this placeholder within its statement, counting from 0. */
+    std::size_t placeholder_index() const {
+        M_insist(is_placeholder());
+        return std::strtoul(tok.text + 1, nullptr, 10) - 1; // skip leading `?`
+    }
 };
 
 /** A postfix expression. */
@@ -683,6 +692,15 @@ struct M_EXPORT NotNullConstraint : Constraint
     void accept(ConstASTConstraintVisitor &v) const override;
 };
 
+/** Requests dictionary encoding of an attribute of `CharacterSequence` type, see `Dictionary`. */
+struct M_EXPORT DictionaryConstraint : Constraint
+{
+    DictionaryConstraint(Token tok) : Constraint(tok) { }
+
+    void accept(ASTConstraintVisitor &v) override;
+    void accept(ConstASTConstraintVisitor &v) const override;
+};
+
 struct M_EXPORT CheckConditionConstraint : Constraint
 {
     std::unique_ptr<Expr> cond;
@@ -725,6 +743,7 @@ struct M_EXPORT ReferenceConstraint : Constraint
     X(m::ast::PrimaryKeyConstraint) \
     X(m::ast::UniqueConstraint) \
     X(m::ast::NotNullConstraint) \
+    X(m::ast::DictionaryConstraint) \
     X(m::ast::CheckConditionConstraint) \
     X(m::ast::ReferenceConstraint)
 
@@ -855,6 +874,22 @@ struct M_EXPORT CreateTableStmt : Stmt
     void accept(ConstASTCommandVisitor &v) const override;
 };
 
+struct M_EXPORT CreateIndexStmt : Stmt
+{
+    Token index_name;
+    Token table_name;
+    Token attr_name;
+
+    CreateIndexStmt(Token index_name, Token table_name, Token attr_name)
+            : index_name(index_name)
+            , table_name(table_name)
+            , attr_name(attr_name)
+    { }
+
+    void accept(ASTCommandVisitor &v) override;
+    void accept(ConstASTCommandVisitor &v) const override;
+};
+
 /** A SQL select statement. */
 struct M_EXPORT SelectStmt : Stmt
 {
@@ -967,6 +1002,7 @@ struct M_EXPORT DSVImportStmt : ImportStmt
     X(m::ast::CreateDatabaseStmt) \
     X(m::ast::UseDatabaseStmt) \
     X(m::ast::CreateTableStmt) \
+    X(m::ast::CreateIndexStmt) \
     X(m::ast::SelectStmt) \
     X(m::ast::InsertStmt) \
     X(m::ast::UpdateStmt) \
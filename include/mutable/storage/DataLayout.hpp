@@ -7,12 +7,14 @@
 #include <mutable/util/exception.hpp>
 #include <mutable/util/macro.hpp>
 #include <mutable/util/Visitor.hpp>
+#include <optional>
 #include <vector>
 
 
 namespace m {
 
 // forward declarations
+struct Dictionary;
 struct Schema;
 struct Type;
 
@@ -68,7 +70,11 @@ struct M_EXPORT DataLayout
     };
 
     /** The `Leaf` represents exactly one attribue.  It holds the `Type` of the `Attribute` together with a unique
-     * index.  With the unique index it is possible to associate the `Attribute` to this `Leaf`. */
+     * index.  With the unique index it is possible to associate the `Attribute` to this `Leaf`.  A *dictionary
+     * encoded* `Leaf` stores the codes of the attribute's strings in a `Dictionary` instead of the strings themselves.
+     * Its `Type` is the `Dictionary::Code_Type()` rather than the `Type` of the `Attribute`.  A *compressed* `Leaf`
+     * stores the differences of the attribute's integral values to a reference value, its *frame of reference*.  Its
+     * `Type` is an integral `Type` narrower than the `Type` of the `Attribute`. */
     struct M_EXPORT Leaf : Node
     {
         friend struct DataLayout;
@@ -79,6 +85,10 @@ struct M_EXPORT DataLayout
         const m::Type *type_;
         ///> an index that must be unique within the entire `DataLayout`
         size_type idx_;
+        ///> the `Dictionary` of the codes stored in this `Leaf`, or `nullptr` if this `Leaf` is not dictionary encoded
+        Dictionary *dictionary_ = nullptr;
+        ///> the reference value of the differences stored in this `Leaf`, if this `Leaf` is compressed
+        std::optional<int64_t> reference_;
 
         Leaf(const m::Type *type, size_type idx) : type_(type), idx_(idx) { }
 
@@ -87,6 +97,12 @@ struct M_EXPORT DataLayout
         const m::Type * type() const { return type_; }
         /** Returns the index assigned to this `Leaf`.  Must be unique within the entire `DataLayout`. */
         size_type index() const { return idx_; }
+        /** Returns the `Dictionary` of the codes stored in this `Leaf`, or `nullptr` if this `Leaf` is not dictionary
+         * encoded. */
+        Dictionary * dictionary() const { return dictionary_; }
+        /** Returns the reference value which must be added to the stored differences to obtain the attribute's values,
+         * or `std::nullopt` if this `Leaf` is not compressed. */
+        std::optional<int64_t> reference() const { return reference_; }
 
         size_type num_tuples() const override { return 1; }
 
@@ -221,6 +237,13 @@ struct M_EXPORT DataLayout
      */
     INode & add_inode(size_type num_tuples, uint64_t stride_in_bits);
 
+    /** Dictionary encodes the `Leaf` with index \p idx by \p dictionary.  The `Leaf` must be of type
+     * `Dictionary::Code_Type()`.  Throws `m::invalid_argument` if no such `Leaf` exists. */
+    void encode(size_type idx, Dictionary &dictionary);
+    /** Compresses the `Leaf` with index \p idx s.t. it stores the differences of values to \p reference.  The `Leaf`
+     * must be of integral type.  Throws `m::invalid_argument` if no such `Leaf` exists. */
+    void compress(size_type idx, int64_t reference);
+
     void accept(ConstDataLayoutVisitor &v) const;
     void for_sibling_leaves(callback_leaves_t callback) const;
 
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <mutable/mutable-config.hpp>
+#include <mutable/util/macro.hpp>
+#include <mutable/util/memory.hpp>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+
+namespace m {
+
+/*----- forward declarations -----------------------------------------------------------------------------------------*/
+struct CharacterSequence;
+struct PrimitiveType;
+
+/** A dictionary for the dictionary encoding of an attribute of `CharacterSequence` type.  The dictionary assigns each
+ * distinct string a dense integral *code*, in the order of first occurrence.  The data layout of the attribute's table
+ * stores the codes instead of the strings, see `DataLayout::Leaf::dictionary()`.
+ *
+ * The strings are stored in a `memory::Memory` as fixed-width entries that are laid out exactly like the attribute's
+ * strings would be stored inline, i.e.\ `CHAR(N)` entries are N bytes wide and padded with NUL bytes and `VARCHAR(N)`
+ * entries are N+1 bytes wide and NUL-terminated.  Hence, the address of the string of code `c` is the address of the
+ * memory plus `c` times `entry_size()`, and decoding a code neither requires a lookup nor copying the string.  Since
+ * entries are only ever appended, codes and addresses of strings remain valid for the lifetime of the dictionary. */
+struct M_EXPORT Dictionary
+{
+    using code_type = uint32_t;
+
+    ///> the size of the virtual address space reserved for the entries
+    static constexpr std::size_t ALLOCATION_SIZE = 1UL << 30; ///< 1 GiB
+
+    const uint32_t id; ///< a unique ID, by which generated code refers to this dictionary
+
+    private:
+    static inline uint32_t next_id_ = 0; ///< the ID of the next dictionary to create
+    const CharacterSequence &type_; ///< the type of the encoded strings
+    memory::LinearAllocator allocator_; ///< the allocator of the entries' memory
+    memory::Memory data_; ///< the entries
+    std::size_t size_ = 0; ///< the number of entries
+    ///> maps each string, referencing its entry, to its code
+    std::unordered_map<std::string_view, code_type> codes_;
+
+    public:
+    /** Creates an empty dictionary for strings of type \p type. */
+    explicit Dictionary(const CharacterSequence &type);
+    Dictionary(const Dictionary&) = delete;
+
+    /** Returns the type of the codes as they are stored in the data layout. */
+    static const PrimitiveType * Code_Type();
+
+    /** Returns the type of the encoded strings. */
+    const CharacterSequence & type() const { return type_; }
+    /** Returns the number of entries, i.e.\ the number of distinct strings encoded so far. */
+    std::size_t size() const { return size_; }
+    /** Returns the size in bytes of a single entry. */
+    std::size_t entry_size() const;
+    /** Returns the number of bytes of the memory occupied by entries. */
+    std::size_t size_in_bytes() const { return size_ * entry_size(); }
+    /** Returns the memory of the entries. */
+    const memory::Memory & memory() const { return data_; }
+
+    /** Returns the code of \p str.  Adds \p str to the dictionary if it is not yet contained.  Strings exceeding the
+     * length of the dictionary's type are truncated, just like when storing them inline. */
+    code_type encode(const char *str);
+    /** Returns the code of \p str, or `std::nullopt` if \p str is not contained in the dictionary. */
+    std::optional<code_type> find(const char *str) const;
+    /** Returns the address of the entry of \p code. */
+    const char * decode(code_type code) const {
+        M_insist(code < size_, "code out of bounds");
+        return data_.as<const char*>() + code * entry_size();
+    }
+
+    void dump(std::ostream &out) const;
+    void dump() const;
+};
+
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <mutable/mutable-config.hpp>
+#include <mutable/util/macro.hpp>
+#include <utility>
+#include <vector>
+
+
+namespace m {
+
+/*----- forward declarations -----------------------------------------------------------------------------------------*/
+struct Attribute;
+struct Table;
+
+/** A secondary index on a single attribute of integral type of a `Table`.  The index is implemented as a sorted array
+ * of (key, row ID) pairs, i.e.\ a densely packed leaf level of a B+-tree, which allows lookups by binary search and
+ * range scans by sequentially reading the row IDs of adjacent entries.  Rows where the indexed attribute is NULL are
+ * not indexed.
+ *
+ * Since `Store::append()` only allocates a row that is written afterwards, the index cannot be maintained on append.
+ * Instead, `update()` indexes all rows appended to the store since the last update and must be called before the
+ * index is used. */
+struct M_EXPORT Index
+{
+    using key_type = int64_t;
+    using entry_type = std::pair<key_type, uint32_t>; ///< a key and the ID of the row with this key
+
+    const uint32_t id; ///< a unique ID, by which generated code refers to this index
+    const char *name; ///< the name of the index
+    const Attribute &attr; ///< the indexed attribute
+
+    private:
+    static inline uint32_t next_id_ = 0; ///< the ID of the next index to create
+    std::vector<entry_type> entries_; ///< the index entries, sorted by key and row ID
+    std::size_t num_rows_indexed_ = 0; ///< the number of rows of the store that were indexed
+    const void *store_addr_ = nullptr; ///< the address of the store's memory at the time of the last update
+
+    public:
+    /** Creates an empty index named \p name on \p attr.  Throws `std::invalid_argument` if \p attr is not of integral
+     * type. */
+    Index(const char *name, const Attribute &attr);
+    Index(const Index&) = delete;
+
+    /** Returns the table of the indexed attribute. */
+    const Table & table() const;
+
+    /** Returns the number of entries of this index. */
+    std::size_t size() const { return entries_.size(); }
+    /** Returns the number of rows of the store that are covered by this index. */
+    std::size_t num_rows_indexed() const { return num_rows_indexed_; }
+
+    /** Indexes all rows that were appended to the store of the indexed table since the last update.  Rebuilds the
+     * index if rows were dropped or the store has moved since.  Rows must not be both dropped and appended between two
+     * updates such that the number of rows does not shrink, since this cannot be detected. */
+    void update();
+
+    /** Returns the position of the first entry with a key not less than \p key. */
+    std::size_t lower_bound(key_type key) const;
+    /** Returns the position of the first entry with a key greater than \p key. */
+    std::size_t upper_bound(key_type key) const;
+
+    /** Returns the row ID of the entry at position \p pos. */
+    uint32_t row_id(std::size_t pos) const { M_insist(pos < entries_.size()); return entries_[pos].second; }
+    /** Writes the row IDs of the entries at the positions in [\p begin, \p end) to \p out. */
+    void row_ids(std::size_t begin, std::size_t end, uint32_t *out) const;
+
+    void dump(std::ostream &out) const;
+    void dump() const;
+};
+
+}
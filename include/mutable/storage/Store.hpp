@@ -16,25 +16,30 @@ struct Attribute;
 struct Schema;
 struct StackMachine;
 struct Table;
+struct ZoneMap;
 
 /** Defines a generic store interface. */
 struct M_EXPORT Store
 {
     private:
     const Table &table_; ///< the table defining this store's schema
+    mutable std::unique_ptr<ZoneMap> zone_map_; ///< summarizes the rows of this store; created on first use
 
     protected:
-    Store(const Table &table) : table_(table) {}
+    Store(const Table &table);
 
     public:
     Store(const Store &) = delete;
 
     Store(Store &&) = default;
 
-    virtual ~Store() {}
+    virtual ~Store();
 
     const Table &table() const { return table_; }
 
+    /** Returns the `ZoneMap` of this store after summarizing all rows appended since it was last used. */
+    const ZoneMap & zone_map() const;
+
     /** Returns the memory corresponding to the `Linearization`'s root node. */
     virtual const memory::Memory & memory() const = 0;
 
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <mutable/mutable-config.hpp>
+#include <mutable/util/macro.hpp>
+#include <vector>
+
+
+namespace m {
+
+/*----- forward declarations -----------------------------------------------------------------------------------------*/
+struct Attribute;
+struct Table;
+struct Type;
+
+/** A zone map, aka.\ *small materialized aggregates*, summarizes the rows of a `Store` in zones of consecutive rows.
+ * For each zone and each attribute of integral, `Date`, or `DateTime` type, it records the minimum and the maximum
+ * value and the number of NULL values.  A scan can skip all zones whose summary proves that no row satisfies a range
+ * predicate.
+ *
+ * Zones are aligned to the blocks of the table's `DataLayout`, i.e.\ a zone comprises a whole number of blocks, and
+ * their size is a whole multiple of `ZONE_SIZE_ALIGNMENT` rows, s.t. each zone can be scanned by SIMD.
+ *
+ * Since `Store::append()` only allocates a row that is written afterwards, the zone map cannot be maintained on
+ * append.  Instead, `update()` summarizes all rows appended to the store since the last update and must be called
+ * before the zone map is used. */
+struct M_EXPORT ZoneMap
+{
+    ///> the minimal number of rows of a zone
+    static constexpr std::size_t MIN_ZONE_SIZE = 1024;
+    ///> the number of rows the size of a zone must be a whole multiple of
+    static constexpr std::size_t ZONE_SIZE_ALIGNMENT = 64;
+
+    /** The summary of the values of a single attribute in a single zone. */
+    struct summary_t
+    {
+        int64_t min = std::numeric_limits<int64_t>::max(); ///< the smallest non-NULL value
+        int64_t max = std::numeric_limits<int64_t>::lowest(); ///< the greatest non-NULL value
+        uint32_t num_nulls = 0; ///< the number of NULL values
+    };
+
+    private:
+    const Table &table_; ///< the summarized table
+    std::size_t zone_size_ = 0; ///< the number of rows of a zone
+    std::size_t num_rows_summarized_ = 0; ///< the number of rows of the store that are summarized
+    const void *store_addr_ = nullptr; ///< the address of the store's memory at the time of the last update
+    ///> for each attribute, the summaries of all zones; empty for attributes that are not summarized
+    std::vector<std::vector<summary_t>> summaries_;
+
+    public:
+    /** Creates an empty zone map of \p table. */
+    explicit ZoneMap(const Table &table);
+    ZoneMap(const ZoneMap&) = delete;
+
+    /** Returns `true` iff attributes of type \p ty are summarized by zone maps. */
+    static bool Is_Summarized(const Type &ty);
+
+    /** Returns the summarized table. */
+    const Table & table() const { return table_; }
+
+    /** Returns the number of rows of a zone, or 0 if the zone map was never updated. */
+    std::size_t zone_size() const { return zone_size_; }
+    /** Returns the number of rows of the store that are summarized. */
+    std::size_t num_rows_summarized() const { return num_rows_summarized_; }
+    /** Returns the number of zones, where the last zone may be only partially filled. */
+    std::size_t num_zones() const {
+        return zone_size_ ? (num_rows_summarized_ + zone_size_ - 1) / zone_size_ : 0;
+    }
+    /** Returns the number of rows of the zone \p zone. */
+    std::size_t num_rows_of(std::size_t zone) const {
+        M_insist(zone < num_zones());
+        return std::min(zone_size_, num_rows_summarized_ - zone * zone_size_);
+    }
+
+    /** Returns the summary of \p attr in the zone \p zone.  Requires \p attr to be summarized. */
+    const summary_t & summary(const Attribute &attr, std::size_t zone) const;
+
+    /** Returns `false` if no row of the zone \p zone has a non-NULL value of \p attr within the closed interval
+     * [\p lower, \p upper], and `true` otherwise.  Requires \p attr to be summarized. */
+    bool may_contain(const Attribute &attr, std::size_t zone, int64_t lower, int64_t upper) const {
+        auto &s = summary(attr, zone);
+        return lower <= upper and s.num_nulls != num_rows_of(zone) and s.min <= upper and lower <= s.max;
+    }
+
+    /** Summarizes all rows that were appended to the store of the table since the last update.  Rebuilds the zone
+     * map if rows were dropped, the store has moved, or the block size of the data layout has changed since. */
+    void update();
+
+    void dump(std::ostream &out) const;
+    void dump() const;
+};
+
+}
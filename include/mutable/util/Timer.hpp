@@ -157,6 +157,22 @@ struct Timer
     /** Creates a new `TimingProcess` with the given `name`. */
     TimingProcess create_timing(std::string name) { return TimingProcess(*this, /* ID= */ start(name)); }
 
+    /** Records a finished `Measurement` with the given `name` and duration `d` that ends *NOW*.  This allows to report
+     * durations that are not measured directly, e.g. the time saved by avoiding work. */
+    void record(std::string name, duration d) {
+        auto it = std::find_if(measurements_.begin(), measurements_.end(),
+                               [&](auto &elem) { return elem.name == name; });
+        const auto now = clock::now();
+        if (it != measurements_.end()) { // overwrite existing, finished measurement
+            if (it->is_active())
+                throw m::invalid_argument("a measurement with that name is already in progress");
+            it->begin = now - d;
+            it->end = now;
+        } else {
+            measurements_.emplace_back(std::move(name), now - d, now);
+        }
+    }
+
     /** Print all finished and in-process timings of `timer` to `out`. */
     friend std::ostream & operator<<(std::ostream &out, const Timer &timer) {
         out << "Timer measurements:\n";
@@ -263,7 +263,7 @@ void CNFGenerator::operator()(Const<UnaryExpr> &e)
 
 void CNFGenerator::operator()(Const<BinaryExpr> &e)
 {
-    if (e.lhs->type()->is_boolean() and e.rhs->type()->is_boolean()) {
+    if (e.op() != TK_In and e.lhs->type()->is_boolean() and e.rhs->type()->is_boolean()) {
         /* This is an expression in predicate logic.  Convert to CNF. */
         (*this)(*e.lhs);
         auto cnf_lhs = result_;
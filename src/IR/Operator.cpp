@@ -34,7 +34,12 @@ std::ostream & m::operator<<(std::ostream &out, const Operator &op) {
         }
     };
     visit(overloaded {
-        [&out, &depth](const CallbackOperator &op) { indent(out, op, depth).out << "CallbackOperator"; },
+        [&out, &depth](const CallbackOperator &op) {
+            indent i(out, op, depth);
+            out << "CallbackOperator";
+            if (op.is_batched())
+                out << " in batches of " << op.batch_size();
+        },
         [&out, &depth](const PrintOperator &op) {
             indent i(out, op, depth);
             out << "PrintOperator";
@@ -51,7 +56,15 @@ std::ostream & m::operator<<(std::ostream &out, const Operator &op) {
             indent(out, op, depth).out << "DisjunctiveFilterOperator " << op.filter();
         },
         [&out, &depth](const JoinOperator &op) {
-            indent(out, op, depth).out << "JoinOperator " << op.predicate();
+            indent i(out, op, depth);
+            out << "JoinOperator ";
+            switch (op.kind()) {
+                case JoinOperator::J_Inner:                                     break;
+                case JoinOperator::J_Semi:          out << "SEMI ";             break;
+                case JoinOperator::J_Anti:          out << "ANTI ";             break;
+                case JoinOperator::J_NullAwareAnti: out << "NULL-AWARE ANTI ";  break;
+            }
+            out << op.predicate();
         },
         [&out, &depth](const ProjectionOperator &op) { indent(out, op, depth).out << "ProjectionOperator"; },
         [&out, &depth](const LimitOperator &op) {
@@ -133,7 +146,9 @@ void Operator::dot(std::ostream &out) const
                 << "    " << id(*op.child(0)) << EDGE << id(op) << ";\n";
         },
         [&out](const JoinOperator &op) {
-            out << "    " << id(op) << " [label=<<B>⋈</B><SUB><FONT COLOR=\"0.0 0.0 0.25\" POINT-SIZE=\"10\">"
+            out << "    " << id(op) << " [label=<<B>" << (op.kind() == JoinOperator::J_Inner ? "⋈" :
+                                                  op.kind() == JoinOperator::J_Semi  ? "⋉" : "▷")
+                << "</B><SUB><FONT COLOR=\"0.0 0.0 0.25\" POINT-SIZE=\"10\">"
                 << html_escape(to_string(op.predicate()))
                 << "</FONT></SUB>>];\n";
 
@@ -244,6 +244,44 @@ Optimizer::optimize_with_plantable(const QueryGraph &G) const
     std::unique_ptr<Producer> plan = construct_plan(G, plan_table, source_plans);
     auto &entry = plan_table.get_final();
 
+    /* Perform semi-joins and anti-joins.  The nested query is the build side and the joined sources are the probe side.
+     * As a semi-join never increases the number of tuples, its cardinality is estimated by that of the probe side. */
+    for (auto &SJ : G.semi_joins()) {
+        const bool old = std::exchange(needs_projection_, true); // nested queries need projection
+        auto [sub_plan, sub] = optimize(SJ->query_graph());
+        needs_projection_ = old;
+
+        /* Prefix the value compared by an `IN` predicate with the alias of the nested query. */
+        M_insist(is<ProjectionOperator>(sub_plan), "only projection may rename attributes");
+        const char *res = C.pool("$res");
+        Schema S;
+        for (auto &e : sub_plan->schema()) {
+            if (not e.id.prefix and e.id.name == res)
+                S.add({ SJ->alias(), res }, e.type, e.constraints);
+            else
+                S.add(e.id, e.type, e.constraints);
+        }
+        sub_plan->schema() = S;
+
+        JoinOperator::kind_t kind;
+        switch (SJ->kind()) {
+            case SemiJoin::SJ_Semi:             kind = JoinOperator::J_Semi;            break;
+            case SemiJoin::SJ_Anti:             kind = JoinOperator::J_Anti;            break;
+            case SemiJoin::SJ_NullAwareAnti:    kind = JoinOperator::J_NullAwareAnti;   break;
+        }
+        auto join = std::make_unique<JoinOperator>(SJ->condition(), kind);
+        join->add_child(sub_plan.release());
+        join->add_child(plan.release());
+
+        /* Set operator information. */
+        auto info = std::make_unique<OperatorInformation>();
+        info->subproblem = Subproblem((1UL << G.sources().size()) - 1UL);
+        info->estimated_cardinality = join->child(1)->info().estimated_cardinality;
+
+        join->info(std::move(info));
+        plan = std::move(join);
+    }
+
     /* Perform grouping. */
     if (not G.group_by().empty()) {
         /* Compute `DataModel` after grouping. */
@@ -25,6 +25,20 @@ struct Decorrelation;
 bool Query::is_correlated() const { return query_graph_->is_correlated(); }
 
 
+/*======================================================================================================================
+ * SemiJoin
+ *====================================================================================================================*/
+
+SemiJoin::SemiJoin(kind_t kind, const char *alias, std::unique_ptr<QueryGraph> query_graph, cnf::CNF condition)
+    : kind_(kind)
+    , alias_(M_notnull(alias))
+    , query_graph_(std::move(query_graph))
+    , condition_(std::move(condition))
+{ }
+
+SemiJoin::~SemiJoin() { }
+
+
 /*======================================================================================================================
  * Decorrelation of nested queries
  * -------------------------------
@@ -550,6 +564,106 @@ fallback:
 
 
 
+
+/** Returns the `EXISTS` or `IN` expression of \p pred, or `nullptr` if \p pred is neither. */
+const ast::Expr * get_membership(const cnf::Predicate &pred)
+{
+    if (auto unary = cast<const ast::UnaryExpr>(&pred.expr()); unary and unary->op() == TK_Exists)
+        return unary;
+    if (auto binary = cast<const ast::BinaryExpr>(&pred.expr()); binary and binary->op() == TK_In)
+        return binary;
+    return nullptr;
+}
+
+/** Returns `true` iff \p clause contains an `EXISTS` or `IN` expression. */
+bool contains_membership(const cnf::Clause &clause)
+{
+    bool contains = false;
+    auto visitor = overloaded {
+        [](auto&) { },
+        [&contains](const ast::UnaryExpr &e) { contains = contains or e.op() == TK_Exists; },
+        [&contains](const ast::BinaryExpr &e) { contains = contains or e.op() == TK_In; },
+    };
+    for (auto &pred : clause)
+        visit(visitor, *pred, m::tag<ast::ConstPreOrderExprVisitor>());
+    return contains;
+}
+
+void GraphBuilder::process_membership(const cnf::Predicate &pred)
+{
+    Catalog &C = Catalog::Get();
+
+    auto membership = M_notnull(get_membership(pred));
+    auto binary = cast<const ast::BinaryExpr>(membership); // the `IN` expression, if any
+    const ast::QueryExpr *query;
+    SemiJoin::kind_t kind;
+    cnf::CNF condition;
+    if (binary) {
+        query = &as<const ast::QueryExpr>(*binary->rhs);
+        kind = pred.negative() ? SemiJoin::SJ_NullAwareAnti : SemiJoin::SJ_Semi;
+        if (binary->lhs->contains_free_variables())
+            throw m::invalid_argument("the left-hand side of IN must not reference outer queries");
+        auto has_nested_query = false;
+        visit(overloaded {
+            [](auto&) { },
+            [&has_nested_query](const ast::QueryExpr&) { has_nested_query = true; },
+        }, *binary->lhs, m::tag<ast::ConstPreOrderExprVisitor>());
+        if (has_nested_query)
+            throw m::invalid_argument("the left-hand side of IN must not contain nested queries");
+        condition.emplace_back(cnf::Clause({ cnf::Predicate::Positive(binary) }));
+    } else {
+        query = &as<const ast::QueryExpr>(*as<const ast::UnaryExpr>(*membership).expr);
+        kind = pred.negative() ? SemiJoin::SJ_Anti : SemiJoin::SJ_Semi;
+    }
+
+    if (graph_->sources().empty())
+        throw m::invalid_argument("EXISTS and IN require the query to have a FROM clause");
+
+    /*----- Build the graph of the nested query. -----*/
+    auto &stmt = as<const ast::SelectStmt>(*query->query);
+    GraphBuilder B;
+    B(stmt);
+    auto &nested = *B.graph_;
+
+    /*----- Lift the correlated clauses of the nested query into the condition. -----*/
+    std::vector<std::reference_wrapper<const ast::Designator>> correlated_designators;
+    for (auto &[clause, CI] : B.deferred_clauses_) {
+        if (CI.binding_depth != 1)
+            throw m::invalid_argument("nested queries of EXISTS and IN may only reference the directly enclosing "
+                                      "query");
+        for (auto &p : clause) {
+            visit(overloaded {
+                [](auto&) { },
+                [&correlated_designators](const ast::Designator &D) {
+                    if (D.binding_depth() == 0 and not D.is_identifier())
+                        correlated_designators.emplace_back(D);
+                },
+            }, *p, m::tag<ast::ConstPreOrderExprVisitor>());
+        }
+        condition.emplace_back(clause);
+    }
+    if (not B.deferred_clauses_.empty()) {
+        if (B.needs_grouping_)
+            throw m::invalid_argument("correlated nested queries of EXISTS and IN must not use grouping");
+        if (nested.limit().limit or nested.limit().offset)
+            throw m::invalid_argument("correlated nested queries of EXISTS and IN must not use LIMIT");
+    }
+
+    /*----- Provide the value compared by `IN` as `$res` and all attributes referenced by the condition. -----*/
+    if (binary) {
+        M_insist(nested.projections_.size() == 1, "nested query of IN must return a single column");
+        nested.projections_.front().second = C.pool("$res");
+    }
+    for (auto D : correlated_designators) {
+        auto is_projected = [D](const QueryGraph::projection_type &p) {
+            return not p.second and p.first.get() == D.get();
+        };
+        if (std::none_of(nested.projections_.begin(), nested.projections_.end(), is_projected))
+            nested.projections_.emplace_back(D.get(), nullptr);
+    }
+
+    graph_->semi_joins_.emplace_back(std::make_unique<SemiJoin>(kind, query->alias(), B.get(), std::move(condition)));
+}
 
 /** Returns `true` iff both designators has the same textual representation. */
 bool equal(const ast::Designator &one, const ast::Designator &two) {
@@ -1657,8 +1771,15 @@ void m::GraphBuilder::operator()(const ast::SelectStmt &stmt) {
         auto cnf_where = cnf::to_CNF(*WHERE.where);
 
         /*----- Analyze all CNF clauses of the WHERE clause. -----*/
-        for (auto &clause : cnf_where)
-            process_selection(clause);
+        for (auto &clause : cnf_where) {
+            if (clause.size() == 1 and get_membership(clause[0])) {
+                process_membership(clause[0]);
+            } else {
+                if (contains_membership(clause))
+                    throw m::invalid_argument("EXISTS and IN are only supported as conjuncts of the WHERE clause");
+                process_selection(clause);
+            }
+        }
 
         /*----- Introduce additional grouping keys. -----*/
         for (auto e : additional_grouping_keys_) {
@@ -1952,6 +2073,8 @@ void QueryGraph::dot_recursive(std::ostream &out) const
         if (auto q = cast<Query>(ds.get()))
             q->query_graph().dot_recursive(out);
     }
+    for (auto &sj : semi_joins())
+        sj->query_graph().dot_recursive(out);
 
     out << "\n  subgraph cluster_" << this << " {\n";
 
@@ -1973,6 +2096,16 @@ void QueryGraph::dot_recursive(std::ostream &out) const
             out << "    " << id(*j) << " -- " << id(ds.get()) << ";\n";
     }
 
+    for (auto &sj : semi_joins()) {
+        out << "    " << id(*sj) << " [label=<<B>" << (sj->is_anti() ? "▷" : "⋉") << ' ' << sj->alias() << "</B>";
+        if (sj->condition().size())
+            out << "<BR/><FONT COLOR=\"0.0 0.0 0.25\" POINT-SIZE=\"10\">"
+                << html_escape(to_string(sj->condition()))
+                << "</FONT>";
+        out << ">,style=filled,fillcolor=\"0.0 0.0 0.95\"];\n";
+        out << "  " << id(*sj) << " -- \"cluster_" << &sj->query_graph() << "\";\n";
+    }
+
     out << "    label=<"
         << "<TABLE BORDER=\"0\" CELLPADDING=\"0\" CELLSPACING=\"0\">\n";
 
@@ -2088,6 +2221,22 @@ void QueryGraph::dump(std::ostream &out) const
         }
     }
 
+    /*----- Print semi-joins. ----------------------------------------------------------------------------------------*/
+    if (not semi_joins().empty()) {
+        out << "\n  semi-joins:";
+        for (auto &sj : semi_joins()) {
+            out << "\n    ";
+            switch (sj->kind()) {
+                case SemiJoin::SJ_Semi:             out << "SEMI ";           break;
+                case SemiJoin::SJ_Anti:             out << "ANTI ";           break;
+                case SemiJoin::SJ_NullAwareAnti:    out << "NULL-AWARE ANTI "; break;
+            }
+            out << "(...) AS " << sj->alias();
+            if (not sj->condition().empty())
+                out << " ON " << sj->condition();
+        }
+    }
+
     /*----- Print grouping and aggregation information.  -------------------------------------------------------------*/
     if (group_by().empty() and aggregates().empty()) {
         out << "\n  no grouping";
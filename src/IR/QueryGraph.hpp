@@ -76,6 +76,7 @@ struct GraphBuilder : ast::ConstASTCommandVisitor
     void operator()(Const<ast::CreateDatabaseStmt>&) { M_unreachable("not implemented"); }
     void operator()(Const<ast::UseDatabaseStmt>&) { M_unreachable("not implemented"); }
     void operator()(Const<ast::CreateTableStmt>&) { M_unreachable("not implemented"); }
+    void operator()(Const<ast::CreateIndexStmt>&) { M_unreachable("not implemented"); }
     void operator()(Const<ast::SelectStmt> &s);
     void operator()(Const<ast::InsertStmt>&) { M_unreachable("not implemented"); }
     void operator()(Const<ast::UpdateStmt>&) { M_unreachable("not implemented"); }
@@ -100,6 +101,11 @@ struct GraphBuilder : ast::ConstASTCommandVisitor
      *     the clause by introducing the bound expression as an additional grouping key to the query.
      */
     void process_selection(cnf::Clause &clause);
+
+    /** Turns the `EXISTS` or `IN` predicate \p pred into a `SemiJoin` of the query graph.  The nested query becomes the
+     * query graph of the `SemiJoin` and its clauses correlated with the current query become part of the condition of
+     * the `SemiJoin`.  Throws `m::invalid_argument` if the nested query cannot be decorrelated this way. */
+    void process_membership(const cnf::Predicate &pred);
 };
 
 }
@@ -55,9 +55,22 @@ void QueryGraph2SQL::translate(const QueryGraph &graph)
         where = where and ds->filter();
     for (auto &j : graph_->joins())
         where = where and j->condition();
-    if (not where.empty()) {
+    if (not where.empty() or not graph_->semi_joins().empty()) {
         out_ << " WHERE ";
-        (*this)(where);
+        if (graph_->semi_joins().empty()) {
+            (*this)(where);
+        } else {
+            if (not where.empty()) {
+                out_ << '(';
+                (*this)(where);
+                out_ << ") AND ";
+            }
+            for (auto it = graph_->semi_joins().begin(); it != graph_->semi_joins().end(); ++it) {
+                if (it != graph_->semi_joins().begin())
+                    out_ << " AND ";
+                translate_semi_join(**it);
+            }
+        }
     }
 
     if (not graph_->group_by().empty()) {
@@ -129,6 +142,31 @@ void QueryGraph2SQL::translate_projection(const std::pair<std::reference_wrapper
     }
 }
 
+void QueryGraph2SQL::translate_semi_join(const SemiJoin &sj)
+{
+    if (sj.is_anti())
+        out_ << "NOT ";
+    out_ << "EXISTS (SELECT * FROM (";
+    QueryGraph2SQL trans(out_);
+    trans.translate(sj.query_graph());
+    out_ << ") AS " << sj.alias();
+    if (not sj.condition().empty()) {
+        out_ << " WHERE ";
+        for (auto it = sj.condition().begin(); it != sj.condition().end(); ++it) {
+            if (it != sj.condition().begin())
+                out_ << " AND ";
+            out_ << '(';
+            (*this)(*it);
+            /* A tuple of the nested query violates `NOT IN` if the `IN` predicate is `TRUE` *or* `NULL`. */
+            if (auto binary = cast<const ast::BinaryExpr>(&(*it)[0].expr());
+                sj.kind() == SemiJoin::SJ_NullAwareAnti and binary and binary->op() == TK_In)
+                out_ << " IS NOT FALSE";
+            out_ << ')';
+        }
+    }
+    out_ << ')';
+}
+
 const char * QueryGraph2SQL::make_unique_alias()
 {
     static uint64_t id(0);
@@ -180,7 +218,7 @@ void QueryGraph2SQL::operator()(Const<ast::FnApplicationExpr> &e)
 void QueryGraph2SQL::operator()(Const<ast::UnaryExpr> &e)
 {
     out_ << '(' << e.op().text;
-    if (e.op() == TK_Not) out_ << ' ';
+    if (e.op() == TK_Not or e.op() == TK_Exists) out_ << ' ';
     (*this)(*e.expr);
     out_ << ')';
 }
@@ -189,7 +227,8 @@ void QueryGraph2SQL::operator()(Const<ast::BinaryExpr> &e)
 {
     out_ << '(';
     (*this)(*e.lhs);
-    out_ << ' ' << e.op().text << ' ';
+    /* An `IN` predicate occurs only in the condition of a `SemiJoin`, where it compares with each `$res` in turn. */
+    out_ << ' ' << (e.op() == TK_In ? "=" : e.op().text) << ' ';
     (*this)(*e.rhs);
     out_ << ')';
 }
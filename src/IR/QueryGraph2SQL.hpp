@@ -8,6 +8,7 @@
 namespace m {
 
 struct QueryGraph;
+struct SemiJoin;
 
 /** Translates a query graph in SQL. */
 struct QueryGraph2SQL : private ast::ConstASTExprVisitor
@@ -36,6 +37,8 @@ struct QueryGraph2SQL : private ast::ConstASTExprVisitor
     /** Translates a projection for the given pair of `Expr` and alias. Adds an alias iff none is specified and the
      * expression has to be renamed, e.g. due to a multiple use of `.` in mu*t*able which is not valid in SQL. */
     void translate_projection(std::pair<std::reference_wrapper<const ast::Expr>, const char*>);
+    /** Translates the given `SemiJoin` into an `EXISTS` or `NOT EXISTS` predicate on its nested query. */
+    void translate_semi_join(const SemiJoin&);
 
     /** Checks whether the given target references an expression contained in the group_by clause. */
     bool references_group_by(ast::Designator::target_type);
@@ -0,0 +1,64 @@
+#include <mutable/IR/ResultBatch.hpp>
+
+#include <mutable/catalog/Schema.hpp>
+#include <mutable/storage/DataLayout.hpp>
+
+
+using namespace m;
+using namespace m::storage;
+
+
+ResultBatch ResultBatch::Make(const DataLayout &layout, const Schema &schema, const void *address,
+                              std::size_t num_tuples)
+{
+    const auto base_address = reinterpret_cast<const uint8_t*>(address);
+    auto make_column = [&](const DataLayout::leaf_info_t &leaf_info, uint64_t inode_offset_in_bits) -> column_t {
+        const uint64_t offset_in_bits = inode_offset_in_bits + leaf_info.offset_in_bits;
+        return column_t{
+            .type = leaf_info.leaf.type(),
+            .data = base_address + offset_in_bits / 8,
+            .bit_offset = uint8_t(offset_in_bits % 8),
+            .stride_in_bits = leaf_info.stride_in_bits,
+        };
+    };
+
+    std::vector<column_t> columns(schema.num_entries());
+    column_t null_bitmap{ nullptr, nullptr, 0, 0 };
+    layout.for_sibling_leaves([&](const std::vector<DataLayout::leaf_info_t> &leaves,
+                                  const DataLayout::level_info_stack_t &levels, uint64_t inode_offset_in_bits)
+    {
+        M_insist(not levels.empty() and num_tuples <= levels.back().num_tuples,
+                 "tuples must be contained in a single block of the data layout");
+        M_insist(inode_offset_in_bits == 0, "columns must be contained in the first block of the data layout");
+        for (auto &leaf_info : leaves) {
+            if (leaf_info.leaf.index() == schema.num_entries())
+                null_bitmap = make_column(leaf_info, inode_offset_in_bits);
+            else
+                columns[leaf_info.leaf.index()] = make_column(leaf_info, inode_offset_in_bits);
+        }
+    });
+    M_insist(not schema.num_entries() or null_bitmap.data, "data layout must contain a NULL bitmap");
+
+    return ResultBatch(num_tuples, std::move(columns), null_bitmap);
+}
+
+ResultBatch ResultBatch::slice(std::size_t first, std::size_t num_tuples) const
+{
+    M_insist(first + num_tuples <= num_tuples_, "slice must be contained in this batch");
+    auto advance = [first](const column_t &c) -> column_t {
+        if (not c.data) return c; // e.g. the NULL bitmap of a batch without columns
+        const uint64_t offset_in_bits = c.bit_offset + first * c.stride_in_bits;
+        return column_t{
+            .type = c.type,
+            .data = c.data + offset_in_bits / 8,
+            .bit_offset = uint8_t(offset_in_bits % 8),
+            .stride_in_bits = c.stride_in_bits,
+        };
+    };
+
+    std::vector<column_t> columns;
+    columns.reserve(columns_.size());
+    for (auto &c : columns_)
+        columns.push_back(advance(c));
+    return ResultBatch(num_tuples, std::move(columns), advance(null_bitmap_));
+}
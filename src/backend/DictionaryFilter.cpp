@@ -0,0 +1,104 @@
+#include "backend/DictionaryFilter.hpp"
+
+#include "backend/StackMachine.hpp"
+#include <algorithm>
+#include <cstring>
+#include <mutable/catalog/Schema.hpp>
+#include <mutable/IR/Tuple.hpp>
+#include <mutable/storage/Dictionary.hpp>
+
+
+using namespace m;
+using namespace m::ast;
+
+
+namespace {
+
+/** Returns the single attribute referenced by \p clause if it is a dictionary encoded attribute of \p table and \p
+ * clause references no other attributes and contains no nested queries, and `nullptr` otherwise. */
+const Attribute * dictionary_filtered_attribute(const cnf::Clause &clause, const Table &table)
+{
+    const Attribute *attr = nullptr;
+    bool is_filtered = true;
+    for (auto &pred : clause) {
+        visit(overloaded {
+            [&](const Designator &d) {
+                auto target = std::get_if<const Attribute*>(&d.target());
+                if (not target or (attr and attr != *target))
+                    is_filtered = false;
+                else
+                    attr = *target;
+            },
+            [&](const QueryExpr&) { is_filtered = false; },
+            [](auto&&) { /* nothing to be done */ },
+        }, pred.expr(), tag<ConstPreOrderExprVisitor>());
+    }
+    if (not is_filtered or not attr or &attr->table != &table or not attr->dictionary)
+        return nullptr;
+    return attr;
+}
+
+}
+
+std::vector<const Attribute*> m::dictionary_filtered_attributes(const cnf::CNF &filter, const Table &table)
+{
+    std::vector<const Attribute*> attrs;
+    for (auto &clause : filter) {
+        auto attr = dictionary_filtered_attribute(clause, table);
+        if (attr and std::find(attrs.begin(), attrs.end(), attr) == attrs.end())
+            attrs.push_back(attr);
+    }
+    return attrs;
+}
+
+std::vector<uint8_t> m::qualifying_codes(const cnf::CNF &filter, const Attribute &attr)
+{
+    M_insist(bool(attr.dictionary), "attribute must be dictionary encoded");
+    auto &dictionary = *attr.dictionary;
+
+    /*----- Collect the clauses referencing only `attr`. -----*/
+    cnf::CNF clauses;
+    for (auto &clause : filter) {
+        if (dictionary_filtered_attribute(clause, attr.table) == &attr)
+            clauses.push_back(clause);
+    }
+    M_insist(not clauses.empty(), "no clause references only the given attribute");
+
+    /*----- Compile the clauses for a tuple of only the attribute's value. -----*/
+    const Schema schema = clauses.get_required();
+    M_insist(schema.num_entries() == 1, "clauses must reference exactly one attribute");
+    StackMachine SM(schema);
+    SM.emit(clauses, 1);
+    SM.emit_St_Tup_b(0, 0);
+
+    /*----- Evaluate the clauses once per dictionary entry. -----*/
+    Tuple res({ Type::Get_Boolean(Type::TY_Vector) });
+    Tuple value(schema);
+    char *buffer = reinterpret_cast<char*>(value[0].as_p());
+    std::vector<uint8_t> qualifies(dictionary.size() + 1);
+    auto evaluate = [&]() -> uint8_t {
+        Tuple *args[] = { &res, &value };
+        SM(args);
+        return not res.is_null(0) and res[0].as_b();
+    };
+    value.null(0);
+    qualifies[0] = evaluate();
+    for (std::size_t code = 0; code != dictionary.size(); ++code) {
+        /* Copy the entry s.t. it is NUL-terminated, as `CHAR(N)` entries of length N are not. */
+        strncpy(buffer, dictionary.decode(code), dictionary.type().length);
+        buffer[dictionary.type().length] = 0;
+        value.not_null(0);
+        qualifies[code + 1] = evaluate();
+    }
+    return qualifies;
+}
+
+cnf::CNF m::residual_of_dictionary_filters(const cnf::CNF &filter, const Table &table)
+{
+    cnf::CNF residual;
+    for (auto &clause : filter) {
+        if (not dictionary_filtered_attribute(clause, table))
+            residual.push_back(clause);
+    }
+    return residual;
+}
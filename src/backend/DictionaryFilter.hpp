@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <mutable/IR/CNF.hpp>
+#include <vector>
+
+
+namespace m {
+
+/*----- forward declarations -----------------------------------------------------------------------------------------*/
+struct Attribute;
+struct Table;
+
+/** Returns the dictionary encoded attributes of \p table that are the only attribute referenced by some clause of \p
+ * filter.  Such a clause depends only on the code of the attribute and can hence be evaluated once per entry of the
+ * attribute's `Dictionary` rather than once per row. */
+std::vector<const Attribute*> dictionary_filtered_attributes(const cnf::CNF &filter, const Table &table);
+
+/** Evaluates all clauses of \p filter that reference only the dictionary encoded attribute \p attr once for each entry
+ * of the attribute's `Dictionary` and once for NULL.  Returns a vector of `size() + 1` elements, where the first element
+ * tells whether NULL satisfies all these clauses and the element at index `c + 1` tells whether the string of code `c`
+ * does, i.e.\ `1` if it does and `0` otherwise.  Hence, the outcome decides these clauses exactly.  Evaluates the
+ * constants of \p filter, including placeholders bound by the current thread, and hence must be called upon each
+ * execution. */
+std::vector<uint8_t> qualifying_codes(const cnf::CNF &filter, const Attribute &attr);
+
+/** Returns the clauses of \p filter that are *not* decided by `qualifying_codes()` for any of the
+ * `dictionary_filtered_attributes()` of \p table, i.e.\ the clauses that must still be evaluated per row after the rows
+ * of a scan of \p table have been pruned by the codes of their dictionary encoded attributes. */
+cnf::CNF residual_of_dictionary_filters(const cnf::CNF &filter, const Table &table);
+
+}
@@ -1,5 +1,8 @@
 #include "backend/Interpreter.hpp"
 
+#include "backend/DictionaryFilter.hpp"
+#include "backend/Sargable.hpp"
+#include "storage/AttributeReader.hpp"
 #include "util/container/RefCountingHashMap.hpp"
 #include <algorithm>
 #include <cerrno>
@@ -7,9 +10,13 @@
 #include <iterator>
 #include <mutable/Options.hpp>
 #include <mutable/parse/AST.hpp>
+#include <mutable/storage/DataLayoutFactory.hpp>
+#include <mutable/storage/ZoneMap.hpp>
 #include <mutable/util/fn.hpp>
 #include <numeric>
+#include <optional>
 #include <type_traits>
+#include <unordered_set>
 
 
 using namespace m;
@@ -301,9 +308,25 @@ static StackMachine compile_data_layout(const Schema &tuple_schema, void *addres
                                 SM.emit_Upd_Ctx(offset_id);
                                 SM.emit_Pop();
                             } else {
+                                /* A dictionary encoded leaf stores codes, which are encoded when storing and decoded to
+                                 * the addresses of their strings when loading.  A compressed leaf stores the differences
+                                 * of the values to its frame of reference. */
+                                const std::size_t dictionary_id = child_leaf->dictionary()
+                                    ? SM.add(reinterpret_cast<void*>(child_leaf->dictionary()))
+                                    : -1UL;
+                                const std::size_t reference_id = child_leaf->reference()
+                                    ? SM.add(*child_leaf->reference())
+                                    : -1UL;
+
                                 if constexpr (IsStore) {
                                     /* Load value to stack. */
                                     SM.emit_Ld_Tup(tuple_id, idx);
+                                    if (child_leaf->dictionary())
+                                        SM.emit_Dict_Encode(dictionary_id);
+                                    if (child_leaf->reference()) {
+                                        SM.emit_Ld_Ctx(reference_id);
+                                        SM.emit_Sub_i();
+                                    }
 
                                     /* Store value. */
                                     if (child_leaf->type()->is_boolean())
@@ -316,12 +339,18 @@ static StackMachine compile_data_layout(const Schema &tuple_schema, void *addres
                                         SM.emit_Ld_b(0x1UL << bit_offset); // convert the fixed bit offset to a fixed mask
                                     else
                                         SM.emit_Ld(child_leaf->type());
+                                    if (child_leaf->dictionary())
+                                        SM.emit_Dict_Decode(dictionary_id);
+                                    if (child_leaf->reference()) {
+                                        SM.emit_Ld_Ctx(reference_id);
+                                        SM.emit_Add_i();
+                                    }
 
                                     if (attr_can_be_null)
                                         SM.emit_Sel();
 
                                     /* Store value in output tuple. */
-                                    SM.emit_St_Tup(tuple_id, idx, child_leaf->type());
+                                    SM.emit_St_Tup(tuple_id, idx, layout_schema[child_leaf->index()].type);
                                     SM.emit_Pop();
                                 }
 
@@ -558,6 +587,55 @@ StackMachine Interpreter::compile_store(const Schema &tuple_schema, void *addres
 
 namespace {
 
+/** Collects the tuples passed to a batched `CallbackOperator` in a single PAX block and passes the block as
+ * `ResultBatch` to the callback whenever it is full and after the last tuple. */
+struct CallbackData : OperatorData
+{
+    const Schema tuple_schema; ///< the schema of the tuples passed to the operator
+    const Schema batch_schema; ///< the schema of the batch, i.e.\ without constants and duplicates
+    const std::size_t batch_size; ///< the number of tuples per batch
+    storage::DataLayout layout; ///< the layout of the block of the batch
+    std::unique_ptr<uint8_t[]> block; ///< the memory of the block of the batch
+    std::optional<StackMachine> writer; ///< stores tuples into the block, starting at the first tuple
+    std::size_t num_tuples = 0; ///< the number of tuples in the current batch
+
+    CallbackData(const CallbackOperator &op)
+        : tuple_schema(op.schema())
+        , batch_schema(op.schema().drop_constants().deduplicate())
+        , batch_size(op.batch_size())
+    {
+        if (batch_schema.num_entries()) {
+            layout = storage::PAXLayoutFactory(storage::PAXLayoutFactory::NTuples, batch_size)
+                .make(batch_schema, batch_size);
+            block = std::make_unique<uint8_t[]>((layout.stride_in_bits() + 7) / 8);
+        }
+    }
+
+    /** Appends \p tup to the current batch and passes the batch to the callback of \p op if it is full. */
+    void append(const CallbackOperator &op, Tuple &tup) {
+        if (batch_schema.num_entries()) {
+            if (not writer)
+                writer.emplace(Interpreter::compile_store(tuple_schema, block.get(), layout, batch_schema));
+            Tuple *args[] = { &tup };
+            (*writer)(args);
+        }
+        if (++num_tuples == batch_size)
+            flush(op);
+    }
+
+    /** Passes the current batch, if not empty, to the callback of \p op and starts a new batch. */
+    void flush(const CallbackOperator &op) {
+        if (num_tuples == 0)
+            return;
+        if (batch_schema.num_entries())
+            op.batch_callback()(batch_schema, ResultBatch::Make(layout, batch_schema, block.get(), num_tuples));
+        else
+            op.batch_callback()(batch_schema, ResultBatch(num_tuples, {}, { nullptr, nullptr, 0, 0 }));
+        writer.reset(); // to store the next batch from its first tuple
+        num_tuples = 0;
+    }
+};
+
 struct PrintData : OperatorData
 {
     uint32_t num_rows = 0;
@@ -717,6 +795,151 @@ struct SimpleHashJoinData : JoinData
             probe_key.emit_St_Tup(0, i, expr->type()); // write result to index i
         }
     }
+
+    /** Returns `true` iff `key` contains NULL, i.e. iff the tuple of `key` cannot have a join partner. */
+    bool has_null() const {
+        for (std::size_t i = 0; i != key_schema.num_entries(); ++i) {
+            if (key.is_null(i))
+                return true;
+        }
+        return false;
+    }
+};
+
+/** Returns the pairs of build side and probe side expressions of the predicate of the semi-join or anti-join \p op iff
+ * the predicate can be evaluated by hashing, i.e.\ iff each clause is a single positive `=` or `IN` predicate comparing
+ * expressions of equal, non-string type of both sides, and `std::nullopt` otherwise.  A null-aware anti-join is only
+ * evaluated by hashing if its predicate is a single `IN` predicate. */
+std::optional<std::vector<std::pair<const ast::Expr*, const ast::Expr*>>> semi_join_keys(const JoinOperator &op)
+{
+    M_insist(op.is_semi_or_anti());
+    auto &schema_build = op.child(0)->schema();
+    auto &schema_probe = op.child(1)->schema();
+    auto belongs_to = [](const ast::Expr &expr, const Schema &schema) {
+        auto required = expr.get_required();
+        return required.num_entries() != 0 and (required & schema).num_entries() == required.num_entries();
+    };
+
+    std::vector<std::pair<const ast::Expr*, const ast::Expr*>> exprs;
+    for (auto &clause : op.predicate()) {
+        if (clause.size() != 1 or clause[0].negative())
+            return std::nullopt;
+        auto binary = cast<const ast::BinaryExpr>(&clause[0].expr());
+        if (not binary or (binary->tok != TK_EQUAL and binary->tok != TK_In))
+            return std::nullopt;
+        if (op.kind() == JoinOperator::J_NullAwareAnti and (binary->tok != TK_In or op.predicate().size() != 1))
+            return std::nullopt;
+        auto lhs = binary->lhs.get();
+        auto rhs = binary->rhs.get();
+        if (lhs->type() != rhs->type() or lhs->type()->is_character_sequence())
+            return std::nullopt; // keys are compared bitwise
+        if (belongs_to(*lhs, schema_build) and belongs_to(*rhs, schema_probe))
+            exprs.emplace_back(lhs, rhs);
+        else if (belongs_to(*rhs, schema_build) and belongs_to(*lhs, schema_probe))
+            exprs.emplace_back(rhs, lhs);
+        else
+            return std::nullopt;
+    }
+    if (exprs.empty())
+        return std::nullopt;
+    return exprs;
+}
+
+/** Evaluates a semi-join or anti-join by collecting the distinct keys of the build side in a hash set.  Since only the
+ * keys are kept, each probe tuple is looked up exactly once and produced at most once, regardless of how many build
+ * tuples match it. */
+struct SimpleHashSemiJoinData : OperatorData
+{
+    bool is_probe_phase = false; ///< determines whether tuples are used to *build* or *probe* the hash set
+    std::vector<std::pair<const ast::Expr*, const ast::Expr*>> exprs; ///< build and probe side of each comparison
+    std::optional<StackMachine> build_key; ///< extracts the key of the build input
+    std::optional<StackMachine> probe_key; ///< extracts the key of the probe input
+    std::unordered_set<Tuple> keys; ///< the distinct keys of the build input without NULL
+    bool build_is_empty = true; ///< whether the build input is empty
+    bool build_has_null = false; ///< whether some key of the build input contains NULL
+
+    Schema key_schema; ///< the `Schema` of the `key`
+    Tuple key; ///< `Tuple` to hold the key
+
+    SimpleHashSemiJoinData(std::vector<std::pair<const ast::Expr*, const ast::Expr*>> exprs)
+        : exprs(std::move(exprs))
+    {
+        for (auto [build, _] : this->exprs)
+            key_schema.add("key", build->type());
+        key = Tuple(key_schema);
+    }
+
+    void emit_key(std::optional<StackMachine> &SM, const Schema &pipeline_schema, bool is_build) {
+        SM.emplace(pipeline_schema);
+        for (std::size_t i = 0; i != exprs.size(); ++i) {
+            const ast::Expr *expr = is_build ? exprs[i].first : exprs[i].second;
+            SM->emit(*expr, 1); // compile expr
+            SM->emit_St_Tup(0, i, expr->type()); // write result to index i
+        }
+    }
+
+    /** Returns `true` iff \p key contains NULL. */
+    bool has_null() const {
+        for (std::size_t i = 0; i != key_schema.num_entries(); ++i) {
+            if (key.is_null(i))
+                return true;
+        }
+        return false;
+    }
+};
+
+/** Evaluates a semi-join or anti-join by materializing the build side and evaluating the predicate for each probe tuple
+ * with the buffered tuples until the first match. */
+struct NestedLoopsSemiJoinData : OperatorData
+{
+    bool is_probe_phase = false; ///< determines whether tuples are used to *build* or *probe*
+    std::vector<Tuple> buffer; ///< the tuples of the build input
+    std::vector<Schema> schemas; ///< the schemas of the build and the probe input
+    ///> evaluates the clauses of the predicate to a bool, except the `IN` clauses of a null-aware anti-join
+    std::optional<StackMachine> predicate;
+    ///> evaluates the `IN` clauses of a null-aware anti-join, which are matched if `TRUE` *or* `NULL`
+    std::optional<StackMachine> in_predicate;
+    Tuple res;
+
+    NestedLoopsSemiJoinData() : res({ Type::Get_Boolean(Type::TY_Vector) }) { }
+
+    void emit_predicates(const JoinOperator &op) {
+        cnf::CNF clauses, in_clauses;
+        for (auto &clause : op.predicate()) {
+            auto binary = cast<const ast::BinaryExpr>(&clause[0].expr());
+            if (op.kind() == JoinOperator::J_NullAwareAnti and binary and binary->tok == TK_In)
+                in_clauses.push_back(clause);
+            else
+                clauses.push_back(clause);
+        }
+        std::vector<std::size_t> tuple_ids{ 1, 2 };
+        if (not clauses.empty()) {
+            predicate.emplace();
+            predicate->emit(clauses, schemas, tuple_ids);
+            predicate->emit_St_Tup_b(0, 0);
+        }
+        if (not in_clauses.empty()) {
+            in_predicate.emplace();
+            in_predicate->emit(in_clauses, schemas, tuple_ids);
+            in_predicate->emit_St_Tup_b(0, 0);
+        }
+    }
+
+    /** Returns `true` iff the build tuple \p build matches the probe tuple \p probe. */
+    bool matches(Tuple &build, Tuple &probe) {
+        Tuple *args[] = { &res, &build, &probe };
+        if (predicate) {
+            (*predicate)(args);
+            if (res.is_null(0) or not res[0].as_b())
+                return false;
+        }
+        if (in_predicate) {
+            (*in_predicate)(args);
+            if (not res.is_null(0) and not res[0].as_b())
+                return false;
+        }
+        return true;
+    }
 };
 
 struct LimitData : OperatorData
@@ -854,16 +1077,29 @@ struct SortingData : OperatorData
     SortingData(Schema buffer_schema) : pipeline(std::move(buffer_schema)) { }
 };
 
+/** Returns the clauses of \p op that remain to be evaluated per tuple.  If \p op is directly above a scan, the scan
+ * already discards the tuples not satisfying the clauses decided by dictionary codes, see `Pipeline::operator()(const
+ * ScanOperator&)`. */
+cnf::CNF residual_filter(const FilterOperator &op)
+{
+    if (auto scan = cast<const ScanOperator>(op.child(0)))
+        return residual_of_dictionary_filters(op.filter(), scan->store().table());
+    return op.filter();
+}
+
 struct FilterData : OperatorData
 {
     StackMachine filter;
     Tuple res;
+    bool is_trivial; ///< whether all clauses are already decided by the scan below, s.t. every tuple qualifies
 
     FilterData(const FilterOperator &op, const Schema &pipeline_schema)
         : filter(pipeline_schema)
         , res({ Type::Get_Boolean(Type::TY_Vector) })
     {
-        filter.emit(op.filter(), 1);
+        auto residual = residual_filter(op);
+        is_trivial = residual.empty();
+        filter.emit(residual, 1);
         filter.emit_St_Tup_b(0, 0);
     }
 };
@@ -872,9 +1108,11 @@ struct DisjunctiveFilterData : OperatorData
 {
     std::vector<StackMachine> predicates;
     Tuple res;
+    bool is_trivial; ///< whether the clause is already decided by the scan below, s.t. every tuple qualifies
 
     DisjunctiveFilterData(const DisjunctiveFilterOperator &op, const Schema &pipeline_schema)
         : res({ Type::Get_Boolean(Type::TY_Vector) })
+        , is_trivial(residual_filter(op).empty())
     {
         auto clause = op.filter()[0];
         for (cnf::Predicate &pred : clause) {
@@ -899,37 +1137,98 @@ void Pipeline::operator()(const ScanOperator &op)
     auto &store = op.store();
     auto &table = store.table();
     const auto num_rows = store.num_rows();
+    auto filter = cast<const FilterOperator>(op.parent());
 
-    /* Compile StackMachine to load tuples from store. */
-    auto loader = Interpreter::compile_load(op.schema(), store.memory().addr(), table.layout(), table.schema());
-
-    const auto remainder = num_rows % block_.capacity();
-    std::size_t i = 0;
-    /* Fill entire vector. */
-    for (auto end = num_rows - remainder; i != end; i += block_.capacity()) {
-        block_.clear();
-        block_.fill();
-        for (std::size_t j = 0; j != block_.capacity(); ++j) {
-            Tuple *args[] = { &block_[j] };
-            loader(args);
-        }
-        op.parent()->accept(*this);
+    /* If the filter directly above this scan has clauses that reference only a dictionary encoded attribute, evaluate
+     * them once per dictionary entry and NULL and discard the rows whose codes do not qualify right after loading them.
+     * The filter then only evaluates the remaining clauses, see `residual_of_dictionary_filters()`. */
+    struct code_filter_t
+    {
+        storage::AttributeReader reader; ///< reads the codes of the attribute
+        std::vector<uint8_t> qualifies; ///< whether NULL and each code qualify, see `qualifying_codes()`
+    };
+    std::vector<code_filter_t> code_filters;
+    if (filter) {
+        for (auto attr : dictionary_filtered_attributes(filter->filter(), table))
+            code_filters.push_back({ storage::AttributeReader(*attr), qualifying_codes(filter->filter(), *attr) });
     }
-    if (i != num_rows) {
-        /* Fill last vector with remaining tuples. */
-        block_.clear();
-        block_.mask((1UL << remainder) - 1);
-        for (std::size_t j = 0; i != op.store().num_rows(); ++i, ++j) {
-            M_insist(j < block_.capacity());
-            Tuple *args[] = { &block_[j] };
-            loader(args);
+    auto discard_unqualified_codes = [&](std::size_t first_row_id) {
+        for (auto it = block_.begin(); it != block_.end(); ++it) {
+            const auto row_id = first_row_id + it.index();
+            for (auto &code_filter : code_filters) {
+                const auto idx = code_filter.reader.is_null(row_id) ? 0 : code_filter.reader.read(row_id) + 1;
+                if (not code_filter.qualifies[idx]) {
+                    block_.erase(it);
+                    break;
+                }
+            }
         }
-        op.parent()->accept(*this);
+    };
+
+    /* Scans the rows in [begin, end), filling entire vectors and the last vector with the remaining tuples. */
+    auto scan_rows = [&](std::size_t begin, std::size_t end) {
+        /* Compile StackMachine to load tuples from store, starting at row `begin`. */
+        auto loader = Interpreter::compile_load(op.schema(), store.memory().addr(), table.layout(), table.schema(),
+                                                begin);
+
+        const auto remainder = (end - begin) % block_.capacity();
+        std::size_t i = begin;
+        /* Fill entire vector. */
+        for (auto block_end = end - remainder; i != block_end; i += block_.capacity()) {
+            block_.clear();
+            block_.fill();
+            for (std::size_t j = 0; j != block_.capacity(); ++j) {
+                Tuple *args[] = { &block_[j] };
+                loader(args);
+            }
+            discard_unqualified_codes(i);
+            if (not block_.empty())
+                op.parent()->accept(*this);
+        }
+        if (i != end) {
+            /* Fill last vector with remaining tuples. */
+            const auto first_row_id = i;
+            block_.clear();
+            block_.mask((1UL << remainder) - 1);
+            for (std::size_t j = 0; i != end; ++i, ++j) {
+                M_insist(j < block_.capacity());
+                Tuple *args[] = { &block_[j] };
+                loader(args);
+            }
+            discard_unqualified_codes(first_row_id);
+            if (not block_.empty())
+                op.parent()->accept(*this);
+        }
+    };
+
+    /* If the filter directly above this scan is prunable by the table's zone map, scan only the runs of consecutive
+     * zones that may contain qualifying rows. */
+    if (filter and is_prunable_by_zone_map(filter->filter(), table)) {
+        const auto qualifies = qualifying_zones(filter->filter(), table);
+        const auto zone_size = store.zone_map().zone_size();
+        for (std::size_t zone = 0; zone != qualifies.size(); ) {
+            if (not qualifies[zone]) {
+                ++zone;
+                continue;
+            }
+            const auto run_begin = zone;
+            while (zone != qualifies.size() and qualifies[zone])
+                ++zone;
+            scan_rows(run_begin * zone_size, std::min(zone * zone_size, num_rows));
+        }
+    } else {
+        scan_rows(0, num_rows);
     }
 }
 
 void Pipeline::operator()(const CallbackOperator &op)
 {
+    if (op.is_batched()) {
+        auto data = as<CallbackData>(op.data());
+        for (auto &t : block_)
+            data->append(op, t);
+        return;
+    }
     for (auto &t : block_)
         op.callback()(op.schema(), t);
 }
@@ -956,6 +1255,10 @@ void Pipeline::operator()(const FilterOperator &op)
         op.data(new FilterData(op, this->schema()));
 
     auto data = as<FilterData>(op.data());
+    if (data->is_trivial) {
+        op.parent()->accept(*this);
+        return;
+    }
     for (auto it = block_.begin(); it != block_.end(); ++it) {
         Tuple *args[] = { &data->res, &*it };
         data->filter(args);
@@ -971,6 +1274,10 @@ void Pipeline::operator()(const DisjunctiveFilterOperator &op)
         op.data(new DisjunctiveFilterData(op, this->schema()));
 
     auto data = as<DisjunctiveFilterData>(op.data());
+    if (data->is_trivial) {
+        op.parent()->accept(*this);
+        return;
+    }
     for (auto it = block_.begin(); it != block_.end(); ++it) {
         data->res.set(0, false); // reset
         Tuple *args[] = { &data->res, &*it };
@@ -989,7 +1296,78 @@ satisfied:;
 
 void Pipeline::operator()(const JoinOperator &op)
 {
-    if (is<SimpleHashJoinData>(op.data())) {
+    if (is<SimpleHashSemiJoinData>(op.data())) {
+        /* Perform simple hash semi-join or anti-join. */
+        auto data = as<SimpleHashSemiJoinData>(op.data());
+        Tuple *args[2] = { &data->key, nullptr };
+        if (data->is_probe_phase) {
+            if (not data->probe_key)
+                data->emit_key(data->probe_key, this->schema(), false);
+            for (auto it = block_.begin(); it != block_.end(); ++it) {
+                args[1] = &*it;
+                (*data->probe_key)(args);
+                bool qualifies;
+                if (data->has_null()) {
+                    /* A comparison with NULL never matches, but a null-aware anti-join produces the tuple only if the
+                     * build input is empty. */
+                    qualifies = op.kind() == JoinOperator::J_Anti or data->build_is_empty;
+                } else {
+                    const bool found = data->keys.find(data->key) != data->keys.end();
+                    switch (op.kind()) {
+                        case JoinOperator::J_Inner:         M_unreachable("not a semi-join");
+                        case JoinOperator::J_Semi:          qualifies = found; break;
+                        case JoinOperator::J_Anti:          qualifies = not found; break;
+                        case JoinOperator::J_NullAwareAnti: qualifies = not found and not data->build_has_null; break;
+                    }
+                }
+                if (not qualifies)
+                    block_.erase(it);
+            }
+            if (not block_.empty())
+                op.parent()->accept(*this);
+        } else {
+            if (not data->build_key)
+                data->emit_key(data->build_key, this->schema(), true);
+            for (auto &t : block_) {
+                args[1] = &t;
+                (*data->build_key)(args);
+                data->build_is_empty = false;
+                if (data->has_null())
+                    data->build_has_null = true; // can never match; only relevant for null-aware anti-joins
+                else
+                    data->keys.emplace(data->key.clone(data->key_schema));
+            }
+        }
+    } else if (is<NestedLoopsSemiJoinData>(op.data())) {
+        /* Perform nested-loops semi-join or anti-join. */
+        auto data = as<NestedLoopsSemiJoinData>(op.data());
+        if (data->is_probe_phase) {
+            if (not data->buffer.empty() and data->schemas.size() != 2) {
+                M_insist(data->schemas.size() == 1);
+                data->schemas.emplace_back(this->schema());
+                data->emit_predicates(op);
+            }
+            for (auto it = block_.begin(); it != block_.end(); ++it) {
+                bool matched = false;
+                for (auto &build : data->buffer) {
+                    if (data->matches(build, *it)) {
+                        matched = true;
+                        break; // the first match decides
+                    }
+                }
+                if (matched == op.is_anti())
+                    block_.erase(it);
+            }
+            if (not block_.empty())
+                op.parent()->accept(*this);
+        } else {
+            if (data->schemas.empty())
+                data->schemas.emplace_back(this->schema()); // save the schema of the build pipeline
+            const auto &tuple_schema = op.child(0)->schema();
+            for (auto &t : block_)
+                data->buffer.emplace_back(t.clone(tuple_schema));
+        }
+    } else if (is<SimpleHashJoinData>(op.data())) {
         /* Perform simple hash join. */
         auto data = as<SimpleHashJoinData>(op.data());
         Tuple *args[2] = { &data->key, nullptr };
@@ -1003,6 +1381,7 @@ void Pipeline::operator()(const JoinOperator &op)
             for (auto &t : block_) {
                 args[1] = &t;
                 data->probe_key(args);
+                if (data->has_null()) continue; // NULL is not equal to any key
                 pipeline.block_.fill();
                 data->ht.for_all(*args[0], [&](std::pair<const Tuple, Tuple> &v) {
                     if (i == pipeline.block_.capacity()) {
@@ -1036,6 +1415,7 @@ void Pipeline::operator()(const JoinOperator &op)
             for (auto &t : block_) {
                 args[1] = &t;
                 data->build_key(args);
+                if (data->has_null()) continue; // NULL is not equal to any key
                 data->ht.insert_with_duplicates(args[0]->clone(data->key_schema), t.clone(tuple_schema));
             }
         }
@@ -1409,6 +1789,12 @@ void Pipeline::operator()(const SortingOperator &op)
 
 void Interpreter::operator()(const CallbackOperator &op)
 {
+    if (op.is_batched()) {
+        op.data(new CallbackData(op));
+        op.child(0)->accept(*this);
+        as<CallbackData>(op.data())->flush(op); // pass the last, partial batch
+        return;
+    }
     op.child(0)->accept(*this);
 }
 
@@ -1445,7 +1831,27 @@ void Interpreter::operator()(const DisjunctiveFilterOperator &op)
 
 void Interpreter::operator()(const JoinOperator &op)
 {
-    if (op.predicate().is_equi()) {
+    if (op.is_semi_or_anti()) {
+        if (auto exprs = semi_join_keys(op)) {
+            /* Perform simple hash semi-join or anti-join. */
+            auto data = new SimpleHashSemiJoinData(std::move(*exprs));
+            op.data(data);
+            op.child(0)->accept(*this); // build hash set on LHS
+            if (op.kind() == JoinOperator::J_Semi and data->build_is_empty) // no tuple can match
+                return;
+            data->is_probe_phase = true;
+            op.child(1)->accept(*this); // probe hash set with RHS
+        } else {
+            /* Perform nested-loops semi-join or anti-join. */
+            auto data = new NestedLoopsSemiJoinData();
+            op.data(data);
+            op.child(0)->accept(*this);
+            if (op.kind() == JoinOperator::J_Semi and data->buffer.empty()) // no tuple can match
+                return;
+            data->is_probe_phase = true;
+            op.child(1)->accept(*this);
+        }
+    } else if (op.predicate().is_equi()) {
         /* Perform simple hash join. */
         auto data = new SimpleHashJoinData(op);
         op.data(data);
@@ -1592,11 +1998,46 @@ void Interpreter::operator()(const SortingOperator &op)
 
     StackMachine comparator(data->pipeline.schema());
     for (auto o : orderings) {
-        comparator.emit(o.first.get(), 1); // LHS
-        comparator.emit(o.first.get(), 2); // RHS
+        auto ty = o.first.get().type();
+
+        if (o.first.get().can_be_null()) {
+            /* Order NULL first regardless of the sort direction, as `wasm::compare()` does. */
+            comparator.emit(o.first.get(), 2); // RHS
+            comparator.emit_Is_Null();
+            comparator.emit_Cast_i_b();
+            comparator.emit(o.first.get(), 1); // LHS
+            comparator.emit_Is_Null();
+            comparator.emit_Cast_i_b();
+            comparator.emit_Sub_i();
+            comparator.emit_St_Tup_i(0, 0);
+            comparator.emit_Stop_NZ();
+
+            /* Either both or none are NULL.  Replace NULL by a constant s.t. two NULLs compare equal. */
+            const Value null_replacement = visit(overloaded {
+                [](const Boolean&) -> Value { return false; },
+                [](const CharacterSequence&) -> Value { return ""; },
+                [](const Numeric &n) -> Value {
+                    if (n.kind == Numeric::N_Float)
+                        return n.size() <= 32 ? Value(0.f) : Value(0.);
+                    return int64_t(0);
+                },
+                [](const Date&) -> Value { return int64_t(0); },
+                [](const DateTime&) -> Value { return int64_t(0); },
+                [](auto&&) -> Value { M_unreachable("invalid type"); }
+            }, *ty);
+            for (std::size_t tuple_id : { 1, 2 }) { // LHS, RHS
+                comparator.emit(o.first.get(), tuple_id);
+                comparator.emit_Is_Null();
+                comparator.add_and_emit_load(null_replacement);
+                comparator.emit(o.first.get(), tuple_id);
+                comparator.emit_Sel();
+            }
+        } else {
+            comparator.emit(o.first.get(), 1); // LHS
+            comparator.emit(o.first.get(), 2); // RHS
+        }
 
         /* Emit comparison. */
-        auto ty = o.first.get().type();
         visit(overloaded {
             [&comparator](const Boolean&) { comparator.emit_Cmp_b(); },
             [&comparator](const CharacterSequence&) { comparator.emit_Cmp_s(); },
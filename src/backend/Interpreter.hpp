@@ -213,9 +213,22 @@ struct Pipeline : ConstOperatorVisitor
 /** Evaluates SQL operator trees on the database. */
 struct Interpreter : Backend, ConstOperatorVisitor
 {
+    using parameters_t = std::vector<std::pair<const PrimitiveType*, Value>>;
+
+    private:
+    ///> the types and values bound to the placeholders `?` of the statement that is currently executed by this thread
+    static inline thread_local parameters_t parameters_;
+
     public:
     Interpreter() = default;
 
+    /** Binds the placeholders `?` of the statement that is currently executed by this thread to the types and values
+     * in \p parameters, indexed by `ast::Constant::placeholder_index()`. */
+    static void Bind_Parameters(parameters_t parameters) { parameters_ = std::move(parameters); }
+    /** Returns the types and values bound to the placeholders `?` of the statement that is currently executed by this
+     * thread. */
+    static const parameters_t & Bound_Parameters() { return parameters_; }
+
     void execute(const Operator &plan) const override { (*const_cast<Interpreter*>(this))(plan); }
 
     using ConstOperatorVisitor::operator();
@@ -233,6 +246,13 @@ struct Interpreter : Backend, ConstOperatorVisitor
             case TK_Null:
                 M_unreachable("NULL cannot be evaluated to a Value");
 
+            /* Placeholder */
+            case TK_QMARK: {
+                const auto idx = c.placeholder_index();
+                M_insist(idx < parameters_.size(), "no value bound to placeholder");
+                return parameters_[idx].second;
+            }
+
             /* Integer */
             case TK_OCT_INT:
                 return int64_t(strtoll(c.tok.text, nullptr, 8));
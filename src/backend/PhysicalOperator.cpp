@@ -3,12 +3,75 @@
 #include "backend/WasmDSL.hpp"
 #include "backend/WasmMacro.hpp"
 #include "backend/WasmUtil.hpp"
+#include <algorithm>
+#include <sstream>
+#include <string_view>
 
 
 using namespace m;
 using namespace m::wasm;
 
 
+void MatchBase::execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const
+{
+    auto &context = CodeGenContext::Get();
+    if (not context.instrumented() or not pipeline) {
+        auto parent = context.current_match(this);
+        execute_impl(std::move(setup), std::move(pipeline), std::move(teardown));
+        context.current_match(parent);
+        return;
+    }
+
+    /* The pipeline is code of the parent, hence count the tuples passed to it and attribute events within it to the
+     * parent. */
+    auto parent = context.current_match(this);
+    execute_impl(
+        std::move(setup),
+        [this, parent, pipeline=std::move(pipeline)](){
+            auto &context = CodeGenContext::Get();
+            if (auto &env = context.env(); env.predicated()) {
+                context.count_event(*this, "tuples", num_qualifying_tuples(env.get_predicate()).to<uint64_t>());
+            } else {
+                context.count_event(*this, "tuples", U64x1(context.num_simd_lanes()));
+            }
+            auto child = context.current_match(parent);
+            pipeline();
+            context.current_match(child);
+        },
+        std::move(teardown)
+    );
+    context.current_match(parent);
+}
+
+void MatchBase::add_counter(const char *event, uint64_t n) const
+{
+    auto it = std::find_if(counters_.begin(), counters_.end(), [event](const auto &p) {
+        return std::string_view(p.first) == event;
+    });
+    if (it == counters_.end())
+        counters_.emplace_back(event, n);
+    else
+        it->second += n;
+}
+
+std::string MatchBase::statistics() const
+{
+    std::ostringstream oss;
+    oss << "cumulative cost " << cost();
+    if (counters_.empty())
+        return oss.str();
+
+    if (root_ and root_->has_info())
+        oss << ", estimated cardinality " << root_->info().estimated_cardinality;
+    for (auto &[event, n] : counters_) {
+        if (std::string_view(event) == "tuples")
+            oss << ", actual cardinality " << n;
+        else
+            oss << ", " << n << ' ' << event;
+    }
+    return oss.str();
+}
+
 void PhysicalOptimizer::execute(const Operator &plan) const
 {
     /* Emit code for run function which computes the last pipeline and calls other pipeline functions. */
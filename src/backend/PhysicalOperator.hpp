@@ -4,6 +4,7 @@
 #include <limits>
 #include <mutable/IR/Condition.hpp>
 #include <mutable/IR/Operator.hpp>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -166,14 +167,24 @@ struct MatchBase
 
     private:
     double cost_ = std::numeric_limits<double>::infinity();
+    ///> the root of the logical operators covered by this match
+    const Operator *root_ = nullptr;
+    ///> the events of this match counted by instrumented code, e.g. produced tuples, and their numbers of occurrences
+    mutable std::vector<std::pair<const char*, uint64_t>> counters_;
 
     public:
     virtual ~MatchBase() { }
-    virtual void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const = 0;
+    /** Executes this match given three callbacks: `setup` for some initializations, `pipeline` for the actual
+     * computation, and `teardown` for post-processing.  If instrumentation is enabled, additionally counts the
+     * tuples produced by this match, i.e. passed to `pipeline`. */
+    void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const;
     virtual std::string name() const = 0;
 
     double cost() const { return cost_; }
 
+    /** Adds \p n to the number of occurrences of \p event of this match. */
+    void add_counter(const char *event, uint64_t n) const;
+
     friend std::ostream & operator<<(std::ostream &out, const MatchBase &M) {
         M.print(out);
         return out;
@@ -185,6 +196,12 @@ struct MatchBase
         return out;
     }
     virtual void print(std::ostream &out, unsigned level = 0) const = 0;
+    /** Returns the cumulative cost of this match and, if counted by instrumented code, its estimated and actual
+     * cardinality as well as all other counted events. */
+    std::string statistics() const;
+
+    /** Emits the code of this match, see `execute()`. */
+    virtual void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const = 0;
 
     private:
     void cost(double new_cost) { cost_ = new_cost; }
@@ -295,6 +312,7 @@ struct PhysicalOptimizer : ConstPostOrderOperatorVisitor
         for (const auto &child : children)
             cost += child.get().second.cost;
         match->cost(cost);
+        match->root_ = &op;
 
         if (cost < phys_op_cost_) { // XXX: this should be removed because of possible multiple post conditions
             /* Compute post-condition. */
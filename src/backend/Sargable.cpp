@@ -0,0 +1,151 @@
+#include "backend/Sargable.hpp"
+
+#include "backend/Interpreter.hpp"
+#include <limits>
+#include <mutable/catalog/Schema.hpp>
+#include <mutable/storage/Store.hpp>
+#include <mutable/storage/ZoneMap.hpp>
+#include <unordered_map>
+
+
+using namespace m;
+using namespace m::ast;
+
+
+std::optional<sargable_comparison_t> m::sargable_comparison(const cnf::Predicate &pred)
+{
+    auto binary = cast<const BinaryExpr>(&pred.expr());
+    if (not binary)
+        return std::nullopt;
+
+    /*----- Normalize the comparison to the form `attr op constant`. -----*/
+    auto designator = cast<const Designator>(binary->lhs.get());
+    auto constant = cast<const Constant>(binary->rhs.get());
+    bool mirrored = false;
+    if (not designator or not constant) {
+        designator = cast<const Designator>(binary->rhs.get());
+        constant = cast<const Constant>(binary->lhs.get());
+        mirrored = true;
+    }
+    if (not designator or not constant or constant->is_null())
+        return std::nullopt;
+    auto target = std::get_if<const Attribute*>(&designator->target());
+    if (not target)
+        return std::nullopt;
+    const Attribute &attr = **target;
+
+    /*----- The constant must be of the same type category as the attribute s.t. both compare by their integral
+     * representation. -----*/
+    const Type &attr_type = *attr.type;
+    const Type &constant_type = *constant->type();
+    const bool is_same_category = (attr_type.is_integral() and constant_type.is_integral()) or
+                                  (attr_type.is_date() and constant_type.is_date()) or
+                                  (attr_type.is_date_time() and constant_type.is_date_time());
+    if (not is_same_category)
+        return std::nullopt;
+
+    TokenType op = binary->op().type;
+    if (mirrored) {
+        switch (op) {
+            default:                 break;
+            case TK_LESS:            op = TK_GREATER;       break;
+            case TK_LESS_EQUAL:      op = TK_GREATER_EQUAL; break;
+            case TK_GREATER:         op = TK_LESS;          break;
+            case TK_GREATER_EQUAL:   op = TK_LESS_EQUAL;    break;
+        }
+    }
+    if (pred.negative()) {
+        switch (op) {
+            default:                 return std::nullopt;
+            case TK_BANG_EQUAL:      op = TK_EQUAL;         break;
+            case TK_LESS:            op = TK_GREATER_EQUAL; break;
+            case TK_LESS_EQUAL:      op = TK_GREATER;       break;
+            case TK_GREATER:         op = TK_LESS_EQUAL;    break;
+            case TK_GREATER_EQUAL:   op = TK_LESS;          break;
+        }
+    }
+    switch (op) {
+        default:
+            return std::nullopt;
+        case TK_EQUAL:
+        case TK_LESS:
+        case TK_LESS_EQUAL:
+        case TK_GREATER:
+        case TK_GREATER_EQUAL:
+            return sargable_comparison_t{ attr, op, *constant };
+    }
+}
+
+void m::restrict_range(int64_t &lower, int64_t &upper, TokenType op, int64_t key)
+{
+    switch (op) {
+        default: M_unreachable("invalid sargable comparison");
+        case TK_EQUAL:
+            lower = std::max(lower, key);
+            upper = std::min(upper, key);
+            break;
+        case TK_LESS:
+            if (key == std::numeric_limits<int64_t>::lowest())
+                upper = std::numeric_limits<int64_t>::lowest(), lower = upper + 1; // empty
+            else
+                upper = std::min(upper, key - 1);
+            break;
+        case TK_LESS_EQUAL:
+            upper = std::min(upper, key);
+            break;
+        case TK_GREATER:
+            if (key == std::numeric_limits<int64_t>::max())
+                lower = std::numeric_limits<int64_t>::max(), upper = lower - 1; // empty
+            else
+                lower = std::max(lower, key + 1);
+            break;
+        case TK_GREATER_EQUAL:
+            lower = std::max(lower, key);
+            break;
+    }
+}
+
+bool m::is_prunable_by_zone_map(const cnf::CNF &filter, const Table &table)
+{
+    if (table.layout().is_finite())
+        return false; // zones are only defined for infinite data layouts
+    for (auto &clause : filter) {
+        if (clause.size() != 1)
+            continue;
+        if (auto cmp = sargable_comparison(clause[0]);
+            cmp and &cmp->attr.table == &table and ZoneMap::Is_Summarized(*cmp->attr.type))
+            return true;
+    }
+    return false;
+}
+
+std::vector<bool> m::qualifying_zones(const cnf::CNF &filter, const Table &table)
+{
+    M_insist(is_prunable_by_zone_map(filter, table));
+
+    /*----- Compute the range of qualifying values of each attribute compared by a sargable clause. -----*/
+    std::unordered_map<const Attribute*, std::pair<int64_t, int64_t>> ranges;
+    for (auto &clause : filter) {
+        if (clause.size() != 1)
+            continue;
+        auto cmp = sargable_comparison(clause[0]);
+        if (not cmp or &cmp->attr.table != &table or not ZoneMap::Is_Summarized(*cmp->attr.type))
+            continue;
+        auto [it, _] = ranges.try_emplace(&cmp->attr, std::numeric_limits<int64_t>::lowest(),
+                                          std::numeric_limits<int64_t>::max());
+        restrict_range(it->second.first, it->second.second, cmp->op, Interpreter::eval(cmp->constant).as_i());
+    }
+
+    /*----- A zone qualifies iff it may contain a value of each range. -----*/
+    auto &zone_map = table.store().zone_map();
+    std::vector<bool> qualifies(zone_map.num_zones(), true);
+    for (std::size_t zone = 0; zone != zone_map.num_zones(); ++zone) {
+        for (auto &[attr, range] : ranges) {
+            if (not zone_map.may_contain(*attr, zone, range.first, range.second)) {
+                qualifies[zone] = false;
+                break;
+            }
+        }
+    }
+    return qualifies;
+}
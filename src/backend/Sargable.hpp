@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <mutable/IR/CNF.hpp>
+#include <mutable/lex/TokenType.hpp>
+#include <optional>
+#include <vector>
+
+
+namespace m {
+
+/*----- forward declarations -----------------------------------------------------------------------------------------*/
+struct Attribute;
+struct Table;
+
+/** A comparison `attr op constant` of an attribute of integral, `Date`, or `DateTime` type with a constant of the same
+ * type category. */
+struct sargable_comparison_t
+{
+    const Attribute &attr; ///< the compared attribute
+    TokenType op; ///< one of `TK_EQUAL`, `TK_LESS`, `TK_LESS_EQUAL`, `TK_GREATER`, and `TK_GREATER_EQUAL`
+    const ast::Constant &constant; ///< the constant the attribute is compared with; may be a placeholder
+};
+
+/** Returns the comparison of an attribute with a constant expressed by \p pred, normalized s.t. the attribute is the
+ * left-hand side and the comparison is positive, or `std::nullopt` if \p pred is not such a comparison. */
+std::optional<sargable_comparison_t> sargable_comparison(const cnf::Predicate &pred);
+
+/** Narrows the closed interval [\p lower, \p upper] s.t. all its values additionally satisfy `op key`, where \p op is
+ * one of the operators of a `sargable_comparison_t`.  If no value satisfies the comparison, the interval becomes
+ * empty, i.e.\ \p lower exceeds \p upper. */
+void restrict_range(int64_t &lower, int64_t &upper, TokenType op, int64_t key);
+
+/** Returns `true` iff the `ZoneMap` of \p table can prune zones for the filter \p filter directly above a scan of \p
+ * table, i.e.\ iff \p table has an infinite data layout and \p filter has a clause that is a single sargable
+ * comparison of a summarized attribute. */
+bool is_prunable_by_zone_map(const cnf::CNF &filter, const Table &table);
+
+/** Returns for each zone of the `ZoneMap` of \p table whether it may contain rows satisfying \p filter.  Requires \p
+ * filter to be prunable by the zone map.  Evaluates the constants of \p filter, including placeholders bound by the
+ * current thread, and hence must be called upon each execution. */
+std::vector<bool> qualifying_zones(const cnf::CNF &filter, const Table &table);
+
+}
@@ -3,6 +3,7 @@
 #include "backend/Interpreter.hpp"
 #include <ctime>
 #include <functional>
+#include <mutable/storage/Dictionary.hpp>
 #include <mutable/util/fn.hpp>
 #include <regex>
 
@@ -303,7 +304,8 @@ void StackMachineBuilder::operator()(Const<ast::BinaryExpr> &e)
         case TK_GREATER:        opname = "GT";    break;
         case TK_LESS_EQUAL:     opname = "LE";    break;
         case TK_GREATER_EQUAL:  opname = "GE";    break;
-        case TK_EQUAL:          opname = "Eq";    break;
+        case TK_EQUAL:
+        case TK_In:             opname = "Eq";    break; // within a semi-join, `IN` compares with a single value
         case TK_BANG_EQUAL:     opname = "NE";    break;
         case TK_Like:           opname = "Like";  break;
 
@@ -453,6 +455,7 @@ void StackMachineBuilder::operator()(Const<ast::BinaryExpr> &e)
         case TK_LESS_EQUAL:
         case TK_GREATER_EQUAL:
         case TK_EQUAL:
+        case TK_In:
         case TK_BANG_EQUAL:
             if (ty_lhs->is_numeric()) {
                 M_insist(ty_rhs->is_numeric());
@@ -1199,26 +1202,60 @@ NEXT;
 
 #undef STORE
 
+/*----- Dictionary encoding ------------------------------------------------------------------------------------------*/
+
+Dict_Encode: {
+    M_insist(top_ >= 1);
+    std::size_t idx = static_cast<std::size_t>(*op_++);
+    M_insist(idx < context_.size(), "index out of bounds");
+    if (TOP_IS_NULL) NEXT; // NULL is not encoded, the NULL bit is stored separately
+    auto dict = reinterpret_cast<Dictionary*>(context_[idx].as_p());
+    TOP = int64_t(dict->encode(reinterpret_cast<char*>(TOP.as_p())));
+}
+NEXT;
+
+Dict_Decode: {
+    M_insist(top_ >= 1);
+    std::size_t idx = static_cast<std::size_t>(*op_++);
+    M_insist(idx < context_.size(), "index out of bounds");
+    if (TOP_IS_NULL) NEXT;
+    auto dict = reinterpret_cast<const Dictionary*>(context_[idx].as_p());
+    /* Compute the address without bounds check, since the code of a NULL value is unspecified and its address is
+     * discarded afterwards. */
+    const auto code = Dictionary::code_type(TOP.as_i());
+    TOP = reinterpret_cast<void*>(dict->memory().as<char*>() + code * dict->entry_size());
+}
+NEXT;
+
 
 /*======================================================================================================================
  * Arithmetical operations
  *====================================================================================================================*/
 
+/* The value of a NULL operand is not of the operand type, e.g. when pushed by `Push_Null`, and must not be read.  A
+ * NULL operand makes the result NULL. */
 #define UNARY(OP, TYPE) { \
     M_insist(top_ >= 1); \
-    TYPE val = TOP.as<TYPE>(); \
-    TOP = OP(val); \
+    if (not TOP_IS_NULL) { \
+        TYPE val = TOP.as<TYPE>(); \
+        TOP = OP(val); \
+    } \
 } \
 NEXT;
 
 #define BINARY(OP, TYPE) { \
     M_insist(top_ >= 2); \
-    TYPE rhs = TOP.as<TYPE>(); \
     bool is_rhs_null = TOP_IS_NULL; \
+    TYPE rhs{}; \
+    if (not is_rhs_null) rhs = TOP.as<TYPE>(); \
     POP(); \
-    TYPE lhs = TOP.as<TYPE>(); \
-    TOP = OP(lhs, rhs); \
-    TOP_IS_NULL = TOP_IS_NULL or is_rhs_null; \
+    if (TOP_IS_NULL or is_rhs_null) { \
+        TOP = decltype(OP(rhs, rhs)){}; \
+        TOP_IS_NULL = true; \
+    } else { \
+        TYPE lhs = TOP.as<TYPE>(); \
+        TOP = OP(lhs, rhs); \
+    } \
 } \
 NEXT;
 
@@ -1354,11 +1391,11 @@ Not_b: UNARY(not, bool);
 /* Logical and with three-valued logic (https://en.wikipedia.org/wiki/Three-valued_logic#Kleene_and_Priest_logics). */
 And_b: {
     M_insist(top_ >= 2);
-    bool rhs = TOP.as<bool>();
     bool is_rhs_null = TOP_IS_NULL;
+    bool rhs = not is_rhs_null and TOP.as<bool>();
     POP();
-    bool lhs = TOP.as<bool>();
     bool is_lhs_null = TOP_IS_NULL;
+    bool lhs = not is_lhs_null and TOP.as<bool>();
     TOP = lhs and rhs;
     TOP_IS_NULL = (lhs or is_lhs_null) and (rhs or is_rhs_null) and (is_lhs_null or is_rhs_null);
 }
@@ -1367,11 +1404,11 @@ NEXT;
 /* Logical or with three-valued logic (https://en.wikipedia.org/wiki/Three-valued_logic#Kleene_and_Priest_logics). */
 Or_b: {
     M_insist(top_ >= 2);
-    bool rhs = TOP.as<bool>();
     bool is_rhs_null = TOP_IS_NULL;
+    bool rhs = not is_rhs_null and TOP.as<bool>();
     POP();
-    bool lhs = TOP.as<bool>();
     bool is_lhs_null = TOP_IS_NULL;
+    bool lhs = not is_lhs_null and TOP.as<bool>();
     TOP = lhs or rhs;
     TOP_IS_NULL = (not lhs or is_lhs_null) and (not rhs or is_rhs_null) and (is_lhs_null or is_rhs_null);
 }
@@ -1430,11 +1467,11 @@ GE_s: BINARY(0 <= strcmp, char*);
 
 #define CMP(TYPE) { \
     M_insist(top_ >= 2); \
-    TYPE rhs = TOP.as<TYPE>(); \
     bool is_rhs_null = TOP_IS_NULL; \
+    TYPE rhs = is_rhs_null ? TYPE() : TOP.as<TYPE>(); \
     POP(); \
-    TYPE lhs = TOP.as<TYPE>(); \
     bool is_lhs_null = TOP_IS_NULL; \
+    TYPE lhs = is_lhs_null ? TYPE() : TOP.as<TYPE>(); \
     TOP = int64_t(lhs >= rhs) - int64_t(lhs <= rhs); \
     TOP_IS_NULL = is_lhs_null or is_rhs_null; \
 } \
@@ -1595,6 +1632,8 @@ void StackMachine::dump(std::ostream &out) const
             case Opcode::Ld_b:
             case Opcode::St_s:
             case Opcode::St_b:
+            case Opcode::Dict_Encode:
+            case Opcode::Dict_Decode:
                 ++i;
                 out << ' ' << static_cast<int64_t>(ops[i]);
                 /* fall through */
@@ -1,23 +1,29 @@
 #include "backend/V8Engine.hpp"
 
+#include "backend/DictionaryFilter.hpp"
 #include "backend/Interpreter.hpp"
 #include "backend/PhysicalOperator.hpp"
+#include "backend/Sargable.hpp"
 #include "backend/WasmOperator.hpp"
 #include "backend/WasmUtil.hpp"
 #include "storage/Store.hpp"
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
+#include <filesystem>
 #include <fstream>
 #include <fstream>
+#include <iomanip>
 #include <libplatform/libplatform.h>
 #include <mutable/catalog/Catalog.hpp>
 #include <mutable/IR/Tuple.hpp>
 #include <mutable/Options.hpp>
 #include <mutable/storage/DataLayoutFactory.hpp>
 #include <mutable/storage/Store.hpp>
+#include <mutable/storage/ZoneMap.hpp>
 #include <mutable/util/DotTool.hpp>
 #include <mutable/util/enum_ops.hpp>
 #include <mutable/util/memory.hpp>
@@ -25,6 +31,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string_view>
+#include <unistd.h>
 #include <unordered_set>
 
 // must be included after Binaryen due to conflicts, e.g. with `::wasm::Throw`
@@ -52,9 +59,35 @@ bool wasm_dump = false;
 bool asm_dump = false;
 /** The port to use for the Chrome DevTools web socket. */
 uint16_t cdt_port = 0;
+/** Whether to cache compiled Wasm modules and reuse them for queries with equal physical plans. */
+bool wasm_compilation_cache = false;
+/** The directory of the on-disk cache of machine code for Wasm modules, if any. */
+const char *wasm_code_cache_dir = nullptr;
+/** Whether to count the tuples and events of each physical operator and print them with the physical plan.  Operators
+ * are not timed, see `CodeGenContext::instrumented()`. */
+bool wasm_explain_analyze = false;
+/** Whether to write a perf map file that names the generated Wasm functions for `perf`. */
+bool wasm_perf_map = false;
+/** Whether to write a jitdump file that contains the generated Wasm functions for `perf inject --jit`. */
+bool wasm_perf_jitdump = false;
 
 }
 
+/** Invokes a callback when leaving the scope, including when the scope is left by an exception, e.g. by the result
+ * callback cancelling the query. */
+template<typename Callback>
+struct scope_exit
+{
+    private:
+    Callback callback_;
+
+    public:
+    explicit scope_exit(Callback callback) : callback_(std::move(callback)) { }
+    scope_exit(const scope_exit&) = delete;
+    scope_exit & operator=(const scope_exit&) = delete;
+    ~scope_exit() { callback_(); }
+};
+
 
 /*======================================================================================================================
  * V8Engine
@@ -69,10 +102,41 @@ struct V8Engine : m::WasmEngine
     friend void register_WasmV8();
 
     private:
+    /** A Wasm module that was already compiled to machine code for a physical plan and that can be reused to execute
+     * any plan with the same fingerprint. */
+    struct CachedModule
+    {
+        ///> fingerprint of the layouts and sizes of all tables mapped into the module at the time of compilation
+        std::string tables_fingerprint;
+        ///> the compiled module, independent of any `v8::Context`
+        v8::CompiledWasmModule compiled_module;
+        ///> factory used to create the result set data layout, if any
+        std::unique_ptr<const storage::DataLayoutFactory> result_set_factory;
+        ///> filename, line, and an optional message for each emitted insist or exception throw
+        std::vector<std::tuple<const char*, unsigned, const char*>> messages;
+
+        CachedModule(std::string tables_fingerprint, v8::CompiledWasmModule compiled_module,
+                     std::unique_ptr<const storage::DataLayoutFactory> result_set_factory,
+                     std::vector<std::tuple<const char*, unsigned, const char*>> messages)
+            : tables_fingerprint(std::move(tables_fingerprint))
+            , compiled_module(std::move(compiled_module))
+            , result_set_factory(std::move(result_set_factory))
+            , messages(std::move(messages))
+        { }
+    };
+
     static inline v8::Platform *PLATFORM_ = nullptr;
     v8::ArrayBuffer::Allocator *allocator_ = nullptr;
     v8::Isolate *isolate_ = nullptr;
+    ///> the flags V8 was configured with; the machine code generated by V8 depends on them
+    std::string v8_flags_;
     PhysicalOptimizer phys_opt_;
+    ///> maps fingerprints of physical plans to their compiled Wasm modules
+    std::unordered_map<std::string, CachedModule> module_cache_;
+    ///> the context reused by all plans to instantiate and execute Wasm modules
+    v8::Global<v8::Context> context_;
+    ///> the time spent to create `context_`
+    Timer::duration context_setup_time_ = Timer::duration::zero();
 
     /*----- Objects for remote debugging via CDT. --------------------------------------------------------------------*/
     std::unique_ptr<V8InspectorClientImpl> inspector_;
@@ -92,6 +156,17 @@ struct V8Engine : m::WasmEngine
     void initialize();
     void compile(const m::Operator &plan) const override;
     void execute(const m::Operator &plan) override;
+
+    private:
+    /** Returns a canonical fingerprint of the logical plan \p plan and its physical operator covering.  Requires that
+     * a covering for \p plan was already computed. */
+    std::string plan_fingerprint(const m::Operator &plan) const;
+    /** Returns a canonical fingerprint of the layouts and sizes of all tables which are mapped into the Wasm module
+     * of \p plan, in the order in which they are mapped. */
+    static std::string tables_fingerprint(const m::Operator &plan);
+    /** Compiles the current `Module` to machine code.  Loads the machine code from the on-disk code cache in
+     * `options::wasm_code_cache_dir`, if present, and stores newly compiled machine code there otherwise. */
+    v8::Local<v8::WasmModuleObject> compile_wasm_module_with_code_cache();
 };
 
 
@@ -294,7 +369,7 @@ void m::wasm::detail::read_result_set(const v8::FunctionCallbackInfo<v8::Value>
 {
     auto &context = WasmEngine::Get_Wasm_Context_By_ID(Module::ID());
 
-    auto &schema = context.plan.schema();
+    auto &schema = context.plan->schema();
     auto deduplicated_schema = schema.deduplicate();
     auto deduplicated_schema_without_constants = deduplicated_schema.drop_constants();
 
@@ -332,7 +407,7 @@ void m::wasm::detail::read_result_set(const v8::FunctionCallbackInfo<v8::Value>
         };
         return find_projection_impl(op, find_projection_impl);
     };
-    auto &projections = find_projection(context.plan).projections();
+    auto &projections = find_projection(*context.plan).projections();
 
     ///> helper function to print given `ast::Constant` \p c of `Type` \p type to \p out
     auto print_constant = [](std::ostringstream &out, const ast::Constant &c, const Type *type){
@@ -387,9 +462,26 @@ void m::wasm::detail::read_result_set(const v8::FunctionCallbackInfo<v8::Value>
         }, *type);
     };
 
+    /* A batched callback consumes each window of the result set as a single batch of columns pointing into the linear
+     * memory.  A full window holds exactly the batch size, hence only the last batch may be smaller. */
+    if (auto callback_op = cast<const CallbackOperator>(context.plan); callback_op and callback_op->is_batched()) {
+        M_insist(num_tuples <= callback_op->batch_size(), "a window must not exceed the batch size");
+        if (deduplicated_schema_without_constants.num_entries() == 0) {
+            callback_op->batch_callback()(deduplicated_schema_without_constants,
+                                          ResultBatch(num_tuples, {}, { nullptr, nullptr, 0, 0 }));
+        } else {
+            M_insist(bool(context.result_set_factory), "result set factory must be set");
+            auto layout = context.result_set_factory->make(deduplicated_schema_without_constants);
+            callback_op->batch_callback()(deduplicated_schema_without_constants,
+                                          ResultBatch::Make(layout, deduplicated_schema_without_constants,
+                                                            result_set, num_tuples));
+        }
+        return;
+    }
+
     if (deduplicated_schema_without_constants.num_entries() == 0) {
         /* Schema contains only constants. Create simple loop to generate `num_tuples` constant result tuples. */
-        if (auto callback_op = cast<const CallbackOperator>(&context.plan)) {
+        if (auto callback_op = cast<const CallbackOperator>(context.plan)) {
             Tuple tup(schema); // tuple entries which are not set are implicitly NULL
             for (std::size_t i = 0; i < schema.num_entries(); ++i) {
                 auto &e = schema[i];
@@ -399,7 +491,7 @@ void m::wasm::detail::read_result_set(const v8::FunctionCallbackInfo<v8::Value>
             }
             for (std::size_t i = 0; i < num_tuples; ++i)
                 callback_op->callback()(schema, tup);
-        } else if (auto print_op = cast<const PrintOperator>(&context.plan)) {
+        } else if (auto print_op = cast<const PrintOperator>(context.plan)) {
             std::ostringstream tup;
             for (std::size_t i = 0; i < schema.num_entries(); ++i) {
                 auto &e = schema[i];
@@ -419,7 +511,7 @@ void m::wasm::detail::read_result_set(const v8::FunctionCallbackInfo<v8::Value>
     auto layout = context.result_set_factory->make(deduplicated_schema_without_constants);
 
     /* Extract results. */
-    if (auto callback_op = cast<const CallbackOperator>(&context.plan)) {
+    if (auto callback_op = cast<const CallbackOperator>(context.plan)) {
         auto loader = Interpreter::compile_load(deduplicated_schema_without_constants, result_set, layout,
                                                 deduplicated_schema_without_constants);
         if (schema.num_entries() == deduplicated_schema.num_entries()) {
@@ -468,7 +560,7 @@ void m::wasm::detail::read_result_set(const v8::FunctionCallbackInfo<v8::Value>
                 callback_op->callback()(schema, tup_dupl);
             }
         }
-    } else if (auto print_op = cast<const PrintOperator>(&context.plan)) {
+    } else if (auto print_op = cast<const PrintOperator>(context.plan)) {
         /* Compute a `Tuple` with duplicates and constants. */
         Tuple tup(deduplicated_schema_without_constants);
         Tuple *args[] = { &tup };
@@ -511,6 +603,84 @@ void m::wasm::detail::read_result_set(const v8::FunctionCallbackInfo<v8::Value>
 }
 
 
+void m::wasm::detail::index_lower_bound(const v8::FunctionCallbackInfo<v8::Value> &info)
+{
+    M_insist(info.Length() == 2);
+    auto index_id = info[0].As<v8::Uint32>()->Value();
+    auto key = info[1].As<v8::BigInt>()->Int64Value();
+
+    auto &index = Catalog::Get().get_database_in_use().get_index(index_id);
+    info.GetReturnValue().Set(uint32_t(index.lower_bound(key)));
+}
+
+void m::wasm::detail::index_upper_bound(const v8::FunctionCallbackInfo<v8::Value> &info)
+{
+    M_insist(info.Length() == 2);
+    auto index_id = info[0].As<v8::Uint32>()->Value();
+    auto key = info[1].As<v8::BigInt>()->Int64Value();
+
+    auto &index = Catalog::Get().get_database_in_use().get_index(index_id);
+    info.GetReturnValue().Set(uint32_t(index.upper_bound(key)));
+}
+
+void m::wasm::detail::index_row_ids(const v8::FunctionCallbackInfo<v8::Value> &info)
+{
+    M_insist(info.Length() == 4);
+    auto index_id = info[0].As<v8::Uint32>()->Value();
+    auto begin = info[1].As<v8::Uint32>()->Value();
+    auto end = info[2].As<v8::Uint32>()->Value();
+    auto row_ids_offset = info[3].As<v8::Uint32>()->Value();
+
+    auto &context = WasmEngine::Get_Wasm_Context_By_ID(Module::ID());
+    auto &index = Catalog::Get().get_database_in_use().get_index(index_id);
+    auto row_ids = reinterpret_cast<uint32_t*>(context.vm.as<uint8_t*>() + row_ids_offset);
+    index.row_ids(begin, end, row_ids);
+}
+
+void m::wasm::detail::qualifying_codes(const v8::FunctionCallbackInfo<v8::Value> &info)
+{
+    M_insist(info.Length() == 3);
+    auto scan_id = info[0].As<v8::Uint32>()->Value();
+    auto attr_id = info[1].As<v8::Uint32>()->Value();
+    auto qualifies_offset = info[2].As<v8::Uint32>()->Value();
+
+    auto &context = WasmEngine::Get_Wasm_Context_By_ID(Module::ID());
+    auto &qualifies = context.qualifying_codes(scan_id, attr_id);
+    std::copy(qualifies.begin(), qualifies.end(), context.vm.as<uint8_t*>() + qualifies_offset);
+}
+
+void m::wasm::detail::next_qualifying_row(const v8::FunctionCallbackInfo<v8::Value> &info)
+{
+    M_insist(info.Length() == 2);
+    auto scan_id = info[0].As<v8::Uint32>()->Value();
+    auto row_id = info[1].As<v8::Uint32>()->Value();
+
+    auto &context = WasmEngine::Get_Wasm_Context_By_ID(Module::ID());
+    info.GetReturnValue().Set(context.next_qualifying_row(scan_id, row_id));
+}
+
+void m::wasm::detail::end_of_qualifying_rows(const v8::FunctionCallbackInfo<v8::Value> &info)
+{
+    M_insist(info.Length() == 2);
+    auto scan_id = info[0].As<v8::Uint32>()->Value();
+    auto row_id = info[1].As<v8::Uint32>()->Value();
+
+    auto &context = WasmEngine::Get_Wasm_Context_By_ID(Module::ID());
+    info.GetReturnValue().Set(context.end_of_qualifying_rows(scan_id, row_id));
+}
+
+void m::wasm::detail::report_operator_counter(const v8::FunctionCallbackInfo<v8::Value> &info)
+{
+    M_insist(info.Length() == 2);
+    auto idx = info[0].As<v8::Uint32>()->Value();
+    auto n = info[1].As<v8::BigInt>()->Uint64Value();
+
+    auto &counters = CodeGenContext::Get().operator_counters();
+    M_insist(idx < counters.size(), "invalid counter index");
+    counters[idx].match->add_counter(counters[idx].event, n);
+}
+
+
 /*======================================================================================================================
  * V8Engine helper classes
  *====================================================================================================================*/
@@ -526,7 +696,12 @@ struct CollectStringLiterals : ConstOperatorVisitor, ast::ConstASTExprVisitor
     static std::vector<const char*> Collect(const Operator &plan) {
         CollectStringLiterals CSL;
         CSL(plan);
-        return std::vector<const char *>(CSL.literals_.begin(), CSL.literals_.end());
+        std::vector<const char *> literals(CSL.literals_.begin(), CSL.literals_.end());
+        /* Sort by contents s.t. equal plans always place their literals at the same addresses. */
+        std::sort(literals.begin(), literals.end(), [](const char *left, const char *right) {
+            return strcmp(left, right) < 0;
+        });
+        return literals;
     }
 
     private:
@@ -637,6 +812,7 @@ V8Engine::V8Engine()
 V8Engine::~V8Engine()
 {
     inspector_.reset();
+    context_.Reset();
     if (isolate_) {
         M_insist(allocator_);
         isolate_->Dispose();
@@ -682,11 +858,62 @@ void V8Engine::initialize()
               << "--no-wasm-stack-checks "
               << "--wasm-simd-ssse3-codegen ";
     }
-    v8::V8::SetFlagsFromString(flags.str().c_str());
+    if (options::wasm_perf_map)
+        flags << "--perf-basic-prof "; // write function names and addresses to /tmp/perf-<pid>.map
+    if (options::wasm_perf_jitdump)
+        flags << "--perf-prof "; // write function names and machine code to jit-<pid>.dump in the working directory
+    v8_flags_ = flags.str();
+    v8::V8::SetFlagsFromString(v8_flags_.c_str());
 
     v8::Isolate::CreateParams create_params;
     create_params.array_buffer_allocator = allocator_ = v8::ArrayBuffer::Allocator::NewDefaultAllocator();
     isolate_ = v8::Isolate::New(create_params);
+    isolate_->SetWasmStreamingCallback(compile_streaming); // required to compile from the on-disk code cache
+}
+
+std::string V8Engine::plan_fingerprint(const Operator &plan) const
+{
+    std::ostringstream oss;
+    oss << "optimization level " << options::wasm_optimization_level << '\n';
+
+    /* The logical plan contains all predicates, schemas, and estimated cardinalities, but omits the projected
+     * expressions, hence add them explicitly. */
+    oss << plan << '\n';
+    visit(overloaded {
+        [&oss](const ProjectionOperator &op) {
+            for (auto &p : op.projections()) {
+                oss << p.first.get();
+                if (p.second)
+                    oss << " AS " << p.second;
+                oss << ", ";
+            }
+            oss << '\n';
+        },
+        [](auto&&) { /* nothing to be done */ },
+    }, plan, tag<ConstPreOrderOperatorVisitor>());
+
+    /* The physical operator covering determines the emitted code. */
+    phys_opt_.dump_plan(plan, oss);
+
+    return oss.str();
+}
+
+std::string V8Engine::tables_fingerprint(const Operator &plan)
+{
+    /* The generated code depends on the data layouts of the tables and, since tables are mapped consecutively into
+     * the Wasm module's linear memory, on their mapping sizes which determine the addresses of string literals and
+     * pre-allocated memory.  Tables which are not accessed by the plan are not mapped and hence irrelevant. */
+    std::ostringstream oss;
+    const auto tables = accessed_tables(plan);
+    auto &DB = Catalog::Get().get_database_in_use();
+    for (auto it = DB.begin_tables(); it != DB.end_tables(); ++it) {
+        if (not tables.contains(it->second))
+            continue;
+        const Table &table = *it->second;
+        oss << table.name << " mapping " << WasmContext::Table_Mapping_Size(table) << " bytes\n"
+            << table.layout() << '\n';
+    }
+    return oss.str();
 }
 
 void V8Engine::compile(const Operator &plan) const
@@ -705,6 +932,11 @@ void V8Engine::compile(const Operator &plan) const
         /*----- Compile plan. ----------------------------------------------------------------------------------------*/
         phys_opt_.execute(plan); // emit code
 
+        /*----- Report the events counted by instrumented physical operators. ----------------------------------------*/
+        auto &counters = CodeGenContext::Get().operator_counters();
+        for (std::size_t idx = 0; idx != counters.size(); ++idx)
+            Module::Get().emit_call<void>("report_operator_counter", U32x1(uint32_t(idx)), counters[idx].value->val());
+
         /*----- Return size of result set. ---------------------------------------------------------------------------*/
         main.emit_return(CodeGenContext::Get().num_tuples());
     }
@@ -751,9 +983,22 @@ void V8Engine::execute(const Operator &plan)
 {
     Module::Init();
     CodeGenContext::Init(); // fresh context
+    scope_exit dispose([]() {
+        CodeGenContext::Dispose();
+        Module::Dispose();
+    });
+    CodeGenContext::Get().instrumented(options::wasm_explain_analyze);
 
     Catalog &C = Catalog::Get();
 
+    /* Index the rows appended to the accessed tables since their indexes were last used.  This must precede the
+     * physical optimization, which estimates the number of entries an index scan reads. */
+    auto &DB = C.get_database_in_use();
+    for (auto table : accessed_tables(plan)) {
+        for (auto index : DB.indexes_of(*table))
+            index->update();
+    }
+
     M_TIME_EXPR(phys_opt_.cover(plan), "Compute optimal physical operator covering", C.timer());
     if (Options::Get().physplan) phys_opt_.dump_plan(plan);
     if (Options::Get().physplandot) {
@@ -766,40 +1011,107 @@ void V8Engine::execute(const Operator &plan)
     M_insist(bool(isolate_), "must have an isolate");
     v8::Locker locker(isolate_);
     isolate_->Enter();
+    scope_exit exit_isolate([this]() { isolate_->Exit(); });
 
     {
         /* Create required V8 scopes. */
         v8::Isolate::Scope isolate_scope(isolate_);
         v8::HandleScope handle_scope(isolate_); // tracks and disposes of all object handles
 
-        /* Create global template and context. */
-        v8::Local<v8::ObjectTemplate> global = v8::ObjectTemplate::New(isolate_);
-        global->Set(isolate_, "set_wasm_instance_raw_memory", v8::FunctionTemplate::New(isolate_, set_wasm_instance_raw_memory));
-        global->Set(isolate_, "read_result_set", v8::FunctionTemplate::New(isolate_, read_result_set));
-        v8::Local<v8::Context> context = v8::Context::New(isolate_, /* extensions= */ nullptr, global);
+        /* Create global template and context.  Reuse the context of previous plans, unless the context is inspected
+         * by CDT. */
+        Timer::duration saved_setup_time = Timer::duration::zero();
+        const bool reuse_context = options::cdt_port < 1024;
+        if (context_.IsEmpty() or not reuse_context) {
+            const auto begin = Timer::clock::now();
+            v8::Local<v8::ObjectTemplate> global = v8::ObjectTemplate::New(isolate_);
+            global->Set(isolate_, "set_wasm_instance_raw_memory", v8::FunctionTemplate::New(isolate_, set_wasm_instance_raw_memory));
+            global->Set(isolate_, "read_result_set", v8::FunctionTemplate::New(isolate_, read_result_set));
+            context_.Reset(isolate_, v8::Context::New(isolate_, /* extensions= */ nullptr, global));
+            context_setup_time_ = Timer::clock::now() - begin;
+        } else {
+            saved_setup_time += context_setup_time_;
+        }
+        v8::Local<v8::Context> context = context_.Get(isolate_);
+        if (not reuse_context)
+            context_.Reset();
         v8::Context::Scope context_scope(context);
 
-        /* Create the import object for instantiating the WebAssembly module. */
+        /* Create the import object for instantiating the WebAssembly module.  Reuse the `WasmContext` of a previous
+         * plan, including its table mappings and heap, if possible. */
         WasmContext::config_t wasm_config{0};
         if (options::cdt_port < 1024)
             wasm_config |= WasmContext::TRAP_GUARD_PAGES;
-        auto &wasm_context = Create_Wasm_Context_For_ID(Module::ID(), wasm_config, plan);
+        auto &wasm_context = Acquire_Wasm_Context_For_ID(Module::ID(), wasm_config, plan).first.get();
+        scope_exit release_wasm_context([&wasm_context]() { Release_Wasm_Context(wasm_context); });
 
         auto imports = v8::Object::New(isolate_);
         auto env = create_env(*isolate_, plan);
         M_DISCARD imports->Set(context, mkstr(*isolate_, "imports"), env);
 
         /* Map the remaining address space to the output buffer. */
-        M_insist(Is_Page_Aligned(wasm_context.heap));
-        const auto bytes_remaining = wasm_context.vm.size() - wasm_context.heap;
-        memory::Memory mem = Catalog::Get().allocator().allocate(bytes_remaining);
-        mem.map(bytes_remaining, 0, wasm_context.vm, wasm_context.heap);
+        wasm_context.map_heap();
+
+        saved_setup_time += wasm_context.saved_setup_time();
+        if (saved_setup_time != Timer::duration::zero())
+            C.timer().record("Setup time saved by reusing contexts", saved_setup_time);
+
+        /* Reuse a previously compiled module for an equal plan, if possible.  Bypass the cache if the generated code
+         * must be dumped or debugged. */
+        const bool use_cache = options::wasm_compilation_cache and not options::wasm_dump and not options::asm_dump and
+                               options::cdt_port < 1024 and not options::wasm_explain_analyze;
+        std::string plan_fp, tables_fp;
+        CachedModule *cached = nullptr;
+        if (use_cache) {
+            plan_fp = plan_fingerprint(plan);
+            tables_fp = tables_fingerprint(plan);
+            if (auto it = module_cache_.find(plan_fp); it != module_cache_.end()) {
+                if (it->second.tables_fingerprint == tables_fp)
+                    cached = &it->second;
+                else
+                    module_cache_.erase(it); // invalidate since a table's store or data layout has changed
+            }
+        }
+
+        v8::Local<v8::WasmModuleObject> module;
+        if (cached) {
+            /* Restore the state that is set during code generation and required by the host. */
+            if (cached->result_set_factory)
+                wasm_context.result_set_factory = cached->result_set_factory->clone();
+            Module::Get().messages(cached->messages);
 
-        /* Compile the plan and thereby build the Wasm module. */
-        M_TIME_EXPR(compile(plan), "Compile to WebAssembly", C.timer());
+            module = M_TIME_EXPR(v8::WasmModuleObject::FromCompiledModule(isolate_, cached->compiled_module)
+                                     .ToLocalChecked(),
+                                 "Reuse cached Wasm module", C.timer());
+        } else {
+            /* Compile the plan and thereby build the Wasm module. */
+            M_TIME_EXPR(compile(plan), "Compile to WebAssembly", C.timer());
+
+            /* Compile the Wasm module to machine code. */
+            const bool use_code_cache = options::wasm_code_cache_dir and not options::wasm_dump and
+                                        not options::asm_dump and options::cdt_port < 1024 and
+                                        not options::wasm_explain_analyze;
+            if (use_code_cache)
+                module = compile_wasm_module_with_code_cache();
+            else
+                module = M_TIME_EXPR(compile_wasm_module(*isolate_), "Compile Wasm to machine code", C.timer());
+
+            if (use_cache) {
+                module_cache_.emplace(
+                    std::piecewise_construct,
+                    std::forward_as_tuple(std::move(plan_fp)),
+                    std::forward_as_tuple(
+                        std::move(tables_fp),
+                        module->GetCompiledModule(),
+                        wasm_context.result_set_factory ? wasm_context.result_set_factory->clone() : nullptr,
+                        Module::Get().messages()
+                    )
+                );
+            }
+        }
 
         /* Create a WebAssembly instance object. */
-        auto instance = M_TIME_EXPR(instantiate(*isolate_, imports), "Compile Wasm to machine code", C.timer());
+        auto instance = instantiate(*isolate_, module, imports);
 
         /* Set the underlying memory for the instance. */
         v8::SetWasmInstanceRawMemory(instance, wasm_context.vm.as<uint8_t*>(), wasm_context.vm.size());
@@ -830,12 +1142,84 @@ void V8Engine::execute(const Operator &plan)
             if (not Options::Get().quiet)
                 noop_op->out << num_rows << " rows\n";
         }
-        Dispose_Wasm_Context(wasm_context);
+
+        /* Print the physical plan with the counted events of each physical operator. */
+        if (options::wasm_explain_analyze)
+            phys_opt_.dump_plan(plan, std::cout);
     }
+}
+
+v8::Local<v8::WasmModuleObject> V8Engine::compile_wasm_module_with_code_cache()
+{
+    namespace fs = std::filesystem;
+    Catalog &C = Catalog::Get();
 
-    isolate_->Exit();
-    CodeGenContext::Dispose();
-    Module::Dispose();
+    auto [binary_addr, binary_size] = Module::Get().binary(options::wasm_perf_map or options::wasm_perf_jitdump);
+    const std::string wire_bytes(reinterpret_cast<const char*>(binary_addr), binary_size);
+    free(binary_addr);
+    auto as_span = [](const std::string &str) {
+        return std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(str.data()), str.size());
+    };
+
+    /* Key entries by the module bytes and by everything else the generated machine code depends on. */
+    std::hash<std::string> h;
+    std::ostringstream key;
+    key << std::hex << std::setw(16) << std::setfill('0')
+        << (h(wire_bytes) ^ murmur3_64(h(std::string(v8::V8::GetVersion()) + v8_flags_)));
+    const fs::path path = fs::path(options::wasm_code_cache_dir) / (key.str() + ".wasmcache");
+
+    /* An entry consists of the size of the module bytes, the module bytes, and the serialized machine code.  The
+     * module bytes are compared as a whole, s.t. hash collisions never lead to executing wrong code. */
+    std::string compiled_bytes;
+    if (std::ifstream in(path, std::ios_base::binary); in) {
+        uint64_t size = 0;
+        in.read(reinterpret_cast<char*>(&size), sizeof(size));
+        if (in and size == wire_bytes.size()) {
+            std::string cached_wire_bytes(size, '\0');
+            in.read(cached_wire_bytes.data(), size);
+            if (in and cached_wire_bytes == wire_bytes)
+                compiled_bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+    }
+
+    v8::Local<v8::WasmModuleObject> module;
+    if (not compiled_bytes.empty()) {
+        bool is_used;
+        std::tie(module, is_used) = M_TIME_EXPR(
+            compile_wasm_module(*isolate_, as_span(wire_bytes), as_span(compiled_bytes)),
+            "Load Wasm machine code from code cache", C.timer()
+        );
+        if (is_used)
+            return module;
+        /* V8 rejected the machine code, e.g. because it was serialized by another V8 version, and compiled the module
+         * bytes instead.  Replace the entry. */
+    } else {
+        module = M_TIME_EXPR(compile_wasm_module(*isolate_, as_span(wire_bytes)), "Compile Wasm to machine code",
+                             C.timer());
+    }
+
+    /* Store the machine code in the cache.  The cache is best effort, hence ignore I/O errors.  Write to a temporary
+     * file first and rename it afterwards, s.t. concurrent processes never read partially written entries. */
+    {
+        M_TIME_THIS("Store Wasm machine code in code cache", C.timer());
+        auto serialized = module->GetCompiledModule().Serialize();
+        std::error_code ec;
+        fs::create_directories(path.parent_path(), ec);
+        fs::path tmp = path;
+        tmp += "." + std::to_string(getpid());
+        std::ofstream out(tmp, std::ios_base::binary | std::ios_base::trunc);
+        const uint64_t size = wire_bytes.size();
+        out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        out.write(wire_bytes.data(), wire_bytes.size());
+        out.write(reinterpret_cast<const char*>(serialized.buffer.get()), serialized.size);
+        out.close();
+        if (out and serialized.size)
+            fs::rename(tmp, path, ec);
+        else
+            fs::remove(tmp, ec);
+    }
+
+    return module;
 }
 
 __attribute__((constructor(101)))
@@ -896,6 +1280,41 @@ static void register_WasmV8()
         /* description= */ "specify the port for debugging via ChromeDevTools",
                            [] (int i) { options::cdt_port = i; }
     );
+    C.arg_parser().add<bool>(
+        /* group=       */ "WasmV8",
+        /* short=       */ nullptr,
+        /* long=        */ "--wasm-compilation-cache",
+        /* description= */ "cache compiled Wasm modules and reuse them for queries with equal physical plans",
+                           [] (bool b) { options::wasm_compilation_cache = b; }
+    );
+    C.arg_parser().add<bool>(
+        /* group=       */ "WasmV8",
+        /* short=       */ nullptr,
+        /* long=        */ "--wasm-explain-analyze",
+        /* description= */ "print the physical plan with the tuples and events counted for each operator",
+                           [] (bool b) { options::wasm_explain_analyze = b; }
+    );
+    C.arg_parser().add<const char*>(
+        /* group=       */ "WasmV8",
+        /* short=       */ nullptr,
+        /* long=        */ "--wasm-code-cache-dir",
+        /* description= */ "cache the machine code of compiled Wasm modules on disk in the given directory",
+                           [] (const char *dir) { options::wasm_code_cache_dir = dir; }
+    );
+    C.arg_parser().add<bool>(
+        /* group=       */ "WasmV8",
+        /* short=       */ nullptr,
+        /* long=        */ "--wasm-perf-map",
+        /* description= */ "write a perf map file to /tmp that names the generated Wasm functions for perf",
+                           [] (bool b) { options::wasm_perf_map = b; }
+    );
+    C.arg_parser().add<bool>(
+        /* group=       */ "WasmV8",
+        /* short=       */ nullptr,
+        /* long=        */ "--wasm-perf-jitdump",
+        /* description= */ "write a jitdump file of the generated Wasm functions for perf inject --jit",
+                           [] (bool b) { options::wasm_perf_jitdump = b; }
+    );
 }
 
 }
@@ -910,13 +1329,23 @@ v8::Local<v8::String> m::wasm::detail::mkstr(v8::Isolate &isolate, const std::st
     return to_v8_string(&isolate, str);
 }
 
-v8::Local<v8::WasmModuleObject> m::wasm::detail::instantiate(v8::Isolate &isolate, v8::Local<v8::Object> imports)
+v8::Local<v8::WasmModuleObject> m::wasm::detail::compile_wasm_module(v8::Isolate &isolate)
+{
+    /* Retain the function names if `perf` shall attribute the generated code to them. */
+    auto [binary_addr, binary_size] = Module::Get().binary(options::wasm_perf_map or options::wasm_perf_jitdump);
+    auto wasm_module = compile_wasm_module(isolate, std::span<const uint8_t>(binary_addr, binary_size));
+    free(binary_addr);
+
+    return wasm_module;
+}
+
+v8::Local<v8::WasmModuleObject> m::wasm::detail::compile_wasm_module(v8::Isolate &isolate,
+                                                                     std::span<const uint8_t> wire_bytes)
 {
     auto Ctx = isolate.GetCurrentContext();
-    auto [binary_addr, binary_size] = Module::Get().binary();
     auto bs = v8::ArrayBuffer::NewBackingStore(
-        /* data =        */ binary_addr,
-        /* byte_length=  */ binary_size,
+        /* data =        */ const_cast<uint8_t*>(wire_bytes.data()),
+        /* byte_length=  */ wire_bytes.size(),
         /* deleter=      */ v8::BackingStore::EmptyDeleter,
         /* deleter_data= */ nullptr
     );
@@ -924,24 +1353,102 @@ v8::Local<v8::WasmModuleObject> m::wasm::detail::instantiate(v8::Isolate &isolat
     args_t module_args { buffer };
 
     auto wasm = Ctx->Global()->Get(Ctx, mkstr(isolate, "WebAssembly")).ToLocalChecked().As<v8::Object>(); // WebAssembly class
-    auto wasm_module = wasm->Get(Ctx, mkstr(isolate, "Module")).ToLocalChecked().As<v8::Object>()
-                           ->CallAsConstructor(Ctx, 1, module_args).ToLocalChecked().As<v8::Object>();
-    free(binary_addr);
+    return wasm->Get(Ctx, mkstr(isolate, "Module")).ToLocalChecked().As<v8::Object>()
+               ->CallAsConstructor(Ctx, 1, module_args).ToLocalChecked().As<v8::WasmModuleObject>();
+}
+
+namespace {
 
-    args_t instance_args { wasm_module, imports };
+/** The input of the streaming compilation in progress, see `compile_streaming()`. */
+struct streaming_input_t
+{
+    std::span<const uint8_t> wire_bytes;
+    std::span<const uint8_t> compiled_bytes;
+    bool is_compiled_bytes_used = false;
+};
+thread_local streaming_input_t *streaming_input = nullptr;
+
+}
+
+void m::wasm::detail::compile_streaming(const v8::FunctionCallbackInfo<v8::Value> &info)
+{
+    M_insist(bool(streaming_input), "no streaming compilation in progress");
+    auto &input = *streaming_input;
+    auto streaming = v8::WasmStreaming::Unpack(info.GetIsolate(), info.Data());
+    if (not input.compiled_bytes.empty())
+        input.is_compiled_bytes_used =
+            streaming->SetCompiledModuleBytes(input.compiled_bytes.data(), input.compiled_bytes.size());
+    streaming->OnBytesReceived(input.wire_bytes.data(), input.wire_bytes.size());
+    streaming->Finish();
+}
+
+std::pair<v8::Local<v8::WasmModuleObject>, bool>
+m::wasm::detail::compile_wasm_module(v8::Isolate &isolate, std::span<const uint8_t> wire_bytes,
+                                     std::span<const uint8_t> compiled_bytes)
+{
+    auto Ctx = isolate.GetCurrentContext();
+    streaming_input_t input { wire_bytes, compiled_bytes };
+    streaming_input = &input;
+
+    /* `WebAssembly.compileStreaming()` invokes `compile_streaming()`, which provides the actual input. */
+    auto wasm = Ctx->Global()->Get(Ctx, mkstr(isolate, "WebAssembly")).ToLocalChecked().As<v8::Object>(); // WebAssembly class
+    auto compile = wasm->Get(Ctx, mkstr(isolate, "compileStreaming")).ToLocalChecked().As<v8::Function>();
+    args_t compile_args { v8::Undefined(&isolate) };
+    auto promise = compile->Call(Ctx, wasm, 1, compile_args).ToLocalChecked().As<v8::Promise>();
+
+    /* Compilation happens asynchronously.  Run pending tasks until the promise is settled. */
+    for (;;) {
+        isolate.PerformMicrotaskCheckpoint();
+        if (promise->State() != v8::Promise::kPending) break;
+        v8::platform::PumpMessageLoop(V8Engine::platform(), &isolate,
+                                      v8::platform::MessageLoopBehavior::kWaitForWork);
+    }
+    streaming_input = nullptr;
+
+    if (promise->State() == v8::Promise::kRejected)
+        throw backend_exception("failed to compile Wasm module: " + to_std_string(&isolate, promise->Result()));
+    return { promise->Result().As<v8::WasmModuleObject>(), input.is_compiled_bytes_used };
+}
+
+v8::Local<v8::WasmModuleObject> m::wasm::detail::instantiate(v8::Isolate &isolate,
+                                                             v8::Local<v8::WasmModuleObject> module,
+                                                             v8::Local<v8::Object> imports)
+{
+    auto Ctx = isolate.GetCurrentContext();
+    auto wasm = Ctx->Global()->Get(Ctx, mkstr(isolate, "WebAssembly")).ToLocalChecked().As<v8::Object>(); // WebAssembly class
+    args_t instance_args { module, imports };
     return wasm->Get(Ctx, mkstr(isolate, "Instance")).ToLocalChecked().As<v8::Object>()
                ->CallAsConstructor(Ctx, 2, instance_args).ToLocalChecked().As<v8::WasmModuleObject>();
 }
 
+v8::Local<v8::WasmModuleObject> m::wasm::detail::instantiate(v8::Isolate &isolate, v8::Local<v8::Object> imports)
+{
+    return instantiate(isolate, compile_wasm_module(isolate), imports);
+}
+
+std::unordered_set<const Table*> m::wasm::detail::accessed_tables(const Operator &plan)
+{
+    std::unordered_set<const Table*> tables;
+    visit(overloaded {
+        [&tables](const ScanOperator &op) { tables.emplace(&op.store().table()); },
+        [](auto&&) { /* nothing to be done */ },
+    }, plan, tag<ConstPreOrderOperatorVisitor>());
+    return tables;
+}
+
 v8::Local<v8::Object> m::wasm::detail::create_env(v8::Isolate &isolate, const Operator &plan)
 {
     auto &context = WasmEngine::Get_Wasm_Context_By_ID(Module::ID());
     auto Ctx = isolate.GetCurrentContext();
     auto env = v8::Object::New(&isolate);
 
-    /* Map the entire database into the Wasm module. TODO map only tables/indexes that are being accessed */
+    /* Map the tables accessed by the plan into the Wasm module.  Other tables are not mapped and hence do not occupy
+     * any of the at most 4 GiB of linear memory. */
+    const auto tables = accessed_tables(plan);
     auto &DB = Catalog::Get().get_database_in_use();
     for (auto it = DB.begin_tables(); it != DB.end_tables(); ++it) {
+        if (not tables.contains(it->second))
+            continue;
         auto off = context.map_table(*it->second);
 
         /* Add memory address to env. */
@@ -955,8 +1462,43 @@ v8::Local<v8::Object> m::wasm::detail::create_env(v8::Isolate &isolate, const Op
         oss << it->second->name << "_num_rows";
         M_DISCARD env->Set(Ctx, to_v8_string(&isolate, oss.str()), v8::Int32::New(&isolate, it->second->store().num_rows()));
         Module::Get().emit_import<uint32_t>(oss.str().c_str());
+
+        /* Add memory address and number of entries of the dictionary of each dictionary encoded attribute to env. */
+        for (auto &attr : *it->second) {
+            if (not attr.dictionary)
+                continue;
+            oss.str("");
+            oss << "dict_" << attr.dictionary->id << "_mem";
+            const auto dictionary_off = off + WasmEngine::WasmContext::Dictionary_Mapping_Offset(attr);
+            M_DISCARD env->Set(Ctx, to_v8_string(&isolate, oss.str()), v8::Int32::New(&isolate, dictionary_off));
+            Module::Get().emit_import<void*>(oss.str().c_str());
+
+            oss.str("");
+            oss << "dict_" << attr.dictionary->id << "_size";
+            M_DISCARD env->Set(Ctx, to_v8_string(&isolate, oss.str()), v8::Int32::New(&isolate, attr.dictionary->size()));
+            Module::Get().emit_import<uint32_t>(oss.str().c_str());
+        }
     }
 
+    /* Install the zones that qualify for each scan directly below a filter prunable by the scanned table's zone map
+     * and the codes that qualify for each dictionary encoded attribute decided by codes of such a filter.  Since the
+     * filter's constants may be placeholders, both are computed upon each execution rather than embedded into the
+     * code. */
+    visit(overloaded {
+        [&context](const ScanOperator &op) {
+            auto filter = cast<const FilterOperator>(op.parent());
+            auto &table = op.store().table();
+            if (filter and is_prunable_by_zone_map(filter->filter(), table))
+                context.add_qualifying_zones(op.id(), table.store().zone_map().zone_size(),
+                                             qualifying_zones(filter->filter(), table));
+            if (filter) {
+                for (auto attr : dictionary_filtered_attributes(filter->filter(), table))
+                    context.add_qualifying_codes(op.id(), attr->id, m::qualifying_codes(filter->filter(), *attr));
+            }
+        },
+        [](auto&&) { /* nothing to be done */ },
+    }, plan, tag<ConstPreOrderOperatorVisitor>());
+
     /* Map all string literals into the Wasm module. */
     M_insist(Is_Page_Aligned(context.heap));
     auto literals = CollectStringLiterals::Collect(plan);
@@ -978,8 +1520,73 @@ v8::Local<v8::Object> m::wasm::detail::create_env(v8::Isolate &isolate, const Op
     }
     M_insist(Is_Page_Aligned(context.heap));
 
+    /* Add the values bound to the placeholders of a prepared statement to env.  Since the values are imported rather
+     * than embedded into the code, the same module can be reused for all bindings. */
+    auto &parameters = Interpreter::Bound_Parameters();
+    for (std::size_t idx = 0; idx != parameters.size(); ++idx) {
+        auto &[type, value] = parameters[idx];
+        const std::string name = "param_" + std::to_string(idx);
+        auto set = [&](v8::Local<v8::Value> v) { M_DISCARD env->Set(Ctx, to_v8_string(&isolate, name), v); };
+        visit(overloaded {
+            [&](const Boolean&) {
+                set(v8::Int32::New(&isolate, value.as_b()));
+                Module::Get().emit_import<bool>(name.c_str());
+            },
+            [&](const Numeric &n) {
+                switch (n.kind) {
+                    case Numeric::N_Int:
+                    case Numeric::N_Decimal:
+                        switch (n.size()) {
+                            default: M_unreachable("invalid integer size");
+                            case  8:
+                                set(v8::Int32::New(&isolate, value.as_i()));
+                                Module::Get().emit_import<int8_t>(name.c_str());
+                                break;
+                            case 16:
+                                set(v8::Int32::New(&isolate, value.as_i()));
+                                Module::Get().emit_import<int16_t>(name.c_str());
+                                break;
+                            case 32:
+                                set(v8::Int32::New(&isolate, value.as_i()));
+                                Module::Get().emit_import<int32_t>(name.c_str());
+                                break;
+                            case 64:
+                                set(v8::BigInt::New(&isolate, value.as_i()));
+                                Module::Get().emit_import<int64_t>(name.c_str());
+                                break;
+                        }
+                        break;
+                    case Numeric::N_Float:
+                        if (n.size() <= 32) {
+                            set(v8::Number::New(&isolate, value.as_f()));
+                            Module::Get().emit_import<float>(name.c_str());
+                        } else {
+                            set(v8::Number::New(&isolate, value.as_d()));
+                            Module::Get().emit_import<double>(name.c_str());
+                        }
+                }
+            },
+            [&](const Date&) {
+                set(v8::Int32::New(&isolate, value.as_i()));
+                Module::Get().emit_import<int32_t>(name.c_str());
+            },
+            [&](const DateTime&) {
+                set(v8::BigInt::New(&isolate, value.as_i()));
+                Module::Get().emit_import<int64_t>(name.c_str());
+            },
+            [](auto&&) { M_unreachable("invalid type of placeholder"); },
+        }, *type);
+    }
+
     /* Add functions to environment. */
     Module::Get().emit_function_import<void(void*,uint32_t)>("read_result_set");
+    Module::Get().emit_function_import<uint32_t(uint32_t,int64_t)>("index_lower_bound");
+    Module::Get().emit_function_import<uint32_t(uint32_t,int64_t)>("index_upper_bound");
+    Module::Get().emit_function_import<void(uint32_t,uint32_t,uint32_t,void*)>("index_row_ids");
+    Module::Get().emit_function_import<void(uint32_t,uint32_t,void*)>("qualifying_codes");
+    Module::Get().emit_function_import<uint32_t(uint32_t,uint32_t)>("next_qualifying_row");
+    Module::Get().emit_function_import<uint32_t(uint32_t,uint32_t)>("end_of_qualifying_rows");
+    Module::Get().emit_function_import<void(uint32_t,uint64_t)>("report_operator_counter");
 #define ADD_FUNC(FUNC) { \
     auto func = v8::Function::New(Ctx, (FUNC)).ToLocalChecked(); \
     env->Set(Ctx, mkstr(isolate, #FUNC), func).Check(); \
@@ -987,6 +1594,13 @@ v8::Local<v8::Object> m::wasm::detail::create_env(v8::Isolate &isolate, const Op
     ADD_FUNC(insist)
     ADD_FUNC(print)
     ADD_FUNC(read_result_set)
+    ADD_FUNC(index_lower_bound)
+    ADD_FUNC(index_upper_bound)
+    ADD_FUNC(index_row_ids)
+    ADD_FUNC(qualifying_codes)
+    ADD_FUNC(next_qualifying_row)
+    ADD_FUNC(end_of_qualifying_rows)
+    ADD_FUNC(report_operator_counter)
 #undef ADD_FUNC
     {
         auto func = v8::Function::New(Ctx, _throw).ToLocalChecked();
@@ -1017,6 +1631,13 @@ std::string m::wasm::detail::create_js_debug_script(v8::Isolate &isolate, v8::Lo
     env_str.insert(env_str.length() - 1, "\"print\": function (arg) { console.log(arg); },");
     env_str.insert(env_str.length() - 1, "\"throw\": function (ex) { console.error(ex); },");
     env_str.insert(env_str.length() - 1, "\"read_result_set\": read_result_set,");
+    env_str.insert(env_str.length() - 1, "\"index_lower_bound\": function (id, key) { return 0; },");
+    env_str.insert(env_str.length() - 1, "\"index_upper_bound\": function (id, key) { return 0; },");
+    env_str.insert(env_str.length() - 1, "\"index_row_ids\": function (id, begin, end, ptr) { },");
+    env_str.insert(env_str.length() - 1, "\"qualifying_codes\": function (id, attr_id, ptr) { },");
+    env_str.insert(env_str.length() - 1, "\"next_qualifying_row\": function (id, row_id) { return row_id; },");
+    env_str.insert(env_str.length() - 1, "\"end_of_qualifying_rows\": function (id, row_id) { return -1 >>> 0; },");
+    env_str.insert(env_str.length() - 1, "\"report_operator_counter\": function (idx, n) { },");
 
     /* Construct import object. */
     oss << "\
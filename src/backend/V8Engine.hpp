@@ -2,6 +2,8 @@
 
 #include "backend/WebAssembly.hpp"
 #include "util/WebSocketServer.hpp"
+#include <span>
+#include <unordered_set>
 #include <v8-inspector.h>
 #include <v8.h>
 
@@ -82,9 +84,28 @@ void _throw(const v8::FunctionCallbackInfo<v8::Value> &info);
 void print(const v8::FunctionCallbackInfo<v8::Value> &info);
 void set_wasm_instance_raw_memory(const v8::FunctionCallbackInfo<v8::Value> &info);
 void read_result_set(const v8::FunctionCallbackInfo<v8::Value> &info);
+void index_lower_bound(const v8::FunctionCallbackInfo<v8::Value> &info);
+void index_upper_bound(const v8::FunctionCallbackInfo<v8::Value> &info);
+void index_row_ids(const v8::FunctionCallbackInfo<v8::Value> &info);
+void qualifying_codes(const v8::FunctionCallbackInfo<v8::Value> &info);
+void next_qualifying_row(const v8::FunctionCallbackInfo<v8::Value> &info);
+void end_of_qualifying_rows(const v8::FunctionCallbackInfo<v8::Value> &info);
+void report_operator_counter(const v8::FunctionCallbackInfo<v8::Value> &info);
+void compile_streaming(const v8::FunctionCallbackInfo<v8::Value> &info);
 
 v8::Local<v8::String> mkstr(v8::Isolate &isolate, const std::string &str);
+v8::Local<v8::WasmModuleObject> compile_wasm_module(v8::Isolate &isolate);
+v8::Local<v8::WasmModuleObject> compile_wasm_module(v8::Isolate &isolate, std::span<const uint8_t> wire_bytes);
+/** Compiles the Wasm module \p wire_bytes via V8's streaming API, which allows to provide the machine code \p
+ * compiled_bytes that was previously serialized for this module.  Returns the compiled module and whether V8 accepted
+ * \p compiled_bytes.  */
+std::pair<v8::Local<v8::WasmModuleObject>, bool>
+compile_wasm_module(v8::Isolate &isolate, std::span<const uint8_t> wire_bytes, std::span<const uint8_t> compiled_bytes);
+v8::Local<v8::WasmModuleObject> instantiate(v8::Isolate &isolate, v8::Local<v8::WasmModuleObject> module,
+                                            v8::Local<v8::Object> imports);
 v8::Local<v8::WasmModuleObject> instantiate(v8::Isolate &isolate, v8::Local<v8::Object> imports);
+/** Returns the tables accessed by \p plan.  Only these tables are mapped into the Wasm module of \p plan. */
+std::unordered_set<const Table*> accessed_tables(const Operator &plan);
 v8::Local<v8::Object> create_env(v8::Isolate &isolate, const Operator &plan);
 v8::Local<v8::String> to_json(v8::Isolate &isolate, v8::Local<v8::Value> val);
 std::string create_js_debug_script(v8::Isolate &isolate, v8::Local<v8::Object> env,
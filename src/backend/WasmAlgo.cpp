@@ -220,8 +220,219 @@ void m::wasm::quicksort(Buffer<IsGlobal> &buffer, const std::vector<SortingOpera
     quicksort(0, buffer.size());
 }
 
+namespace {
+
+/** Returns the number of bits of the normalized key of the order expression \p expr on tuples of schema \p schema,
+ * including a leading NULL bit iff \p expr may be NULL, or 0 if \p expr cannot be normalized. */
+uint64_t normalized_key_size_in_bits(const Schema &schema, const ast::Expr &expr)
+{
+    if (not is<const ast::Designator>(expr))
+        return 0;
+    auto it = schema.find(Schema::Identifier(expr));
+    if (it == schema.cend())
+        return 0;
+    const Type *type = it->type;
+    const uint64_t null_bit = it->nullable() ? 1 : 0;
+    if (is<const Boolean>(type) or is<const Numeric>(type) or is<const Date>(type) or is<const DateTime>(type))
+        return type->size() + null_bit;
+    return 0; // e.g. character sequences
+}
+
+/** Emits code to encode the ordering \p order of the tuple of schema \p schema in the current environment into a
+ * normalized key, i.e. an unsigned integer s.t. comparing the normalized keys of two tuples yields their order.  NULL
+ * is ordered first, as by `compare()`. */
+U64x1 normalized_key(const Schema &schema, const std::vector<SortingOperator::order_type> &order)
+{
+    auto &env = CodeGenContext::Get().env();
+    Var<U64x1> key(uint64_t(0));
+
+    for (auto &o : order) {
+        const auto &entry = schema[Schema::Identifier(o.first)].second;
+        SQL_t _val = env.compile(o.first);
+
+        std::visit(overloaded {
+            [&]<typename T>(Expr<T> _val) -> void {
+                constexpr uint64_t NUM_BITS = std::is_same_v<T, bool> ? 1 : CHAR_BIT * sizeof(T);
+                constexpr uint64_t MASK = NUM_BITS == 64 ? ~uint64_t(0) : (uint64_t(1) << NUM_BITS) - 1;
+                constexpr uint64_t SIGN_BIT = uint64_t(1) << (NUM_BITS - 1);
+                M_insist(std::is_same_v<T, bool> or entry.type->size() == NUM_BITS, "type size mismatch");
+
+                std::optional<Boolx1> is_null;
+                PrimitiveExpr<T> val = [&]() -> PrimitiveExpr<T> {
+                    if (entry.nullable()) {
+                        auto [val, is_null_] = _val.split();
+                        is_null.emplace(is_null_);
+                        return val;
+                    }
+                    return _val.insist_not_null();
+                }();
+
+                /*----- Encode value s.t. its bits compare as unsigned integer like the value itself. -----*/
+                U64x1 encoded = [&]() -> U64x1 {
+                    if constexpr (std::is_same_v<T, bool>) {
+                        return val.template to<uint64_t>();
+                    } else if constexpr (std::integral<T>) {
+                        /* flip sign bit s.t. negative values are ordered first */
+                        return val.make_unsigned().template to<uint64_t>() xor SIGN_BIT;
+                    } else {
+                        /* flip all bits of negative values and only the sign bit of non-negative values */
+                        using int_t = std::conditional_t<std::is_same_v<T, float>, int32_t, int64_t>;
+                        Var<U64x1> raw(val.template reinterpret<int_t>().make_unsigned().template to<uint64_t>());
+                        return Select((raw bitand SIGN_BIT) != uint64_t(0), raw xor MASK, raw bitor SIGN_BIT);
+                    }
+                }();
+                U64x1 bits = o.second ? std::move(encoded) : encoded xor MASK; // invert bits for descending ordering
+
+                /*----- Append NULL bit, if any, and value to key. -----*/
+                if (is_null) {
+                    Var<Boolx1> is_null_(*is_null); // introduce variable s.t. uses only load from it
+                    key = (key << uint64_t(1)) bitor (not is_null_).template to<uint64_t>();
+                    key = (key << NUM_BITS) bitor Select(is_null_, U64x1(uint64_t(0)), bits); // s.t. NULLs are equal
+                } else {
+                    key = (key << NUM_BITS) bitor bits;
+                }
+            },
+            [](NChar) -> void { M_unreachable("character sequences cannot be normalized"); },
+            [](auto) -> void { M_unreachable("SIMDfication currently not supported"); },
+            [](std::monostate) -> void { M_unreachable("invalid expression"); }
+        }, _val);
+    }
+
+    return key;
+}
+
+}
+
+bool m::wasm::supports_radix_sort(const Schema &schema, const std::vector<SortingOperator::order_type> &order)
+{
+    uint64_t key_size_in_bits = 0;
+    for (auto &o : order) {
+        const auto size_in_bits = normalized_key_size_in_bits(schema, o.first);
+        if (size_in_bits == 0)
+            return false;
+        key_size_in_bits += size_in_bits;
+    }
+    return key_size_in_bits <= 64;
+}
+
+template<bool IsGlobal>
+void m::wasm::radix_sort(const Buffer<IsGlobal> &buffer, const std::vector<SortingOperator::order_type> &order,
+                         std::function<void(U32x1)> Pipeline)
+{
+    static_assert(IsGlobal, "radix sort on local buffers is not yet supported");
+    M_insist(supports_radix_sort(buffer.schema(), order), "ordering cannot be normalized");
+
+    constexpr uint64_t RADIX_BITS = 8;
+    constexpr uint32_t RADIX = 1U << RADIX_BITS;
+    ///> the size of the normalized key and the tuple ID of a tuple, each twice
+    constexpr uint32_t ENTRY_SIZE_IN_BYTES = 2 * (sizeof(uint64_t) + sizeof(uint32_t));
+
+    /*----- Compute the number of passes, i.e. one pass per digit of the normalized keys. -----*/
+    uint64_t key_size_in_bits = 0;
+    Schema key_schema;
+    for (auto &o : order) {
+        key_size_in_bits += normalized_key_size_in_bits(buffer.schema(), o.first);
+        Schema::Identifier id(o.first);
+        if (not key_schema.has(id)) {
+            auto &e = buffer.schema()[id].second;
+            key_schema.add(e.id, e.type, e.constraints);
+        }
+    }
+    const uint64_t num_passes = (key_size_in_bits + RADIX_BITS - 1) / RADIX_BITS;
+
+    /*----- Allocate arrays for the normalized keys and the tuple IDs, each twice s.t. a pass scatters from one array
+     * into the other. -----*/
+    const Var<U32x1> num_tuples(buffer.size());
+    auto memory = Module::Allocator().allocate(num_tuples * ENTRY_SIZE_IN_BYTES, /* align= */ alignof(uint64_t));
+    Var<Ptr<U64x1>> keys(memory.val().to<uint64_t*>());
+    Var<Ptr<U64x1>> keys_scattered(keys.val() + num_tuples.val().make_signed());
+    Var<Ptr<U32x1>> ids((keys_scattered.val() + num_tuples.val().make_signed()).to<uint32_t*>());
+    Var<Ptr<U32x1>> ids_scattered(ids.val() + num_tuples.val().make_signed());
+
+    /*----- Encode the ordering of each tuple into its normalized key. -----*/
+    {
+        auto load = buffer.create_load_proxy(key_schema);
+        Var<U32x1> tuple_id(0U);
+        WHILE (tuple_id < num_tuples) {
+            auto S = CodeGenContext::Get().scoped_environment();
+            load(tuple_id.val());
+            *(keys.val() + tuple_id.val().make_signed()) = normalized_key(key_schema, order);
+            *(ids.val() + tuple_id.val().make_signed()) = tuple_id.val();
+            tuple_id += 1U;
+        }
+    }
+
+    /*----- Sort the normalized keys along with the tuple IDs digit by digit, starting with the least significant. ---*/
+    Ptr<U32x1> histogram = Module::Allocator().pre_malloc<uint32_t>(RADIX);
+    IF (num_tuples > 1U) {
+        for (uint64_t pass = 0; pass != num_passes; ++pass) {
+            auto digit_of = [&](U64x1 key) -> U32x1 {
+                return ((key >> uint64_t(pass * RADIX_BITS)) bitand uint64_t(RADIX - 1)).to<uint32_t>();
+            };
+
+            /*----- Count the occurrences of each digit. -----*/
+            Var<U32x1> digit(0U);
+            WHILE (digit < RADIX) {
+                *(histogram.clone() + digit.val().make_signed()) = 0U;
+                digit += 1U;
+            }
+            Var<U32x1> idx(0U);
+            WHILE (idx < num_tuples) {
+                *(histogram.clone() + digit_of(*(keys.val() + idx.val().make_signed())).make_signed()) += 1U;
+                idx += 1U;
+            }
+
+            /*----- Skip the pass if all keys have the same digit, e.g. the leading zero digits of small values. -----*/
+            const Var<U32x1> num_first_digit(*(histogram.clone() + digit_of(*keys.val()).make_signed()));
+            IF (num_first_digit != num_tuples) {
+                /*----- Compute the first position of each digit by an exclusive prefix sum over the histogram. -----*/
+                Var<U32x1> position(0U);
+                digit = 0U;
+                WHILE (digit < RADIX) {
+                    const Var<U32x1> count(*(histogram.clone() + digit.val().make_signed()));
+                    *(histogram.clone() + digit.val().make_signed()) = position.val();
+                    position += count;
+                    digit += 1U;
+                }
+
+                /*----- Scatter keys and tuple IDs stably by their digit. -----*/
+                idx = 0U;
+                WHILE (idx < num_tuples) {
+                    const Var<U64x1> key(*(keys.val() + idx.val().make_signed()));
+                    const Var<Ptr<U32x1>> cursor(histogram.clone() + digit_of(key).make_signed());
+                    const Var<I32x1> pos(U32x1(*cursor.val()).make_signed());
+                    *cursor.val() += 1U;
+                    *(keys_scattered.val() + pos.val()) = key.val();
+                    *(ids_scattered.val() + pos.val()) = U32x1(*(ids.val() + idx.val().make_signed()));
+                    idx += 1U;
+                }
+
+                /*----- Swap arrays s.t. the scattered ones are sorted by the next pass. -----*/
+                const Var<Ptr<U64x1>> tmp_keys(keys.val());
+                keys = keys_scattered.val();
+                keys_scattered = tmp_keys.val();
+                const Var<Ptr<U32x1>> tmp_ids(ids.val());
+                ids = ids_scattered.val();
+                ids_scattered = tmp_ids.val();
+            };
+        }
+    };
+    histogram.discard(); // since it was only cloned
+
+    /*----- Resume the pipeline for each tuple ID in sorted order. -----*/
+    Var<U32x1> idx(0U);
+    WHILE (idx < num_tuples) {
+        Pipeline(*(ids.val() + idx.val().make_signed()));
+        idx += 1U;
+    }
+
+    Module::Allocator().deallocate(memory, num_tuples * ENTRY_SIZE_IN_BYTES);
+}
+
 // explicit instantiations to prevent linker errors
 template void m::wasm::quicksort(GlobalBuffer&, const std::vector<SortingOperator::order_type>&);
+template void m::wasm::radix_sort(const GlobalBuffer&, const std::vector<SortingOperator::order_type>&,
+                                  std::function<void(U32x1)>);
 
 
 /*======================================================================================================================
@@ -839,10 +1050,13 @@ std::pair<HashTable::entry_t, Boolx1> ChainedHashTable<IsGlobal>::find(std::vect
         pred ? Select(*pred, hash_to_bucket(clone(key)), *predication_dummy_) // use dummy if predicate is not fulfilled
              : hash_to_bucket(clone(key)); // clone key since we need it again for comparison
 
+    CodeGenContext::Get().count_event("hash table lookups", pred ? pred->clone().to<uint64_t>() : U64x1(1));
+
     /*----- Probe collision list, abort if key already exists. -----*/
     Var<Ptr<void>> bucket_it(Ptr<void>(*bucket.to<uint32_t*>()));
     WHILE (not bucket_it.is_nullptr()) { // another entry in collision list
         BREAK(equal_key(bucket_it, std::move(key))); // move key at last use
+        CodeGenContext::Get().count_event("hash table collisions");
         bucket_it = Ptr<void>(*(bucket_it + ptr_offset_in_bytes_).to<uint32_t*>());
     }
 
@@ -1166,6 +1380,7 @@ void ChainedHashTable<IsGlobal>::rehash()
 {
     if (options::insist_no_rehashing)
         Throw(exception::unreachable, "rehashing must not occur");
+    CodeGenContext::Get().count_event("rehashes");
 
     auto emit_rehash = [this](){
         auto S = CodeGenContext::Get().scoped_environment(); // fresh environment to remove predication while rehashing
@@ -1289,7 +1504,7 @@ void OpenAddressingHashTableBase::clear()
     }
 }
 
-Ptr<void> OpenAddressingHashTableBase::hash_to_bucket(std::vector<SQL_t> key) const
+U64x1 OpenAddressingHashTableBase::hash_key(std::vector<SQL_t> key) const
 {
     M_insist(key.size() == key_indices_.size(),
              "provided number of key elements does not match hash table's number of key indices");
@@ -1302,13 +1517,49 @@ Ptr<void> OpenAddressingHashTableBase::hash_to_bucket(std::vector<SQL_t> key) co
         values.emplace_back(schema_.get()[k].type, std::move(*key_it++));
 
     /*----- Compute hash of key using Murmur3_64a. -----*/
-    U64x1 hash = murmur3_64a_hash(std::move(values));
+    return murmur3_64a_hash(std::move(values));
+}
+
+Ptr<void> OpenAddressingHashTableBase::hash_to_bucket(std::vector<SQL_t> key) const
+{
+    M_insist(key.size() == key_indices_.size(),
+             "provided number of key elements does not match hash table's number of key indices");
+
+    M_insist(not direct_addressing_, "keys are not hashed if direct addressing is used");
+
+    /*----- Compute hash of key. -----*/
+    U64x1 hash = hash_key(std::move(key));
 
     /*----- Compute bucket address. -----*/
     U32x1 bucket_idx = hash.to<uint32_t>() bitand mask(); // modulo capacity
     return begin() + (bucket_idx * entry_size_in_bytes_).make_signed();
 }
 
+Ptr<void> OpenAddressingHashTableBase::direct_slot(std::vector<SQL_t> key, const std::optional<Var<Boolx1>> &pred) const
+{
+    M_insist(direct_addressing_, "must set direct addressing before");
+    M_insist(key.size() == 1, "direct addressing requires a single key");
+
+    /*----- Compute index of the slot, i.e. the offset of the key to the smallest key of the domain. -----*/
+    const Var<U64x1> idx(std::visit(overloaded {
+        [&]<typename T>(Expr<T> _val) -> U64x1 requires std::integral<T> {
+            I64x1 val = _val.insist_not_null().template to<int64_t>();
+            return (val - I64x1(direct_addressing_min_)).make_unsigned(); // keys below the domain wrap around
+        },
+        [](auto) -> U64x1 { M_unreachable("direct addressing requires an integral key"); },
+    }, std::move(key.front())));
+
+    /*----- Keys outside of the domain have no slot.  Ignore keys whose predicate is not fulfilled. -----*/
+    const U64x1 domain_size(uint64_t(direct_addressing_domain_size_));
+    IF (pred ? *pred and idx >= domain_size.clone() : idx >= domain_size.clone()) {
+        Throw(exception::unreachable, "key is outside of the domain of direct addressing");
+    };
+    domain_size.discard(); // since it was always cloned
+
+    /*----- Compute slot address. -----*/
+    return begin() + (idx.val().to<uint32_t>() * entry_size_in_bytes_).make_signed();
+}
+
 template<bool IsGlobal, bool ValueInPlace>
 OpenAddressingHashTable<IsGlobal, ValueInPlace>::OpenAddressingHashTable(const Schema &schema,
                                                                          std::vector<HashTable::index_t> key_indices,
@@ -1444,6 +1695,10 @@ OpenAddressingHashTable<IsGlobal, ValueInPlace>::~OpenAddressingHashTable()
         /*----- Free all entries. -----*/
         Module::Allocator().deallocate(storage_.address_, (storage_.mask_ + 1U) * entry_size_in_bytes_);
 
+        /*----- Free control bytes. -----*/
+        if (control_bytes_)
+            Module::Allocator().deallocate(storage_.control_address_, storage_.mask_ + 1U);
+
         /*----- Free dummy entries. -----*/
         for (auto it = dummy_allocations_.rbegin(); it != dummy_allocations_.rend(); ++it)
             Module::Allocator().deallocate(it->first, it->second);
@@ -1459,6 +1714,10 @@ void OpenAddressingHashTable<IsGlobal, ValueInPlace>::setup()
     /*----- Create local variables. -----*/
     address_.emplace();
     num_entries_.emplace();
+    if (control_bytes_) {
+        M_insist(not control_address_, "must not call `setup()` twice");
+        control_address_.emplace();
+    }
     if constexpr (IsGlobal) {
         M_insist(not mask_, "must not call `setup()` twice");
         M_insist(not high_watermark_absolute_, "must not call `setup()` twice");
@@ -1477,22 +1736,31 @@ void OpenAddressingHashTable<IsGlobal, ValueInPlace>::setup()
         *high_watermark_absolute_ = storage_.high_watermark_absolute_;
     }
 
-    if constexpr (IsGlobal) {
-        IF (*num_entries_ == 0U) { // hash table not yet allocated XXX: may allocate multiple times iff predication predicate is never fulfilled
-            /*----- Allocate memory for initial capacity. -----*/
-            *address_ = Module::Allocator().allocate(size_in_bytes(), entry_max_alignment_in_bytes_);
+    auto allocate = [this](){
+        if (control_bytes_) {
+            /*----- Grow initial capacity to at least one group of control bytes. Capacity is a power of 2. -----*/
+            *mask_ = *mask_ bitor (CONTROL_GROUP_SIZE - 1U);
+        }
 
-            /*----- Clear initial hash table. -----*/
-            clear();
-        } ELSE {
-            *address_ = storage_.address_;
-        };
-    } else {
         /*----- Allocate memory for initial capacity. -----*/
         *address_ = Module::Allocator().allocate(size_in_bytes(), entry_max_alignment_in_bytes_);
+        if (control_bytes_)
+            *control_address_ = Module::Allocator().allocate(capacity(), CONTROL_GROUP_SIZE);
 
         /*----- Clear initial hash table. -----*/
         clear();
+    };
+
+    if constexpr (IsGlobal) {
+        IF (*num_entries_ == 0U) { // hash table not yet allocated XXX: may allocate multiple times iff predication predicate is never fulfilled
+            allocate();
+        } ELSE {
+            *address_ = storage_.address_;
+            if (control_bytes_)
+                *control_address_ = storage_.control_address_;
+        };
+    } else {
+        allocate();
     }
 }
 
@@ -1521,6 +1789,10 @@ void OpenAddressingHashTable<IsGlobal, ValueInPlace>::teardown()
         /*----- Free all entries. -----*/
         Module::Allocator().deallocate(*address_, size_in_bytes());
 
+        /*----- Free control bytes. -----*/
+        if (control_bytes_)
+            Module::Allocator().deallocate(*control_address_, capacity());
+
         /*----- Free dummy entries. -----*/
         for (auto it = dummy_allocations_.rbegin(); it != dummy_allocations_.rend(); ++it)
             Module::Allocator().deallocate(it->first, it->second);
@@ -1532,6 +1804,8 @@ void OpenAddressingHashTable<IsGlobal, ValueInPlace>::teardown()
         storage_.mask_ = *mask_;
         storage_.num_entries_ = *num_entries_;
         storage_.high_watermark_absolute_ = *high_watermark_absolute_;
+        if (control_bytes_)
+            storage_.control_address_ = *control_address_;
     }
 
     /*----- Destroy local variables. -----*/
@@ -1539,6 +1813,67 @@ void OpenAddressingHashTable<IsGlobal, ValueInPlace>::teardown()
     mask_.reset();
     num_entries_.reset();
     high_watermark_absolute_.reset();
+    control_address_.reset();
+}
+
+template<bool IsGlobal, bool ValueInPlace>
+void OpenAddressingHashTable<IsGlobal, ValueInPlace>::clear()
+{
+    /*----- Set all slots unoccupied by resetting their reference counters. -----*/
+    OpenAddressingHashTableBase::clear();
+
+    if (control_bytes_) {
+        /*----- Set all control bytes to unoccupied, a whole group at once. -----*/
+        Var<Ptr<void>> it(control_begin());
+        const Var<Ptr<void>> end(control_begin() + capacity().make_signed());
+        WHILE (it != end) {
+            *it.template to<uint8_t*, CONTROL_GROUP_SIZE>() = U8x16(CONTROL_EMPTY);
+            it += int32_t(CONTROL_GROUP_SIZE);
+        }
+    }
+}
+
+template<bool IsGlobal, bool ValueInPlace>
+U32x1 OpenAddressingHashTable<IsGlobal, ValueInPlace>::probe_control_groups(const Var<U64x1> &hash,
+                                                                             std::function<void(U32x1)> Match) const
+{
+    M_insist(control_bytes_, "must set control bytes before");
+    M_insist(bool(mask_), "must call `setup()` before");
+
+    /*----- Broadcast tag of the key to compare it with all control bytes of a group at once. -----*/
+    std::optional<Var<U8x16>> tags;
+    if (Match)
+        tags.emplace(control_tag(hash).template broadcast<CONTROL_GROUP_SIZE>());
+
+    /*----- Compute index of the first slot of the group the hash maps to. -----*/
+    Var<U32x1> group(hash.template to<uint32_t>() bitand *mask_ bitand ~(CONTROL_GROUP_SIZE - 1U));
+
+    /*----- Probe groups quadratically until a group containing an unoccupied slot is found. -----*/
+    Var<U32x1> steps(0);
+    Var<U32x1> unoccupied; // always set before leaving the loop
+    LOOP() {
+        const Var<U8x16> control(control_group(group));
+
+        if (Match) {
+            /*----- Call `Match` for each slot whose tag matches, i.e. compare only those slots' full keys. -----*/
+            Var<U32x1> matches((control == *tags).bitmask());
+            WHILE (matches != 0U) {
+                Match(group + matches.ctz());
+                matches = matches bitand (matches - 1U); // unset lowest set bit
+            }
+        }
+
+        /*----- Abort at a group containing an unoccupied slot since a key is never inserted behind it. -----*/
+        unoccupied = control.bitmask(); // only control bytes of unoccupied slots have their most significant bit set
+        BREAK(unoccupied != 0U);
+
+        steps += 1U;
+        Wasm_insist(steps * CONTROL_GROUP_SIZE <= *mask_, "probing has to find an unoccupied slot if there is one");
+        group = (group + steps * CONTROL_GROUP_SIZE) bitand *mask_;
+        CONTINUE();
+    }
+
+    return group + unoccupied.ctz();
 }
 
 template<bool IsGlobal, bool ValueInPlace>
@@ -1573,6 +1908,7 @@ template<bool IsGlobal, bool ValueInPlace>
 Ptr<void> OpenAddressingHashTable<IsGlobal, ValueInPlace>::emplace_without_rehashing(std::vector<SQL_t> key)
 {
     M_insist(bool(num_entries_), "must call `setup()` before");
+    M_insist(not direct_addressing_, "direct addressing does not support duplicate keys");
     M_insist(bool(high_watermark_absolute_), "must call `setup()` before");
 
     Wasm_insist(*num_entries_ < *high_watermark_absolute_);
@@ -1587,6 +1923,31 @@ Ptr<void> OpenAddressingHashTable<IsGlobal, ValueInPlace>::emplace_without_rehas
     }
     M_insist(not pred or predication_dummy_);
 
+    if (control_bytes_) {
+        /*----- Compute hash of the key. Create constant variable to do not recompute the hash. -----*/
+        const Var<U64x1> hash(hash_key(clone(key))); // clone key since we need it again for insertion
+
+        /*----- Search first unoccupied slot. No tags are compared since duplicates are allowed. -----*/
+        const Var<U32x1> idx(probe_control_groups(hash, nullptr));
+        const Var<Ptr<void>> slot(
+            pred ? Select(*pred, slot_at(idx), *predication_dummy_) // use dummy if predicate is not fulfilled
+                 : slot_at(idx)
+        );
+
+        /*----- Iff no predication is used or predicate is fulfilled, set slot as occupied. -----*/
+        control_byte(idx) = pred ? Select(*pred, control_tag(hash), U8x1(CONTROL_EMPTY)) : control_tag(hash);
+        reference_count(slot) = pred ? pred->to<ref_t>() : PrimitiveExpr<ref_t>(1);
+
+        /*----- Update number of entries. -----*/
+        *num_entries_ += pred ? pred->to<uint32_t>() : U32x1(1);
+        Wasm_insist(*num_entries_ < capacity(), "at least one entry must always be unoccupied for lookups");
+
+        /*----- Insert key. -----*/
+        insert_key(slot, std::move(key)); // move key at last use
+
+        return slot;
+    }
+
     /*----- Compute bucket address by hashing the key. Create constant variable to do not recompute the hash. -----*/
     const Var<Ptr<void>> bucket(
         pred ? Select(*pred, hash_to_bucket(clone(key)), *predication_dummy_) // use dummy if predicate is not fulfilled
@@ -1632,12 +1993,15 @@ OpenAddressingHashTable<IsGlobal, ValueInPlace>::try_emplace(std::vector<SQL_t>
     M_insist(bool(num_entries_), "must call `setup()` before");
     M_insist(bool(high_watermark_absolute_), "must call `setup()` before");
 
-    /*----- If high watermark is reached, perform rehashing and update high watermark. -----*/
-    IF (*num_entries_ == *high_watermark_absolute_) { // XXX: num_entries_ - 1U iff predication predicate is not fulfilled
-        rehash();
-        update_high_watermark();
-    };
-    Wasm_insist(*num_entries_ < *high_watermark_absolute_);
+    /*----- If high watermark is reached, perform rehashing and update high watermark.  A directly addressed hash
+     * table never grows since every key of the domain has its own slot. -----*/
+    if (not direct_addressing_) {
+        IF (*num_entries_ == *high_watermark_absolute_) { // XXX: num_entries_ - 1U iff predicate is not fulfilled
+            rehash();
+            update_high_watermark();
+        };
+        Wasm_insist(*num_entries_ < *high_watermark_absolute_);
+    }
 
     /*----- If predication is used, introduce predication variable and update it before inserting a key. -----*/
     std::optional<Var<Boolx1>> pred;
@@ -1649,6 +2013,116 @@ OpenAddressingHashTable<IsGlobal, ValueInPlace>::try_emplace(std::vector<SQL_t>
     }
     M_insist(not pred or predication_dummy_);
 
+    if (direct_addressing_) {
+        /*----- Compute slot address from the key.  The slot is occupied iff the key was already inserted. -----*/
+        Var<Ptr<void>> slot(
+            pred ? Select(*pred, direct_slot(clone(key), pred), *predication_dummy_) // use dummy if pred. not fulfilled
+                 : direct_slot(clone(key), pred)
+        ); // clone key since we need it again for insertion
+
+        /*----- Abort and skip insertion if the slot is occupied. -----*/
+        Var<Boolx1> entry_inserted(false);
+        BLOCK(insert_entry) {
+            GOTO(reference_count(slot) != ref_t(0), insert_entry);
+
+            /*----- Set flag to indicate insertion. -----*/
+            entry_inserted = true;
+
+            /*----- Iff no predication is used or predicate is fulfilled, set slot as occupied. -----*/
+            reference_count(slot) = pred ? pred->to<ref_t>() : PrimitiveExpr<ref_t>(1);
+
+            /*----- Update number of entries. -----*/
+            *num_entries_ += pred ? pred->to<uint32_t>() : U32x1(1);
+
+            /*----- Insert key. -----*/
+            insert_key(slot, std::move(key)); // move key at last use
+
+            if constexpr (not ValueInPlace) {
+                /*----- Allocate memory for out-of-place values and set pointer to it. -----*/
+                Ptr<void> ptr =
+                    Module::Allocator().allocate(layout_.values_size_in_bytes_, layout_.values_max_alignment_in_bytes_);
+                *(slot + layout_.ptr_offset_in_bytes_).template to<uint32_t*>() = ptr.clone().to<uint32_t>();
+
+                if (pred) {
+                    /*----- Store address and size of dummy predication entry to free them later. -----*/
+                    var_t<Ptr<void>> ptr_; // create global variable iff `IsGlobal` to access it later for deallocation
+                    ptr_ = ptr.clone();
+                    dummy_allocations_.emplace_back(ptr_, layout_.values_size_in_bytes_);
+                }
+
+                ptr.discard(); // since it was always cloned
+            }
+        }
+
+        /* GOTO from above jumps here */
+
+        if constexpr (not ValueInPlace) {
+            /*----- Set slot pointer to out-of-place values. -----*/
+            slot = *(slot + layout_.ptr_offset_in_bytes_).template to<uint32_t*>();
+        }
+
+        /*----- Return entry handle containing all values and the flag whether an insertion was performed. -----*/
+        return { value_entry(slot), entry_inserted };
+    }
+
+    if (control_bytes_) {
+        /*----- Compute hash of the key. Create constant variable to do not recompute the hash. -----*/
+        const Var<U64x1> hash(hash_key(clone(key))); // clone key since we need it again for comparison and insertion
+
+        /*----- Probe groups of slots, abort and skip insertion if key already exists. -----*/
+        Var<Boolx1> entry_inserted(false);
+        Var<Ptr<void>> slot;
+        BLOCK(insert_entry) {
+            const Var<U32x1> idx(probe_control_groups(hash, [&](U32x1 idx){
+                slot = slot_at(idx);
+                /* if predicate is not fulfilled, never match an existing entry but insert into the dummy below */
+                GOTO(pred ? *pred and equal_key(slot, clone(key)) : equal_key(slot, clone(key)), insert_entry);
+            }));
+
+            /*----- Set flag to indicate insertion. -----*/
+            entry_inserted = true;
+
+            /*----- Iff no predication is used or predicate is fulfilled, occupy the unoccupied slot. -----*/
+            slot = pred ? Select(*pred, slot_at(idx), *predication_dummy_) // use dummy if predicate is not fulfilled
+                        : slot_at(idx);
+            control_byte(idx) = pred ? Select(*pred, control_tag(hash), U8x1(CONTROL_EMPTY)) : control_tag(hash);
+            reference_count(slot) = pred ? pred->to<ref_t>() : PrimitiveExpr<ref_t>(1);
+
+            /*----- Update number of entries. -----*/
+            *num_entries_ += pred ? pred->to<uint32_t>() : U32x1(1);
+            Wasm_insist(*num_entries_ < capacity(), "at least one entry must always be unoccupied for lookups");
+
+            /*----- Insert key. -----*/
+            insert_key(slot, std::move(key)); // move key at last use
+
+            if constexpr (not ValueInPlace) {
+                /*----- Allocate memory for out-of-place values and set pointer to it. -----*/
+                Ptr<void> ptr =
+                    Module::Allocator().allocate(layout_.values_size_in_bytes_, layout_.values_max_alignment_in_bytes_);
+                *(slot + layout_.ptr_offset_in_bytes_).template to<uint32_t*>() = ptr.clone().to<uint32_t>();
+
+                if (pred) {
+                    /*----- Store address and size of dummy predication entry to free them later. -----*/
+                    var_t<Ptr<void>> ptr_; // create global variable iff `IsGlobal` to access it later for deallocation
+                    ptr_ = ptr.clone();
+                    dummy_allocations_.emplace_back(ptr_, layout_.values_size_in_bytes_);
+                }
+
+                ptr.discard(); // since it was always cloned
+            }
+        }
+
+        /* GOTO from above jumps here */
+
+        if constexpr (not ValueInPlace) {
+            /*----- Set slot pointer to out-of-place values. -----*/
+            slot = *(slot + layout_.ptr_offset_in_bytes_).template to<uint32_t*>();
+        }
+
+        /*----- Return entry handle containing all values and the flag whether an insertion was performed. -----*/
+        return { value_entry(slot), entry_inserted };
+    }
+
     /*----- Compute bucket address by hashing the key. Create constant variable to do not recompute the hash. -----*/
     const Var<Ptr<void>> bucket(
         pred ? Select(*pred, hash_to_bucket(clone(key)), *predication_dummy_) // use dummy if predicate is not fulfilled
@@ -1724,7 +2198,7 @@ std::pair<HashTable::entry_t, Boolx1> OpenAddressingHashTable<IsGlobal, ValueInP
     M_insist(bool(num_entries_), "must call `setup()` before");
 
     /*----- If predication is used, introduce predication temporal and set it before looking-up a key. -----*/
-    std::optional<Boolx1> pred;
+    std::optional<Var<Boolx1>> pred;
     if (auto &env = CodeGenContext::Get().env(); env.predicated()) {
         M_insist(CodeGenContext::Get().num_simd_lanes() == 1, "invalid number of SIMD lanes");
         pred.emplace(env.extract_predicate<_Boolx1>().is_true_and_not_null());
@@ -1733,6 +2207,55 @@ std::pair<HashTable::entry_t, Boolx1> OpenAddressingHashTable<IsGlobal, ValueInP
     }
     M_insist(not pred or predication_dummy_);
 
+    if (direct_addressing_) {
+        CodeGenContext::Get().count_event("hash table lookups", pred ? pred->to<uint64_t>() : U64x1(1));
+
+        /*----- Compute slot address from the key.  The key is found iff the slot is occupied. -----*/
+        Var<Ptr<void>> slot(
+            pred ? Select(*pred, direct_slot(std::move(key), pred), *predication_dummy_) // dummy if pred. not fulfilled
+                 : direct_slot(std::move(key), pred)
+        );
+        const Var<Boolx1> key_found(reference_count(slot) != ref_t(0)); // the dummy is never occupied
+
+        if constexpr (not ValueInPlace) {
+            /*----- Set slot pointer to out-of-place values. -----*/
+            slot = *(slot + layout_.ptr_offset_in_bytes_).template to<uint32_t*>();
+        }
+
+        /*----- Return entry handle containing both keys and values and the flag whether key was found. -----*/
+        return { value_entry(slot), key_found };
+    }
+
+    if (control_bytes_) {
+        CodeGenContext::Get().count_event("hash table lookups", pred ? pred->to<uint64_t>() : U64x1(1));
+
+        /*----- Compute hash of the key. Create constant variable to do not recompute the hash. -----*/
+        const Var<U64x1> hash(hash_key(clone(key))); // clone key since we need it again for comparison
+
+        /*----- Probe groups of slots, abort if a group with an unoccupied slot is reached or key is found. -----*/
+        Var<Ptr<void>> slot(begin()); // arbitrary entry if key is not found
+        Var<Boolx1> key_found(false);
+        BLOCK(lookup) {
+            probe_control_groups(hash, [&](U32x1 idx){
+                slot = slot_at(idx);
+                /* if predicate is not fulfilled, never match an existing entry s.t. no entry is found */
+                key_found = pred ? *pred and equal_key(slot, std::move(key)) : equal_key(slot, std::move(key));
+                GOTO(key_found, lookup);
+                CodeGenContext::Get().count_event("hash table collisions");
+            }).discard(); // unoccupied slot is not needed
+        }
+        if (pred)
+            slot = Select(*pred, slot, *predication_dummy_); // use dummy if predicate is not fulfilled
+
+        if constexpr (not ValueInPlace) {
+            /*----- Set slot pointer to out-of-place values. -----*/
+            slot = *(slot + layout_.ptr_offset_in_bytes_).template to<uint32_t*>();
+        }
+
+        /*----- Return entry handle containing both keys and values and the flag whether key was found. -----*/
+        return { value_entry(slot), key_found };
+    }
+
     /*----- Compute bucket address by hashing the key. Create constant variable to do not recompute the hash. -----*/
     const Var<Ptr<void>> bucket(
         pred ? Select(*pred, hash_to_bucket(clone(key)), *predication_dummy_) // use dummy if predicate is not fulfilled
@@ -1742,11 +2265,14 @@ std::pair<HashTable::entry_t, Boolx1> OpenAddressingHashTable<IsGlobal, ValueInP
     /*----- Get reference count, i.e. occupied slots, of this bucket. -----*/
     const Var<PrimitiveExpr<ref_t>> refs(reference_count(bucket));
 
+    CodeGenContext::Get().count_event("hash table lookups", pred ? pred->to<uint64_t>() : U64x1(1));
+
     /*----- Probe slots, abort if end of bucket is reached or key already exists. -----*/
     Var<Ptr<void>> slot(bucket.val());
     Var<PrimitiveExpr<ref_t>> steps(0);
     WHILE (steps != refs and reference_count(slot) != ref_t(0)) {
         BREAK(equal_key(slot, std::move(key))); // move key at last use
+        CodeGenContext::Get().count_event("hash table collisions");
         steps += ref_t(1);
         Wasm_insist(steps <= *num_entries_, "probing strategy has to find unoccupied slot if there is one");
         slot = probing_strategy().advance_to_next_slot(slot, steps);
@@ -1787,7 +2313,7 @@ void OpenAddressingHashTable<IsGlobal, ValueInPlace>::for_each_in_equal_range(st
     M_insist(bool(num_entries_), "must call `setup()` before");
 
     /*----- If predication is used, introduce predication temporal and set it before looking-up a key. -----*/
-    std::optional<Boolx1> pred;
+    std::optional<Var<Boolx1>> pred;
     if (auto &env = CodeGenContext::Get().env(); env.predicated()) {
         M_insist(CodeGenContext::Get().num_simd_lanes() == 1, "invalid number of SIMD lanes");
         pred.emplace(env.extract_predicate<_Boolx1>().is_true_and_not_null());
@@ -1796,6 +2322,27 @@ void OpenAddressingHashTable<IsGlobal, ValueInPlace>::for_each_in_equal_range(st
     }
     M_insist(not pred or predication_dummy_);
 
+    if (control_bytes_) {
+        /*----- Compute hash of the key. Create constant variable to do not recompute the hash. -----*/
+        const Var<U64x1> hash(hash_key(clone(key))); // clone key since we need it again for comparison
+
+        /*----- Probe groups of slots and call pipeline (with entry handle argument) on matches with the given key. --*/
+        probe_control_groups(hash, [&](U32x1 idx){
+            const Var<Ptr<void>> slot(slot_at(idx));
+            /* if predicate is not fulfilled, the range of entries with an equal key is empty */
+            auto is_match = pred ? *pred and equal_key(slot, std::move(key)) : equal_key(slot, std::move(key));
+            if (predicated) {
+                CodeGenContext::Get().env().add_predicate(std::move(is_match));
+                Pipeline(entry(slot));
+            } else {
+                IF (std::move(is_match)) { // match found
+                    Pipeline(entry(slot));
+                };
+            }
+        }).discard(); // unoccupied slot is not needed
+        return;
+    }
+
     /*----- Compute bucket address by hashing the key. Create constant variable to do not recompute the hash. -----*/
     const Var<Ptr<void>> bucket(
         pred ? Select(*pred, hash_to_bucket(clone(key)), *predication_dummy_) // use dummy if predicate is not fulfilled
@@ -2134,6 +2681,7 @@ void OpenAddressingHashTable<IsGlobal, ValueInPlace>::rehash()
 {
     if (options::insist_no_rehashing)
         Throw(exception::unreachable, "rehashing must not occur");
+    CodeGenContext::Get().count_event("rehashes");
 
     auto emit_rehash = [this](){
         auto S = CodeGenContext::Get().scoped_environment(); // fresh environment to remove predication while rehashing
@@ -2145,12 +2693,20 @@ void OpenAddressingHashTable<IsGlobal, ValueInPlace>::rehash()
         /*----- Store old begin and end (since they will be overwritten). -----*/
         const Var<Ptr<void>> begin_old(begin());
         const Var<Ptr<void>> end_old(end());
+        std::optional<Var<Ptr<void>>> control_begin_old;
+        std::optional<Var<U32x1>> capacity_old;
+        if (control_bytes_) {
+            control_begin_old.emplace(control_begin());
+            capacity_old.emplace(capacity());
+        }
 
         /*----- Doublex1 capacity. -----*/
         *mask_ = (*mask_ << 1U) + 1U;
 
         /*----- Allocate memory for new hash table with updated capacity. -----*/
         *address_ = Module::Allocator().allocate(size_in_bytes(), entry_max_alignment_in_bytes_);
+        if (control_bytes_)
+            *control_address_ = Module::Allocator().allocate(capacity(), CONTROL_GROUP_SIZE);
 
         /*----- Clear newly created hash table. -----*/
         clear();
@@ -2214,6 +2770,8 @@ void OpenAddressingHashTable<IsGlobal, ValueInPlace>::rehash()
         /*----- Free old hash table. -----*/
         U32x1 size = (end_old - begin_old).make_unsigned();
         Module::Allocator().deallocate(begin_old, size);
+        if (control_bytes_)
+            Module::Allocator().deallocate(*control_begin_old, *capacity_old);
     };
 
     if constexpr (IsGlobal) {
@@ -2223,6 +2781,7 @@ void OpenAddressingHashTable<IsGlobal, ValueInPlace>::rehash()
             auto old_mask = std::exchange(mask_, std::optional<Var<U32x1>>());
             auto old_num_entries = std::exchange(num_entries_, std::optional<Var<U32x1>>());
             auto old_high_watermark_absolute = std::exchange(high_watermark_absolute_, std::optional<Var<U32x1>>());
+            auto old_control_address = std::exchange(control_address_, std::optional<Var<Ptr<void>>>());
 
             /*----- Create function for rehashing. -----*/
             FUNCTION(rehash, void(void))
@@ -2232,6 +2791,8 @@ void OpenAddressingHashTable<IsGlobal, ValueInPlace>::rehash()
                 mask_.emplace(storage_.mask_);
                 num_entries_.emplace(storage_.num_entries_);
                 high_watermark_absolute_.emplace(storage_.high_watermark_absolute_);
+                if (control_bytes_)
+                    control_address_.emplace(storage_.control_address_);
 
                 emit_rehash();
 
@@ -2240,10 +2801,13 @@ void OpenAddressingHashTable<IsGlobal, ValueInPlace>::rehash()
                 storage_.mask_ = *mask_;
                 storage_.num_entries_ = *num_entries_;
                 storage_.high_watermark_absolute_ = *high_watermark_absolute_;
+                if (control_bytes_)
+                    storage_.control_address_ = *control_address_;
                 address_.reset();
                 mask_.reset();
                 num_entries_.reset();
                 high_watermark_absolute_.reset();
+                control_address_.reset();
             }
             rehash_ = std::move(rehash);
 
@@ -2252,6 +2816,7 @@ void OpenAddressingHashTable<IsGlobal, ValueInPlace>::rehash()
             std::exchange(mask_, std::move(old_mask));
             std::exchange(num_entries_, std::move(old_num_entries));
             std::exchange(high_watermark_absolute_, std::move(old_high_watermark_absolute));
+            std::exchange(control_address_, std::move(old_control_address));
         }
 
         /*----- Store local variables in global backups. -----*/
@@ -2259,6 +2824,8 @@ void OpenAddressingHashTable<IsGlobal, ValueInPlace>::rehash()
         storage_.mask_ = *mask_;
         storage_.num_entries_ = *num_entries_;
         storage_.high_watermark_absolute_ = *high_watermark_absolute_;
+        if (control_bytes_)
+            storage_.control_address_ = *control_address_;
 
         /*----- Call rehashing function. ------*/
         M_insist(bool(rehash_));
@@ -2269,6 +2836,8 @@ void OpenAddressingHashTable<IsGlobal, ValueInPlace>::rehash()
         *mask_ = storage_.mask_;
         *num_entries_ = storage_.num_entries_;
         *high_watermark_absolute_ = storage_.high_watermark_absolute_;
+        if (control_bytes_)
+            *control_address_ = storage_.control_address_;
     } else {
         /*----- Emit rehashing code. ------*/
         emit_rehash();
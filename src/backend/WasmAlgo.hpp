@@ -26,6 +26,20 @@ struct ProbingStrategy;
 template<bool IsGlobal>
 void quicksort(Buffer<IsGlobal> &buffer, const std::vector<SortingOperator::order_type> &order);
 
+/** Returns `true` iff the ordering \p order of tuples of schema \p schema can be encoded into byte-comparable
+ * normalized keys of at most 64 bits, i.e. iff `radix_sort()` is applicable.  This requires each expression to order
+ * on to be an attribute of \p schema of boolean, numeric, or date (time) type. */
+bool supports_radix_sort(const Schema &schema, const std::vector<SortingOperator::order_type> &order);
+
+/** Sorts the tuples of the buffer \p buffer using a least significant digit radix sort on normalized keys and calls
+ * \p Pipeline with the ID of each tuple in sorted order.  The ordering is specified by \p order where the first element
+ * is the expression to order on and the second element is `true` iff ordering should be performed ascending.  Only the
+ * normalized keys and tuple IDs are sorted, i.e. the tuples remain in place and must be gathered by their IDs.
+ * Requires `supports_radix_sort()` for the schema of \p buffer and \p order. */
+template<bool IsGlobal>
+void radix_sort(const Buffer<IsGlobal> &buffer, const std::vector<SortingOperator::order_type> &order,
+                std::function<void(U32x1)> Pipeline);
+
 
 /*======================================================================================================================
  * hashing
@@ -724,6 +738,11 @@ struct OpenAddressingHashTableBase : HashTable
 
     using ref_t = uint32_t; ///< 4 bytes for reference counting
 
+    ///> number of slots whose control bytes are probed at once, i.e. the number of bytes of a SIMD vector
+    static constexpr uint32_t CONTROL_GROUP_SIZE = 16;
+    ///> control byte of an unoccupied slot; the control byte of an occupied slot is the 7-bit tag of its key's hash
+    static constexpr uint8_t CONTROL_EMPTY = 0x80;
+
     /** Probing strategy to handle collisions in an open addressing hash table. */
     struct ProbingStrategy
     {
@@ -748,6 +767,10 @@ struct OpenAddressingHashTableBase : HashTable
     HashTable::size_t entry_size_in_bytes_; ///< entry size in bytes
     HashTable::size_t entry_max_alignment_in_bytes_; ///< alignment requirement in bytes of a single entry
     double high_watermark_percentage_ = 1.0; ///< fraction of occupied entries before growing the hash table is required
+    bool direct_addressing_ = false; ///< flag whether the key minus `direct_addressing_min_` is used as slot index
+    int64_t direct_addressing_min_ = 0; ///< smallest key of the domain if direct addressing is used
+    uint32_t direct_addressing_domain_size_ = 0; ///< number of keys of the domain if direct addressing is used
+    bool control_bytes_ = false; ///< flag whether slots are probed group-wise by a separate array of control bytes
 
     public:
     /** Creates an open addressing hash table with schema \p schema and keys at \p key_indices. */
@@ -772,6 +795,29 @@ struct OpenAddressingHashTableBase : HashTable
     /** Sets the hash table's probing strategy to \tparam T. */
     template<typename T>
     void set_probing_strategy() { probing_strategy_ = std::make_unique<T>(*this); }
+    /** Uses the single integral, non-nullable key minus \p min directly as index of its slot instead of hashing it,
+     * i.e. the hash table becomes an array of entries indexed by the key and the reference counter of an entry is its
+     * occupancy bit.  Keys are neither probed nor compared.  Inserting or looking up a key outside of the domain
+     * [\p min, \p min + \p domain_size) throws an exception at runtime.  The capacity must be at least
+     * \p domain_size.  Only supports `try_emplace()`, `find()`, and `for_each()`. */
+    void set_direct_addressing(int64_t min, uint32_t domain_size) {
+        M_insist(key_indices_.size() == 1, "direct addressing requires a single key");
+        M_insist(schema_.get()[key_indices_.front()].type->is_integral(), "direct addressing requires an integral key");
+        M_insist(domain_size != 0, "the domain must not be empty");
+        M_insist(not control_bytes_, "direct addressing cannot be combined with control bytes");
+        direct_addressing_ = true;
+        direct_addressing_min_ = min;
+        direct_addressing_domain_size_ = domain_size;
+    }
+    /** Keeps a separate array of one control byte per slot, which is either `CONTROL_EMPTY` or the 7 most
+     * significant bits of the hash of the slot's key.  Lookups and insertions then probe groups of
+     * `CONTROL_GROUP_SIZE` consecutive slots at once by comparing their control bytes with the tag of the key using
+     * SIMD, and compare the full key only for slots with a matching tag.  The groups are probed quadratically, thus
+     * the probing strategy is ignored.  Must be called before `setup()`. */
+    void set_control_bytes() {
+        M_insist(not direct_addressing_, "control bytes cannot be combined with direct addressing");
+        control_bytes_ = true;
+    }
     protected:
     /** Returns the currently used probing strategy of the hash table. */
     const ProbingStrategy & probing_strategy() const { M_insist(bool(probing_strategy_)); return *probing_strategy_; }
@@ -795,8 +841,13 @@ struct OpenAddressingHashTableBase : HashTable
     void clear() override;
 
     protected:
+    /** Returns the hash of the key \p key. */
+    U64x1 hash_key(std::vector<SQL_t> key) const;
     /** Returns the bucket address for the key \p key by hashing it. */
     Ptr<void> hash_to_bucket(std::vector<SQL_t> key) const;
+    /** Returns the slot address for the key \p key if direct addressing is used.  Throws an exception at runtime if
+     * \p key is outside of the domain and the predicate \p pred, if any, is fulfilled. */
+    Ptr<void> direct_slot(std::vector<SQL_t> key, const std::optional<Var<Boolx1>> &pred) const;
 };
 
 template<bool ValueInPlace>
@@ -843,6 +894,7 @@ class open_addressing_hash_table_storage<true>
     Global<U32x1> mask_; ///< global backup for mask of hash table
     Global<U32x1> num_entries_; ///< global backup for number of occupied entries of hash table
     Global<U32x1> high_watermark_absolute_; ///< global backup for absolute high watermark of hash table
+    Global<Ptr<void>> control_address_; ///< global backup for address of control bytes of hash table
 };
 
 template<bool IsGlobal, bool ValueInPlace>
@@ -858,7 +910,9 @@ struct OpenAddressingHashTable : OpenAddressingHashTableBase
     std::optional<Var<U32x1>> mask_; ///< mask of hash table; always a power of 2 minus 1, i.e. 0b0..01..1
     std::optional<Var<U32x1>> num_entries_; ///< number of occupied entries of hash table
     std::optional<Var<U32x1>> high_watermark_absolute_; ///< maximum number of entries before growing the hash table is required
-    ///> if `IsGlobal`, contains backups for address, capacity, number of entries, and absolute high watermark
+    std::optional<Var<Ptr<void>>> control_address_; ///< base address of control bytes; only used iff control bytes are set
+    ///> if `IsGlobal`, contains backups for address, capacity, number of entries, absolute high watermark, and
+    ///> address of control bytes
     open_addressing_hash_table_storage<IsGlobal> storage_;
     ///> function to perform rehashing; only possible for global hash tables since variables have to be updated
     std::optional<FunctionProxy<void(void)>> rehash_;
@@ -881,6 +935,24 @@ struct OpenAddressingHashTable : OpenAddressingHashTableBase
     Ptr<void> end() const override { return begin() + (capacity() * entry_size_in_bytes_).make_signed(); }
     U32x1 mask() const override { M_insist(bool(mask_), "must call `setup()` before"); return *mask_; }
 
+    /** Returns the address of the first control byte. */
+    Ptr<void> control_begin() const {
+        M_insist(bool(control_address_), "must call `setup()` with control bytes set before");
+        return *control_address_;
+    }
+    /** Returns a `Reference` to the control byte of the slot with index \p idx. */
+    Reference<uint8_t> control_byte(U32x1 idx) const {
+        return *(control_begin() + idx.make_signed()).template to<uint8_t*>();
+    }
+    /** Returns the control bytes of the group of `CONTROL_GROUP_SIZE` slots starting at the slot with index \p idx. */
+    U8x16 control_group(U32x1 idx) const {
+        return *(control_begin() + idx.make_signed()).template to<uint8_t*, CONTROL_GROUP_SIZE>();
+    }
+    /** Returns the address of the slot with index \p idx. */
+    Ptr<void> slot_at(U32x1 idx) const { return begin() + (idx * entry_size_in_bytes_).make_signed(); }
+    /** Returns the tag of a key with hash \p hash, i.e. the 7 most significant bits of \p hash. */
+    static U8x1 control_tag(U64x1 hash) { return (hash >> uint64_t(57)).to<uint8_t>(); }
+
     public:
     /** Performs the setup of all local variables of the hash table (by reading them from the global backups iff
      * \tparam IsGlobal).  Must be called before any call to a setup method, i.e. setting the high watermark, or an
@@ -891,6 +963,8 @@ struct OpenAddressingHashTable : OpenAddressingHashTableBase
      * access method, i.e. clearing, insertion, lookup, or dummy entry creation. */
     void teardown() override;
 
+    void clear() override;
+
     private:
     void update_high_watermark() override {
         M_insist(bool(high_watermark_absolute_), "must call `setup()` before");
@@ -932,6 +1006,12 @@ struct OpenAddressingHashTable : OpenAddressingHashTableBase
      * one free entry slot. */
     Ptr<void> emplace_without_rehashing(std::vector<SQL_t> key);
 
+    /** Probes the groups of control bytes for a key with hash \p hash, starting at the group \p hash maps to, until a
+     * group containing an unoccupied slot is reached.  Returns the index of the first unoccupied slot of this group.
+     * If \p Match is given, it is called with the index of each probed slot whose tag matches the one of \p hash; it
+     * may jump out of the probing, e.g. by `GOTO`.  Requires control bytes to be set. */
+    U32x1 probe_control_groups(const Var<U64x1> &hash, std::function<void(U32x1)> Match) const;
+
     /** Compares the key of the slot at address \p slot with \p key and returns `true` iff they are equal. */
     Boolx1 equal_key(Ptr<void> slot, std::vector<SQL_t> key) const;
 
@@ -985,6 +1065,8 @@ struct QuadraticProbing : OpenAddressingHashTableBase::ProbingStrategy
  *====================================================================================================================*/
 
 extern template void quicksort(GlobalBuffer&, const std::vector<SortingOperator::order_type>&);
+extern template void radix_sort(const GlobalBuffer&, const std::vector<SortingOperator::order_type>&,
+                                std::function<void(U32x1)>);
 extern template struct m::wasm::ChainedHashTable<false>;
 extern template struct m::wasm::ChainedHashTable<true>;
 extern template struct m::wasm::OpenAddressingHashTable<false, false>;
@@ -365,11 +365,11 @@ void Module::Optimize(int optimization_level)
     runner.run();
 }
 
-std::pair<uint8_t*, std::size_t> Module::binary()
+std::pair<uint8_t*, std::size_t> Module::binary(bool with_names)
 {
     ::wasm::BufferWithRandomAccess buffer;
     ::wasm::WasmBinaryWriter writer(&module_, buffer);
-    writer.setNamesSection(false);
+    writer.setNamesSection(with_names);
     writer.write();
     void *binary = malloc(buffer.size());
     std::copy_n(buffer.begin(), buffer.size(), static_cast<char*>(binary));
@@ -903,6 +903,14 @@ struct Module final
         return messages_.at(idx);
     }
 
+    /** Returns the messages of all emitted insists and exception throws. */
+    const std::vector<std::tuple<const char*, unsigned, const char*>> & messages() const { return messages_; }
+    /** Replaces the messages of all emitted insists and exception throws by \p messages.  Used when executing a
+     * previously compiled binary of another `Module` instead of the code emitted into `this` `Module`. */
+    void messages(std::vector<std::tuple<const char*, unsigned, const char*>> messages) {
+        messages_ = std::move(messages);
+    }
+
     /*----- Garbage collected data -----------------------------------------------------------------------------------*/
     /** Adds and returns an instance of \tparam C, which will be created by calling its c`tor with an
      * `GarbageCollectedData&&` instance and the forwarded \p args, to `this` `Module`s garbage collection using the
@@ -926,8 +934,8 @@ struct Module final
     void set_feature(::wasm::FeatureSet feature, bool value) { module_.features.set(feature, value); }
 
     /** Returns the binary representation of `module_` in a freshly allocated memory.  The caller must dispose of this
-     * memory. */
-    std::pair<uint8_t*, std::size_t> binary();
+     * memory.  If \p with_names, the binary includes the names section, s.t. tools can refer to functions by name. */
+    std::pair<uint8_t*, std::size_t> binary(bool with_names = false);
 
     private:
     void create_local_bitmap_stack();
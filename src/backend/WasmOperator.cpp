@@ -1,8 +1,12 @@
 #include "backend/WasmOperator.hpp"
 
+#include "backend/DictionaryFilter.hpp"
+#include "backend/Interpreter.hpp"
+#include "backend/Sargable.hpp"
 #include "backend/WasmAlgo.hpp"
 #include "backend/WasmMacro.hpp"
 #include <mutable/catalog/Catalog.hpp>
+#include <mutable/storage/ZoneMap.hpp>
 #include <numeric>
 
 
@@ -12,6 +16,98 @@ using namespace m::storage;
 using namespace m::wasm;
 
 
+namespace m {
+
+namespace options {
+
+/** Whether to always sort with quicksort, even if the ordering can be encoded into normalized keys for radix sort. */
+bool wasm_quicksort = false;
+
+/** The number of tuples on which a branching filter samples how often each of its clauses, or predicates of its single
+ * clause, is satisfied before it fixes the order of their evaluation; 0 to always evaluate in the order of the query. */
+uint32_t wasm_adaptive_filter_sample_size = 1024;
+
+/** Whether to fuse a filter with the scan below it into a late materializing scan if it is estimated to be cheaper,
+ * whenever applicable, or never. */
+enum { LM_BY_COST, LM_ALWAYS, LM_NEVER } wasm_late_materialization = LM_BY_COST;
+
+/** Whether to always join with the radix-partitioned hash join, whenever applicable, regardless of its cost. */
+bool wasm_radix_partitioned_hash_join = false;
+
+/** Whether to always join with the Bloom-filtered hash join, whenever applicable, regardless of its cost. */
+bool wasm_bloom_filtered_hash_join = false;
+
+/** Whether to always fuse a limit with the sorting below it into a top-k heap, whenever applicable, regardless of its
+ * cost. */
+bool wasm_top_k = false;
+
+}
+
+}
+
+namespace {
+
+__attribute__((constructor(201)))
+static void add_wasm_operator_args()
+{
+    Catalog &C = Catalog::Get();
+
+    /*----- Command-line arguments -----*/
+    C.arg_parser().add<bool>(
+        /* group=       */ "Wasm",
+        /* short=       */ nullptr,
+        /* long=        */ "--wasm-quicksort",
+        /* description= */ "always sort with quicksort instead of radix sort on normalized keys",
+        /* callback=    */ [](bool){ options::wasm_quicksort = true; }
+    );
+    C.arg_parser().add<unsigned>(
+        /* group=       */ "Wasm",
+        /* short=       */ nullptr,
+        /* long=        */ "--wasm-adaptive-filter-sample-size",
+        /* description= */ "order the clauses of branching filters by their pass rates sampled on the given number of "
+                           "tuples (0 to disable)",
+        /* callback=    */ [](unsigned n){ options::wasm_adaptive_filter_sample_size = n; }
+    );
+    C.arg_parser().add<bool>(
+        /* group=       */ "Wasm",
+        /* short=       */ nullptr,
+        /* long=        */ "--wasm-late-materialization",
+        /* description= */ "always fuse a filter with the scan below it into a late materializing scan if applicable",
+        /* callback=    */ [](bool){ options::wasm_late_materialization = options::LM_ALWAYS; }
+    );
+    C.arg_parser().add<bool>(
+        /* group=       */ "Wasm",
+        /* short=       */ nullptr,
+        /* long=        */ "--wasm-no-late-materialization",
+        /* description= */ "never fuse a filter with the scan below it into a late materializing scan",
+        /* callback=    */ [](bool){ options::wasm_late_materialization = options::LM_NEVER; }
+    );
+    C.arg_parser().add<bool>(
+        /* group=       */ "Wasm",
+        /* short=       */ nullptr,
+        /* long=        */ "--wasm-radix-partitioned-hash-join",
+        /* description= */ "always join with the radix-partitioned hash join if applicable",
+        /* callback=    */ [](bool){ options::wasm_radix_partitioned_hash_join = true; }
+    );
+    C.arg_parser().add<bool>(
+        /* group=       */ "Wasm",
+        /* short=       */ nullptr,
+        /* long=        */ "--wasm-bloom-filtered-hash-join",
+        /* description= */ "always join with the Bloom-filtered hash join if applicable",
+        /* callback=    */ [](bool){ options::wasm_bloom_filtered_hash_join = true; }
+    );
+    C.arg_parser().add<bool>(
+        /* group=       */ "Wasm",
+        /* short=       */ nullptr,
+        /* long=        */ "--wasm-top-k",
+        /* description= */ "always fuse a limit with the sorting below it into a top-k heap if applicable",
+        /* callback=    */ [](bool){ options::wasm_top_k = true; }
+    );
+}
+
+}
+
+
 /*======================================================================================================================
  * Helper structs and functions
  *====================================================================================================================*/
@@ -36,7 +132,7 @@ void write_result_set(const Schema &schema, const DataLayoutFactory &factory,
             Global<U32x1> counter_backup; // default initialized to 0
 
             /*----- Create child function s.t. result set is extracted in case of returns (e.g. due to `Limit`). -----*/
-            FUNCTION(child_pipeline, void(void))
+            FUNCTION(result_set_child_pipeline, void(void))
             {
                 auto S = CodeGenContext::Get().scoped_environment(); // create scoped environment for this function
 
@@ -47,18 +143,17 @@ void write_result_set(const Schema &schema, const DataLayoutFactory &factory,
 
                         /*----- Increment tuple ID. -----*/
                         if (auto &env = CodeGenContext::Get().env(); env.predicated()) {
-                            M_insist(CodeGenContext::Get().num_simd_lanes() == 1,
-                                     "SIMDfication with predication not supported");
-                            *counter += env.extract_predicate<_Boolx1>().is_true_and_not_null().to<uint32_t>();
+                            *counter += num_qualifying_tuples(env.extract_predicate());
                         } else {
                             *counter += uint32_t(CodeGenContext::Get().num_simd_lanes());
                         }
 
-                        /*----- If window size is reached, update result size, extract current results, and reset tuple ID. */
-                        IF (*counter == *window_size) {
+                        /*----- If window size is reached, update result size, extract current results, and reset tuple ID.
+                         * With predicated SIMD vectors, the counter may exceed the window size by less than a window. */
+                        IF (*counter >= *window_size) {
                             CodeGenContext::Get().inc_num_tuples(U32x1(*window_size));
                             Module::Get().emit_call<void>("read_result_set", Ptr<void>::Nullptr(), U32x1(*window_size));
-                            *counter = 0U;
+                            *counter -= *window_size;
                         };
                     },
                     /* teardown= */ teardown_t::Make_Without_Parent([&](){
@@ -68,7 +163,7 @@ void write_result_set(const Schema &schema, const DataLayoutFactory &factory,
                     })
                 );
             }
-            child_pipeline(); // call child function
+            result_set_child_pipeline(); // call child function
 
             /*----- Update number of result tuples. -----*/
             CodeGenContext::Get().inc_num_tuples(counter_backup);
@@ -77,7 +172,7 @@ void write_result_set(const Schema &schema, const DataLayoutFactory &factory,
             Module::Get().emit_call<void>("read_result_set", Ptr<void>::Nullptr(), counter_backup.val());
         } else {
             /*----- Create child function s.t. result set is extracted in case of returns (e.g. due to `Limit`). -----*/
-            FUNCTION(child_pipeline, void(void))
+            FUNCTION(result_set_child_pipeline, void(void))
             {
                 auto S = CodeGenContext::Get().scoped_environment(); // create scoped environment for this function
 
@@ -90,9 +185,7 @@ void write_result_set(const Schema &schema, const DataLayoutFactory &factory,
                     /* pipeline= */ [&](){
                         M_insist(bool(num_tuples));
                         if (auto &env = CodeGenContext::Get().env(); env.predicated()) {
-                            M_insist(CodeGenContext::Get().num_simd_lanes() == 1,
-                                     "SIMDfication with predication not supported");
-                            *num_tuples += env.extract_predicate<_Boolx1>().is_true_and_not_null().to<uint32_t>();
+                            *num_tuples += num_qualifying_tuples(env.extract_predicate());
                         } else {
                             *num_tuples += uint32_t(CodeGenContext::Get().num_simd_lanes());
                         }
@@ -104,7 +197,7 @@ void write_result_set(const Schema &schema, const DataLayoutFactory &factory,
                     })
                 );
             }
-            child_pipeline(); // call child function
+            result_set_child_pipeline(); // call child function
 
             /*----- Extract all results at once. -----*/
             Module::Get().emit_call<void>("read_result_set", Ptr<void>::Nullptr(), CodeGenContext::Get().num_tuples());
@@ -118,32 +211,40 @@ void write_result_set(const Schema &schema, const DataLayoutFactory &factory,
             GlobalBuffer result_set(schema, factory, false, *window_size); // no callback to extract windows manually
 
             /*----- Create child function s.t. result set is extracted in case of returns (e.g. due to `Limit`). -----*/
-            FUNCTION(child_pipeline, void(void))
+            FUNCTION(result_set_child_pipeline, void(void))
             {
                 auto S = CodeGenContext::Get().scoped_environment(); // create scoped environment for this function
 
                 child.execute(
                     /* setup=    */ setup_t::Make_Without_Parent([&](){ result_set.setup(); }),
                     /* pipeline= */ [&](){
-                        /*----- Store whether only a single slot is free to not extract result for empty buffer. -----*/
-                        const Var<Boolx1> single_slot_free(
-                            result_set.size() == *window_size - uint32_t(CodeGenContext::Get().num_simd_lanes())
-                        );
+                        auto write_result = [&](){
+                            /*----- Store whether only a single slot is free to not extract result for empty buffer. */
+                            const Var<Boolx1> single_slot_free(
+                                result_set.size() == *window_size - uint32_t(CodeGenContext::Get().num_simd_lanes())
+                            );
 
-                        /*----- Write the result. -----*/
-                        result_set.consume(); // also resets size to 0 in case buffer has reached window size
+                            /*----- Write the result. -----*/
+                            result_set.consume(); // also resets size to 0 in case buffer has reached window size
 
-                        /*----- If the last buffer slot was filled, update result size and extract current results. */
-                        IF (single_slot_free and result_set.size() == 0U) {
-                            CodeGenContext::Get().inc_num_tuples(U32x1(*window_size));
-                            Module::Get().emit_call<void>("read_result_set", result_set.base_address(),
-                                                          U32x1(*window_size));
+                            /*----- If the last buffer slot was filled, update result size and extract current results. */
+                            IF (single_slot_free and result_set.size() == 0U) {
+                                CodeGenContext::Get().inc_num_tuples(U32x1(*window_size));
+                                Module::Get().emit_call<void>("read_result_set", result_set.base_address(),
+                                                              U32x1(*window_size));
+                            };
                         };
+
+                        /*----- Predicated stores are scalar, hence write predicated SIMD vectors lane by lane. -----*/
+                        if (CodeGenContext::Get().env().predicated() and CodeGenContext::Get().num_simd_lanes() > 1)
+                            execute_per_lane(write_result);
+                        else
+                            write_result();
                     },
                     /* teardown= */ teardown_t::Make_Without_Parent([&](){ result_set.teardown(); })
                 );
             }
-            child_pipeline(); // call child function
+            result_set_child_pipeline(); // call child function
 
             /*----- Update number of result tuples. -----*/
             CodeGenContext::Get().inc_num_tuples(result_set.size());
@@ -155,17 +256,23 @@ void write_result_set(const Schema &schema, const DataLayoutFactory &factory,
             GlobalBuffer result_set(schema, factory); // no callback to extract results all at once
 
             /*----- Create child function s.t. result set is extracted in case of returns (e.g. due to `Limit`). -----*/
-            FUNCTION(child_pipeline, void(void))
+            FUNCTION(result_set_child_pipeline, void(void))
             {
                 auto S = CodeGenContext::Get().scoped_environment(); // create scoped environment for this function
 
                 child.execute(
                     /* setup=    */ setup_t::Make_Without_Parent([&](){ result_set.setup(); }),
-                    /* pipeline= */ [&](){ result_set.consume(); },
+                    /* pipeline= */ [&](){
+                        /*----- Predicated stores are scalar, hence write predicated SIMD vectors lane by lane. -----*/
+                        if (CodeGenContext::Get().env().predicated() and CodeGenContext::Get().num_simd_lanes() > 1)
+                            execute_per_lane([&](){ result_set.consume(); });
+                        else
+                            result_set.consume();
+                    },
                     /* teardown= */ teardown_t::Make_Without_Parent([&](){ result_set.teardown(); })
                 );
             }
-            child_pipeline(); // call child function
+            result_set_child_pipeline(); // call child function
 
             /*----- Set number of result tuples. -----*/
             CodeGenContext::Get().inc_num_tuples(result_set.size()); // not inside child function due to predication
@@ -337,6 +444,214 @@ decompose_equi_predicate(const cnf::CNF &cnf, const Schema &schema_left)
     return { std::move(ids_left), std::move(ids_right) };
 }
 
+/** The approximate size in bytes of the cache a hash table must fit into s.t. lookups mostly hit the cache. */
+constexpr double HASH_TABLE_CACHE_SIZE_IN_BYTES = 1 << 20;
+/** The approximate cost factor of hash table lookups that mostly miss the cache compared to lookups hitting it. */
+constexpr double HASH_TABLE_CACHE_MISS_PENALTY = 3.0;
+
+/** Returns the estimated size in bytes of a hash table with \p num_entries entries of schema \p schema, assuming the
+ * high watermark of 0.7 used by the hash joins. */
+double estimated_hash_table_size_in_bytes(const Schema &schema, double num_entries)
+{
+    uint64_t entry_size_in_bits = 32; // for the reference or the occupancy of each entry
+    for (auto &e : schema)
+        entry_size_in_bits += e.type->size();
+    return num_entries / 0.7 * ((entry_size_in_bits + 7) / 8);
+}
+
+/** Returns the scan in the plan rooted at \p op that produces all identifiers \p ids, or `nullptr` if there is none.
+ * Only descends into filters and joins, s.t. discarding tuples of the returned scan which have no join partner for
+ * \p ids further up the plan does not alter the result of any operator in between. */
+const ScanOperator * find_scan_producing(const Producer &op, const std::vector<Schema::Identifier> &ids)
+{
+    auto produces_ids = [&ids](const Producer &producer) {
+        return std::all_of(ids.cbegin(), ids.cend(), [&](auto &id) { return producer.schema().has(id); });
+    };
+    if (not produces_ids(op))
+        return nullptr;
+    if (auto scan = cast<const ScanOperator>(&op))
+        return scan;
+    if (auto join = cast<const JoinOperator>(&op); join and join->is_semi_or_anti())
+        return find_scan_producing(*join->child(1), ids); // a semi-join produces only attributes of its probe side
+    if (is<const FilterOperator>(op) or is<const JoinOperator>(op)) {
+        for (auto child : cast<const Consumer>(&op)->children()) {
+            if (auto scan = find_scan_producing(*child, ids))
+                return scan;
+        }
+    }
+    return nullptr;
+}
+
+/** Emits code evaluating the conjunction of all sideways filters installed on \p scan for the current tuple, see
+ * `CodeGenContext::push_sideways_filter()`, or returns `std::nullopt` if no sideways filter is installed on \p scan.
+ * Every implementation of a scan must apply these filters since the installing operator accounts for them. */
+std::optional<Boolx1> compile_sideways_filters(const ScanOperator &scan)
+{
+    std::optional<Boolx1> pass;
+    for (auto &sideways_filter : CodeGenContext::Get().sideways_filters()) {
+        if (sideways_filter.scan != &scan)
+            continue;
+        if (pass)
+            pass.emplace(*pass and sideways_filter.filter());
+        else
+            pass.emplace(sideways_filter.filter());
+    }
+    return pass;
+}
+
+/** The codes of the dictionary encoded attributes of a scanned table that qualify for the clauses of the filter
+ * directly above the scan which reference only such an attribute, see `dictionary_filtered_attributes()`.  The host
+ * evaluates these clauses once per dictionary entry and NULL upon each execution and copies the outcomes into memory
+ * allocated here, see `WasmContext::add_qualifying_codes()`.  Only applicable if scalar code is emitted. */
+class QualifyingCodes
+{
+    std::vector<const Attribute*> attrs_; ///< the attributes decided by their codes
+    std::vector<Var<Ptr<U8x1>>> qualifies_; ///< whether NULL and each code qualify, per attribute
+
+    /** Returns the number of codes of \p attr, including NULL. */
+    static U32x1 Num_Codes(const Attribute &attr) {
+        std::ostringstream oss;
+        oss << "dict_" << attr.dictionary->id << "_size";
+        return Module::Get().get_global<uint32_t>(oss.str().c_str()) + 1U;
+    }
+
+    public:
+    /** Emits code to fetch the qualifying codes of each attribute of the table scanned by \p scan that is decided by
+     * its codes for \p filter.  If \p filter is `nullptr`, no attribute is decided by its codes. */
+    QualifyingCodes(const ScanOperator &scan, const FilterOperator *filter) {
+        if (not filter)
+            return;
+        attrs_ = dictionary_filtered_attributes(filter->filter(), scan.store().table());
+        qualifies_.reserve(attrs_.size()); // since `Var`s must not be moved once used
+        for (auto attr : attrs_) {
+            auto &qualifies = qualifies_.emplace_back(Module::Allocator().malloc<uint8_t>(Num_Codes(*attr)));
+            Module::Get().emit_call<void>("qualifying_codes", U32x1(scan.id()), U32x1(attr->id),
+                                          qualifies.val().to<void*>());
+        }
+    }
+
+    QualifyingCodes(const QualifyingCodes&) = delete;
+
+    /** Emits code checking whether the codes of all attributes decided by their codes qualify for the current tuple,
+     * whose attributes are identified by \p layout_schema, or returns `std::nullopt` if there are no such
+     * attributes. */
+    std::optional<Boolx1> qualify(const Schema &layout_schema) const {
+        std::optional<Boolx1> pass;
+        for (std::size_t i = 0; i != attrs_.size(); ++i) {
+            auto &dictionary = *attrs_[i]->dictionary;
+            auto value = CodeGenContext::Get().env().get<NChar>(layout_schema[attrs_[i]->id].id);
+            const Var<Ptr<Charx1>> entry(value.val()); // NULL or address of the entry of the code
+            U32x1 code = (entry.val() - dictionary_entries(dictionary)).make_unsigned() /
+                         uint32_t(dictionary.entry_size());
+            U32x1 idx = Select(entry.val().is_nullptr(), 0U, code + 1U);
+            Boolx1 qualifies = *(qualifies_[i].val() + idx.make_signed()) != uint8_t(0);
+            if (pass)
+                pass.emplace(*pass and qualifies);
+            else
+                pass.emplace(qualifies);
+        }
+        return pass;
+    }
+
+    /** Emits code to free the qualifying codes. */
+    void free() {
+        for (std::size_t i = 0; i != attrs_.size(); ++i)
+            Module::Allocator().free(qualifies_[i].val(), Num_Codes(*attrs_[i]));
+    }
+};
+
+/** Emits the loop of a scan of \p scan over all tuples from \p tuple_id to \p end.  The blocks \p inits, \p loads, and
+ * \p jumps are generated by `compile_load_sequential()` for \p tuple_id.  \p body is emitted into the loop body after
+ * the loads.  If \p prune_zones, only the zones of the table which qualify for the filter directly above \p scan are
+ * scanned, i.e. the loop over all runs of consecutive qualifying zones and, nested, the loop for the scan of a single
+ * run are emitted.  The qualifying zones are computed by the host upon each execution, see
+ * `WasmContext::add_qualifying_zones()`. */
+void emit_scan_loop(const ScanOperator &scan, bool prune_zones, Var<U32x1> &tuple_id, U32x1 end, Block &inits,
+                    Block &loads, Block &jumps, const std::function<void(void)> &body)
+{
+    if (not prune_zones) {
+        inits.attach_to_current();
+        WHILE (tuple_id < end) {
+            loads.attach_to_current();
+            body();
+            jumps.attach_to_current();
+        }
+        return;
+    }
+
+    const uint32_t scan_id = scan.id();
+    auto next_qualifying_row = [&](U32x1 row_id) -> U32x1 {
+        return Module::Get().emit_call<uint32_t>("next_qualifying_row", U32x1(scan_id), row_id);
+    };
+    auto end_of_qualifying_rows = [&](U32x1 row_id) -> U32x1 {
+        return Module::Get().emit_call<uint32_t>("end_of_qualifying_rows", U32x1(scan_id), row_id);
+    };
+
+    const Var<U32x1> scan_end(end);
+    tuple_id = next_qualifying_row(tuple_id.val());
+    WHILE (tuple_id < scan_end) {
+        Var<U32x1> run_end(end_of_qualifying_rows(tuple_id.val()));
+        IF (run_end > scan_end) {
+            run_end = scan_end;
+        };
+        inits.attach_to_current();
+        WHILE (tuple_id < run_end) {
+            loads.attach_to_current();
+            body();
+            jumps.attach_to_current();
+        }
+        tuple_id = next_qualifying_row(tuple_id.val());
+    }
+}
+
+
+/** Returns the identifier by which the value of \p expr is available in the environment, i.e.\ the identifier of a
+ * designator or of the result `$res` of a nested query, or `std::nullopt` if \p expr is neither. */
+std::optional<Schema::Identifier> identifier_of(const Expr &expr)
+{
+    if (is<const Designator>(expr))
+        return Schema::Identifier(expr);
+    if (auto query = cast<const QueryExpr>(&expr))
+        return Schema::Identifier(query->alias(), Catalog::Get().pool("$res"));
+    return std::nullopt;
+}
+
+/** Decomposes the predicate of the semi-join or anti-join \p join, i.e.\ a conjunction of `=` or `IN` predicates each
+ * comparing two identifiers of equal type, into all identifiers of the build side (returned as first element) and all
+ * identifiers of the probe side (returned as second element).  Returns `std::nullopt` if the predicate is not of this
+ * form or if \p join is a null-aware anti-join whose predicate is not a single `IN` predicate. */
+std::optional<std::pair<std::vector<Schema::Identifier>, std::vector<Schema::Identifier>>>
+decompose_semi_join_predicate(const JoinOperator &join)
+{
+    M_insist(join.is_semi_or_anti());
+    auto &schema_build = join.child(0)->schema();
+    std::vector<Schema::Identifier> ids_build, ids_probe;
+    for (auto &clause : join.predicate()) {
+        if (clause.size() != 1 or clause[0].negative())
+            return std::nullopt;
+        auto binary = cast<const BinaryExpr>(&clause[0].expr());
+        if (not binary or (binary->tok != TK_EQUAL and binary->tok != TK_In))
+            return std::nullopt;
+        if (join.kind() == JoinOperator::J_NullAwareAnti and (binary->tok != TK_In or join.predicate().size() != 1))
+            return std::nullopt;
+        auto id_first = identifier_of(*binary->lhs), id_second = identifier_of(*binary->rhs);
+        if (not id_first or not id_second or binary->lhs->type() != binary->rhs->type())
+            return std::nullopt;
+        if (schema_build.has(*id_first) and not schema_build.has(*id_second)) {
+            ids_build.push_back(*id_first);
+            ids_probe.push_back(*id_second);
+        } else if (schema_build.has(*id_second) and not schema_build.has(*id_first)) {
+            ids_build.push_back(*id_second);
+            ids_probe.push_back(*id_first);
+        } else {
+            return std::nullopt;
+        }
+    }
+    if (ids_build.empty())
+        return std::nullopt;
+    return std::make_pair(std::move(ids_build), std::move(ids_probe));
+}
+
 
 /*======================================================================================================================
  * NoOp
@@ -351,18 +666,7 @@ void NoOp::execute(const Match<NoOp> &M, setup_t, pipeline_t, teardown_t)
         /* pipeline= */ [&](){
             M_insist(bool(num_tuples));
             if (auto &env = CodeGenContext::Get().env(); env.predicated()) {
-                switch (CodeGenContext::Get().num_simd_lanes()) {
-                    default: M_unreachable("invalid number of simd lanes");
-                    case  1: {
-                        *num_tuples += env.extract_predicate<_Boolx1>().is_true_and_not_null().to<uint32_t>();
-                        break;
-                    }
-                    case 16: {
-                        auto pred = env.extract_predicate<_Boolx16>().is_true_and_not_null();
-                        *num_tuples += pred.bitmask().popcnt();
-                        break;
-                    }
-                }
+                *num_tuples += num_qualifying_tuples(env.extract_predicate());
             } else {
                 *num_tuples += uint32_t(CodeGenContext::Get().num_simd_lanes());
             }
@@ -381,18 +685,24 @@ void NoOp::execute(const Match<NoOp> &M, setup_t, pipeline_t, teardown_t)
  *====================================================================================================================*/
 
 template<bool SIMDfied>
-ConditionSet Callback<SIMDfied>::pre_condition(std::size_t child_idx, const std::tuple<const CallbackOperator*>&)
+ConditionSet Callback<SIMDfied>::pre_condition(std::size_t child_idx,
+                                               const std::tuple<const CallbackOperator*> &partial_inner_nodes)
 {
      M_insist(child_idx == 0);
 
     ConditionSet pre_cond;
 
-    if constexpr (SIMDfied) {
-        /*----- SIMDfied callback supports SIMD but not predication. -----*/
-        pre_cond.add_condition(Predicated(false));
-    } else {
-        /*----- Non-SIMDfied callback does not support SIMD. -----*/
+    if constexpr (not SIMDfied) {
+        /*----- Non-SIMDfied callback does not support SIMD.  SIMDfied callback supports SIMD and predication. -----*/
         pre_cond.add_condition(NoSIMD());
+    } else {
+        /*----- The result set window of a batched callback is its batch size.  SIMDfied callback requires windows
+         * of a multiple of all SIMD widths. -----*/
+        auto &callback = *std::get<0>(partial_inner_nodes);
+        if (callback.is_batched() and callback.batch_size() % WINDOW_SIZE_MULTIPLE != 0) {
+            pre_cond.add_condition(Unsatisfiable());
+            return pre_cond;
+        }
     }
 
     return pre_cond;
@@ -419,11 +729,8 @@ ConditionSet Print<SIMDfied>::pre_condition(std::size_t child_idx, const std::tu
 
     ConditionSet pre_cond;
 
-    if constexpr (SIMDfied) {
-        /*----- SIMDfied print supports SIMD but not predication. -----*/
-        pre_cond.add_condition(Predicated(false));
-    } else {
-        /*----- Non-SIMDfied print does not support SIMD. -----*/
+    if constexpr (not SIMDfied) {
+        /*----- Non-SIMDfied print does not support SIMD.  SIMDfied print supports SIMD and predication. -----*/
         pre_cond.add_condition(NoSIMD());
     }
 
@@ -536,17 +843,41 @@ void Scan<SIMDfied>::execute(const Match<Scan> &M, setup_t setup, pipeline_t pip
     /*----- Emit setup code *before* compiling data layout to not overwrite its temporary boolean variables. -----*/
     setup();
 
+    /*----- If scalar code is emitted, decide the clauses of the filter directly above this scan that reference only a
+     * dictionary encoded attribute by the codes of this attribute, see `residual_filter()`. -----*/
+    auto filter = cast<const FilterOperator>(M.scan.parent());
+    QualifyingCodes codes(M.scan, num_simd_lanes == 1 ? filter : nullptr);
+
+    /*----- Resume the pipeline only for tuples passing all sideways filters installed on this scan and whose codes
+     * qualify.  Since sideways filters are pure pre-filters, they are skipped if scalar code cannot be emitted. -----*/
+    auto resume_pipeline = [&](){
+        std::optional<Boolx1> pass = codes.qualify(layout_schema);
+        if (num_simd_lanes == 1) {
+            if (auto sideways = compile_sideways_filters(M.scan))
+                pass.emplace(pass ? *pass and *sideways : std::move(*sideways));
+        }
+        if (pass) {
+            IF (*pass) {
+                pipeline();
+            };
+        } else {
+            pipeline();
+        }
+    };
+
     /*----- Compile data layout to generate sequential load from table. -----*/
     auto [inits, loads, jumps] = compile_load_sequential(schema, base_address, table.layout(), num_simd_lanes,
                                                          layout_schema, tuple_id);
 
-    /*----- Generate the loop for the actual scan, with the pipeline emitted into the loop body. -----*/
-    inits.attach_to_current();
-    WHILE (tuple_id < num_rows) {
-        loads.attach_to_current();
-        pipeline();
-        jumps.attach_to_current();
-    }
+    /*----- Generate the loop for the actual scan of all tuples, with the pipeline emitted into the loop body.  Skip
+     * the zones of the table which the filter directly above this scan rejects as a whole, as proven by the table's
+     * zone map.  Since zones are aligned to SIMD batches, only whole batches are skipped. -----*/
+    const bool prune_zones = filter and is_prunable_by_zone_map(filter->filter(), table) and
+                             table.store().zone_map().zone_size() % num_simd_lanes == 0;
+    emit_scan_loop(M.scan, prune_zones, tuple_id, std::move(num_rows), inits, loads, jumps, resume_pipeline);
+
+    /*----- Free the qualifying codes. -----*/
+    codes.free();
 
     /*----- Emit teardown code. -----*/
     teardown();
@@ -554,130 +885,594 @@ void Scan<SIMDfied>::execute(const Match<Scan> &M, setup_t setup, pipeline_t pip
 
 
 /*======================================================================================================================
- * Filter
+ * Index Scan
  *====================================================================================================================*/
 
-template<bool Predicated>
-ConditionSet Filter<Predicated>::pre_condition(std::size_t child_idx, const std::tuple<const FilterOperator*>&)
+std::optional<IndexScan::key_range_t> IndexScan::Compute_Key_Range(const FilterOperator &filter,
+                                                                    const ScanOperator &scan)
 {
-     M_insist(child_idx == 0);
+    auto &table = scan.store().table();
+    auto &DB = Catalog::Get().get_database_in_use();
+
+    /*----- Compute the key range of each index on the scanned table and choose the one with the fewest entries. -----*/
+    std::optional<key_range_t> best;
+    for (Index *index : DB.indexes_of(table)) {
+        key_range_t range{
+            .index = index,
+            .lower = std::numeric_limits<int64_t>::lowest(),
+            .upper = std::numeric_limits<int64_t>::max(),
+            .residual = cnf::CNF(),
+            .num_entries = 0,
+        };
+        bool is_sargable = false;
+        for (auto &clause : filter.filter()) {
+            /*----- The key range is embedded into the generated code and hence must not depend on placeholders,
+             * which are only bound upon execution. -----*/
+            auto cmp = clause.size() == 1 ? sargable_comparison(clause[0]) : std::nullopt;
+            if (not cmp or &cmp->attr != &index->attr or cmp->constant.is_placeholder()) {
+                range.residual.push_back(clause);
+                continue;
+            }
 
-    ConditionSet pre_cond;
+            is_sargable = true;
+            restrict_range(range.lower, range.upper, cmp->op, Interpreter::eval(cmp->constant).as_i());
+        }
+        if (not is_sargable)
+            continue;
 
-    if constexpr (not Predicated) {
-        /*----- Branching filter does not support SIMD. -----*/
-        pre_cond.add_condition(NoSIMD());
+        if (not range.empty())
+            range.num_entries = index->upper_bound(range.upper) - index->lower_bound(range.lower);
+        if (not best or range.num_entries < best->num_entries)
+            best.emplace(std::move(range));
     }
 
+    return best;
+}
+
+ConditionSet IndexScan::pre_condition(std::size_t child_idx,
+                                      const std::tuple<const FilterOperator*, const ScanOperator*>
+                                          &partial_inner_nodes)
+{
+    M_insist(child_idx == 0);
+
+    ConditionSet pre_cond;
+
+    /*----- Index scan can only be used if the filter contains a sargable clause on an indexed attribute. -----*/
+    auto &filter = *std::get<0>(partial_inner_nodes);
+    auto &scan = *std::get<1>(partial_inner_nodes);
+    if (not Compute_Key_Range(filter, scan))
+        pre_cond.add_condition(Unsatisfiable());
+
     return pre_cond;
 }
 
-template<bool Predicated>
-ConditionSet Filter<Predicated>::adapt_post_condition(const Match<Filter>&, const ConditionSet &post_cond_child)
+ConditionSet IndexScan::post_condition(const Match<IndexScan>&)
 {
-    ConditionSet post_cond(post_cond_child);
+    ConditionSet post_cond;
 
-    if constexpr (Predicated) {
-        /*----- Predicated filter introduces predication. -----*/
-        post_cond.add_or_replace_condition(m::Predicated(true));
-    }
+    /*----- Index scan does not introduce predication. -----*/
+    post_cond.add_condition(Predicated(false));
+
+    /*----- Index scan does not introduce SIMD. -----*/
+    post_cond.add_condition(NoSIMD());
 
     return post_cond;
 }
 
-template<bool Predicated>
-double Filter<Predicated>::cost(const Match<Filter> &M)
+double IndexScan::cost(const Match<IndexScan> &M)
 {
-    const cnf::CNF &cond = M.filter.filter();
-    const unsigned cost = std::accumulate(cond.cbegin(), cond.cend(), 0U, [](unsigned cost, const cnf::Clause &clause) {
+    /*----- Each tuple in the range is loaded by a point access, which is costlier than a sequential load.  Hence, an
+     * index scan only pays off for selective filters. -----*/
+    const std::size_t num_rows = std::max<std::size_t>(M.scan.store().num_rows(), 1);
+    const double selectivity = double(M.range.num_entries) / num_rows;
+    const unsigned residual_cost = std::accumulate(M.range.residual.cbegin(), M.range.residual.cend(), 0U,
+                                                   [](unsigned cost, const cnf::Clause &clause) {
         return cost + clause.size();
     });
-    return cost * (Predicated ? 2.0 : 1.0);
+    return 0.5 + selectivity * (4.0 + residual_cost);
 }
 
-template<bool Predicated>
-void Filter<Predicated>::execute(const Match<Filter> &M, setup_t setup, pipeline_t pipeline, teardown_t teardown)
+void IndexScan::execute(const Match<IndexScan> &M, setup_t setup, pipeline_t pipeline, teardown_t teardown)
 {
-    /*----- Set minimal number of SIMD lanes preferred to get fully utilized SIMD vectors for the filter condition. --*/
-    CodeGenContext::Get().update_num_simd_lanes_preferred(16); // set own preference
+    auto &schema = M.scan.schema();
+    auto &table = M.scan.store().table();
+    auto &range = M.range;
 
-    /*----- Execute filter. -----*/
-    M.child.execute(
-        /* setup=    */ std::move(setup),
-        /* pipeline= */ [&, pipeline=std::move(pipeline)](){
-            if constexpr (Predicated) {
-                CodeGenContext::Get().env().add_predicate(M.filter.filter());
-                pipeline();
-            } else {
-                M_insist(CodeGenContext::Get().num_simd_lanes() == 1, "invalid number of SIMD lanes");
-                IF (CodeGenContext::Get().env().compile<_Boolx1>(M.filter.filter()).is_true_and_not_null()) {
+    M_insist(schema == schema.drop_constants().deduplicate(), "schema of `ScanOperator` must not contain NULL or duplicates");
+    M_insist(not table.layout().is_finite(), "layout for `wasm::IndexScan` must be infinite");
+
+    /*----- Index scan does not support SIMD. -----*/
+    CodeGenContext::Get().set_num_simd_lanes(1);
+
+    /*----- If no key qualifies, no tuple must be loaded. -----*/
+    if (range.empty()) {
+        setup();
+        teardown();
+        return;
+    }
+
+    /*----- Look up the positions of the first qualifying and the first non-qualifying entry in the index. -----*/
+    const uint32_t index_id = range.index->id;
+    Var<U32x1> begin(Module::Get().emit_call<uint32_t>("index_lower_bound", U32x1(index_id), I64x1(range.lower)));
+    const Var<U32x1> end(Module::Get().emit_call<uint32_t>("index_upper_bound", U32x1(index_id), I64x1(range.upper)));
+
+    /*----- Import the base address of the mapped memory. -----*/
+    std::ostringstream oss;
+    oss << table.name << "_mem";
+    Ptr<void> base_address = Module::Get().get_global<void*>(oss.str().c_str());
+
+    /*----- Pre-allocate memory for a batch of row IDs copied from the index. -----*/
+    Ptr<U32x1> row_ids = Module::Allocator().pre_malloc<uint32_t>(ROW_ID_BATCH_SIZE);
+
+    /*----- Emit setup code. -----*/
+    setup();
+
+    /*----- Generate the loop over all batches of row IDs and, nested, the loop loading the tuple of each row ID by a
+     * point access, with the residual filter, the sideways filters, and the pipeline emitted into the inner loop
+     * body. -----*/
+    const auto layout_schema = table.schema(M.scan.alias());
+    WHILE (begin < end) {
+        const Var<U32x1> batch_begin(begin.val());
+        const Var<U32x1> batch_end(Select(end - begin > ROW_ID_BATCH_SIZE, begin + ROW_ID_BATCH_SIZE, end.val()));
+        Module::Get().emit_call<void>("index_row_ids", U32x1(index_id), batch_begin.val(), batch_end.val(),
+                                      row_ids.clone().to<void*>());
+        WHILE (begin < batch_end) {
+            auto S = CodeGenContext::Get().scoped_environment();
+            const Var<U32x1> row_id(*(row_ids.clone() + (begin - batch_begin).make_signed()));
+            compile_load_point_access(schema, base_address.clone(), table.layout(), layout_schema, row_id.val());
+            std::optional<Boolx1> pass;
+            if (not range.residual.empty())
+                pass.emplace(CodeGenContext::Get().env().compile<_Boolx1>(range.residual).is_true_and_not_null());
+            if (auto sideways = compile_sideways_filters(M.scan))
+                pass.emplace(pass ? *pass and *sideways : std::move(*sideways));
+            if (pass) {
+                IF (*pass) {
                     pipeline();
                 };
+            } else {
+                pipeline();
             }
-        },
-        /* teardown= */ std::move(teardown)
-    );
+            begin += 1U;
+        }
+    }
+    base_address.discard(); // since it was only cloned
+    row_ids.discard(); // since it was only cloned
+
+    /*----- Emit teardown code. -----*/
+    teardown();
 }
 
 
 /*======================================================================================================================
- * LazyDisjunctiveFilter
+ * Late Materializing Scan
  *====================================================================================================================*/
 
-ConditionSet LazyDisjunctiveFilter::pre_condition(std::size_t child_idx, const std::tuple<const FilterOperator*>&)
+std::pair<Schema, Schema> LateMaterializingScan::Split_Schema(const FilterOperator &filter, const ScanOperator &scan)
 {
-     M_insist(child_idx == 0);
+    const Schema required = filter.filter().get_required();
+    Schema predicate_schema, payload_schema;
+    for (auto &e : scan.schema().drop_constants().deduplicate()) {
+        if (required.has(e.id))
+            predicate_schema.add(e);
+        else
+            payload_schema.add(e);
+    }
+    return { std::move(predicate_schema), std::move(payload_schema) };
+}
+
+ConditionSet LateMaterializingScan::pre_condition(std::size_t child_idx,
+                                                  const std::tuple<const FilterOperator*, const ScanOperator*>
+                                                      &partial_inner_nodes)
+{
+    M_insist(child_idx == 0);
 
     ConditionSet pre_cond;
 
-    /*----- Lazy disjunctive filter does not support SIMD. -----*/
-    pre_cond.add_condition(NoSIMD());
+    auto &filter = *std::get<0>(partial_inner_nodes);
+    auto &scan = *std::get<1>(partial_inner_nodes);
+    auto &table = scan.store().table();
+
+    if (options::wasm_late_materialization == options::LM_NEVER) {
+        pre_cond.add_condition(Unsatisfiable());
+        return pre_cond;
+    }
+
+    /*----- Late materialization requires both attributes referenced by the filter and payload. -----*/
+    auto [predicate_schema, payload_schema] = Split_Schema(filter, scan);
+    if (predicate_schema.num_entries() == 0 or payload_schema.num_entries() == 0) {
+        pre_cond.add_condition(Unsatisfiable());
+        return pre_cond;
+    }
+
+    /*----- Late materialization only saves loading the payload if the data layout stores the values of each attribute
+     * consecutively, i.e.\ if the stride of each leaf equals the size of its values.  Otherwise, the payload of a tuple
+     * is typically located in the same cache line as the attributes referenced by the filter. -----*/
+    const auto num_attrs = table.num_attrs();
+    bool is_consecutive = true;
+    table.layout().for_sibling_leaves([&](const std::vector<DataLayout::leaf_info_t> &leaves,
+                                          const DataLayout::level_info_stack_t&, uint64_t)
+    {
+        for (auto &leaf_info : leaves) {
+            if (leaf_info.leaf.index() != num_attrs and leaf_info.stride_in_bits != leaf_info.leaf.type()->size())
+                is_consecutive = false;
+        }
+    });
+    if (not is_consecutive)
+        pre_cond.add_condition(Unsatisfiable());
 
     return pre_cond;
 }
 
-double LazyDisjunctiveFilter::cost(const Match<LazyDisjunctiveFilter> &M)
+ConditionSet LateMaterializingScan::post_condition(const Match<LateMaterializingScan>&)
 {
-    const cnf::CNF &cond = M.filter.filter();
-    M_insist(cond.size() == 1, "disjunctive filter condition must be a single clause");
-    return cond[0].size() / 2.0; // on avg. half the number of predicates in the clause XXX consider selectivities
+    ConditionSet post_cond;
+
+    /*----- Late materializing scan does not introduce predication. -----*/
+    post_cond.add_condition(Predicated(false));
+
+    /*----- Late materializing scan does not introduce SIMD. -----*/
+    post_cond.add_condition(NoSIMD());
+
+    return post_cond;
 }
 
-void LazyDisjunctiveFilter::execute(const Match<LazyDisjunctiveFilter> &M, setup_t setup, pipeline_t pipeline,
+double LateMaterializingScan::cost(const Match<LateMaterializingScan> &M)
+{
+    if (options::wasm_late_materialization == options::LM_ALWAYS)
+        return 0; // cheaper than any other implementation of the filter and the scan
+
+    /*----- The attributes referenced by the filter are loaded sequentially for every tuple, like by a scalar scan, and
+     * the payload is loaded by point accesses, which are costlier than sequential loads, only for qualifying tuples.
+     * Without estimates, all tuples are assumed to qualify. -----*/
+    double selectivity = 1.0;
+    if (M.filter.has_info() and M.scan.has_info() and M.scan.info().estimated_cardinality > 0)
+        selectivity = std::min(M.filter.info().estimated_cardinality / M.scan.info().estimated_cardinality, 1.0);
+    const double num_entries = M.predicate_schema.num_entries() + M.payload_schema.num_entries();
+    const double payload_fraction = M.payload_schema.num_entries() / num_entries;
+    const unsigned filter_cost = std::accumulate(M.filter.filter().cbegin(), M.filter.filter().cend(), 0U,
+                                                 [](unsigned cost, const cnf::Clause &clause) {
+        return cost + clause.size();
+    });
+    return filter_cost + 2.0 * (1.0 - payload_fraction) + 4.0 * selectivity * payload_fraction;
+}
+
+void LateMaterializingScan::execute(const Match<LateMaterializingScan> &M, setup_t setup, pipeline_t pipeline,
                                     teardown_t teardown)
 {
-    const cnf::Clause &clause = M.filter.filter()[0];
+    auto &table = M.scan.store().table();
 
-    M.child.execute(
-        /* setup=    */ std::move(setup),
-        /* pipeline= */ [&, pipeline=std::move(pipeline)](){
-            M_insist(CodeGenContext::Get().num_simd_lanes() == 1, "invalid number of SIMD lanes");
-            BLOCK(lazy_disjunctive_filter)
-            {
-                BLOCK(lazy_disjunctive_filter_then)
-                {
-                    for (const cnf::Predicate &pred : clause) {
-                        auto cond = CodeGenContext::Get().env().compile<_Boolx1>(*pred);
-                        if (pred.negative())
-                            GOTO(cond.is_false_and_not_null(), lazy_disjunctive_filter_then); // break to remainder of pipline
-                        else
-                            GOTO(cond.is_true_and_not_null(), lazy_disjunctive_filter_then); // break to remainder of pipline
-                    }
-                    GOTO(lazy_disjunctive_filter); // skip pipeline
-                }
-                pipeline();
-            }
-        },
-        /* teardown= */ std::move(teardown)
-    );
-}
+    M_insist(not table.layout().is_finite(), "layout for `wasm::LateMaterializingScan` must be infinite");
 
+    /*----- Late materializing scan does not support SIMD. -----*/
+    CodeGenContext::Get().set_num_simd_lanes(1);
 
-/*======================================================================================================================
- * Projection
- *====================================================================================================================*/
+    Var<U32x1> tuple_id; // default initialized to 0
 
-ConditionSet Projection::pre_condition(
+    /*----- Import the number of rows of `table`. -----*/
+    std::ostringstream oss;
+    oss << table.name << "_num_rows";
+    U32x1 num_rows = Module::Get().get_global<uint32_t>(oss.str().c_str());
+
+    /*----- Import the base address of the mapped memory. -----*/
+    oss.str("");
+    oss << table.name << "_mem";
+    Ptr<void> base_address = Module::Get().get_global<void*>(oss.str().c_str());
+
+    /*----- Emit setup code *before* compiling data layout to not overwrite its temporary boolean variables. -----*/
+    setup();
+
+    /*----- Decide the clauses of the filter that reference only a dictionary encoded attribute by the codes of this
+     * attribute, like `wasm::Scan`. -----*/
+    QualifyingCodes codes(M.scan, &M.filter);
+    const cnf::CNF residual = residual_of_dictionary_filters(M.filter.filter(), table);
+
+    /*----- Compile data layout to generate sequential load of the attributes referenced by the filter. -----*/
+    const auto layout_schema = table.schema(M.scan.alias());
+    auto [inits, loads, jumps] = compile_load_sequential(M.predicate_schema, base_address.clone(), table.layout(), 1,
+                                                         layout_schema, tuple_id);
+
+    /*----- Generate the loop for the scan of all tuples.  The payload of a tuple is loaded by a point access and the
+     * pipeline is resumed only if the tuple satisfies the filter and all sideways filters installed on this scan.
+     * The latter may read the payload.  Skip the zones of the table which the filter rejects as a whole, as proven
+     * by the table's zone map, like `wasm::Scan`. -----*/
+    auto resume_pipeline = [&](){
+        std::optional<Boolx1> pass = codes.qualify(layout_schema);
+        if (not residual.empty()) {
+            Boolx1 satisfied = CodeGenContext::Get().env().compile<_Boolx1>(residual).is_true_and_not_null();
+            pass.emplace(pass ? *pass and satisfied : std::move(satisfied));
+        }
+        M_insist(bool(pass), "the filter must not be empty");
+        IF (*pass) {
+            compile_load_point_access(M.payload_schema, base_address.clone(), table.layout(), layout_schema,
+                                      tuple_id.val());
+            if (auto sideways = compile_sideways_filters(M.scan)) {
+                IF (*sideways) {
+                    pipeline();
+                };
+            } else {
+                pipeline();
+            }
+        };
+    };
+    const bool prune_zones = is_prunable_by_zone_map(M.filter.filter(), table);
+    emit_scan_loop(M.scan, prune_zones, tuple_id, std::move(num_rows), inits, loads, jumps, resume_pipeline);
+    codes.free();
+    base_address.discard(); // since it was only cloned
+
+    /*----- Emit teardown code. -----*/
+    teardown();
+}
+
+
+/*======================================================================================================================
+ * Filter
+ *====================================================================================================================*/
+
+template<bool Predicated>
+ConditionSet Filter<Predicated>::pre_condition(std::size_t child_idx, const std::tuple<const FilterOperator*>&)
+{
+     M_insist(child_idx == 0);
+
+    ConditionSet pre_cond;
+
+    if constexpr (not Predicated) {
+        /*----- Branching filter does not support SIMD. -----*/
+        pre_cond.add_condition(NoSIMD());
+    }
+
+    return pre_cond;
+}
+
+template<bool Predicated>
+ConditionSet Filter<Predicated>::adapt_post_condition(const Match<Filter>&, const ConditionSet &post_cond_child)
+{
+    ConditionSet post_cond(post_cond_child);
+
+    if constexpr (Predicated) {
+        /*----- Predicated filter introduces predication. -----*/
+        post_cond.add_or_replace_condition(m::Predicated(true));
+    }
+
+    return post_cond;
+}
+
+template<bool Predicated>
+double Filter<Predicated>::cost(const Match<Filter> &M)
+{
+    const cnf::CNF &cond = M.filter.filter();
+    const unsigned cost = std::accumulate(cond.cbegin(), cond.cend(), 0U, [](unsigned cost, const cnf::Clause &clause) {
+        return cost + clause.size();
+    });
+    return cost * (Predicated ? 2.0 : 1.0);
+}
+
+namespace {
+
+/** Evaluates the *terms* of a condition, i.e.\ either the clauses of a conjunction or the predicates of a disjunction,
+ * in an order adapted at runtime rather than in the fixed order of the query.  On the first
+ * `options::wasm_adaptive_filter_sample_size` tuples, all terms are evaluated and the tuples satisfying each term are
+ * counted.  Afterwards, the terms are evaluated short-circuit, starting with the term deciding the condition for most
+ * tuples relative to its cost, i.e.\ the term most often unsatisfied in a conjunction or satisfied in a disjunction.
+ * One evaluation order per term to start with is compiled ahead and the order to use is selected by a global. */
+class AdaptiveCondition
+{
+    bool is_conjunction_; ///< whether the terms are conjoined or disjoined
+    std::vector<uint64_t> weights_; ///< per term, the reciprocal of its cost, scaled to an integer
+    Global<U32x1> num_sampled_; ///< the number of tuples sampled so far; default initialized to 0
+    std::vector<Global<U32x1>> num_satisfied_; ///< per term, the number of sampled tuples satisfying it
+    Global<U32x1> first_; ///< the index of the term to evaluate first after sampling
+
+    public:
+    /** Creates an adaptive condition of terms of costs \p costs, which are conjoined iff \p is_conjunction. */
+    AdaptiveCondition(bool is_conjunction, const std::vector<unsigned> &costs)
+        : is_conjunction_(is_conjunction)
+        , num_satisfied_(costs.size()) // construct in place since globals must not be moved
+    {
+        M_insist(costs.size() >= 2, "adaptive condition requires at least two terms");
+        uint64_t costs_lcm = 1;
+        for (auto cost : costs)
+            costs_lcm = std::lcm(costs_lcm, std::max(cost, 1U));
+        for (auto cost : costs)
+            weights_.push_back(costs_lcm / std::max(cost, 1U));
+    }
+
+    /** Returns the number of terms. */
+    std::size_t num_terms() const { return weights_.size(); }
+
+    /** Emits code evaluating the condition for the current tuple and returns whether the tuple satisfies it.  \p term
+     * emits code evaluating the term of the given index and returns whether the tuple satisfies the term. */
+    Boolx1 evaluate(const std::function<Boolx1(std::size_t)> &term) {
+        const uint32_t sample_size = options::wasm_adaptive_filter_sample_size;
+        Var<Boolx1> res(not is_conjunction_);
+
+        IF (num_sampled_ < sample_size) {
+            /*----- Sample the tuple by evaluating all terms. -----*/
+            Var<Boolx1> sampled(is_conjunction_);
+            for (std::size_t i = 0; i != num_terms(); ++i) {
+                const Var<Boolx1> satisfied(term(i));
+                num_satisfied_[i] += satisfied.val().to<uint32_t>();
+                if (is_conjunction_)
+                    sampled = sampled and satisfied;
+                else
+                    sampled = sampled or satisfied;
+            }
+            res = sampled;
+            num_sampled_ += 1U;
+
+            /*----- After the last sampled tuple, choose the term to evaluate first. -----*/
+            IF (num_sampled_ == sample_size) {
+                auto score = [&](std::size_t i) -> U64x1 {
+                    U32x1 num_decided = is_conjunction_ ? U32x1(sample_size) - num_satisfied_[i].val()
+                                                         : num_satisfied_[i].val();
+                    return num_decided.to<uint64_t>() * weights_[i];
+                };
+                Var<U64x1> best_score(score(0));
+                first_ = 0U;
+                for (std::size_t i = 1; i != num_terms(); ++i) {
+                    const Var<U64x1> score_i(score(i));
+                    IF (score_i > best_score) {
+                        best_score = score_i;
+                        first_ = uint32_t(i);
+                    };
+                }
+            };
+        } ELSE {
+            /*----- Evaluate the terms short-circuit in the order starting with the chosen term. -----*/
+            for (std::size_t first = 0; first != num_terms(); ++first) {
+                IF (first_ == uint32_t(first)) {
+                    BLOCK(adaptive_condition) {
+                        for (std::size_t j = 0; j != num_terms(); ++j) {
+                            const std::size_t i = j == 0 ? first : (j <= first ? j - 1 : j);
+                            if (is_conjunction_)
+                                GOTO(not term(i), adaptive_condition); // break since the condition is unsatisfied
+                            else
+                                GOTO(term(i), adaptive_condition); // break since the condition is satisfied
+                        }
+                        res = is_conjunction_; // all terms evaluated without short-circuit
+                    }
+                };
+            }
+        };
+
+        return res;
+    }
+};
+
+/** Returns the clauses of \p filter that remain to be evaluated in the current pipeline.  If \p filter is directly above
+ * a scan emitting scalar code, the scan already discards the tuples not satisfying the clauses decided by dictionary
+ * codes, see `Scan::execute()`. */
+cnf::CNF residual_filter(const FilterOperator &filter)
+{
+    auto scan = cast<const ScanOperator>(filter.child(0));
+    if (scan and CodeGenContext::Get().num_simd_lanes() == 1)
+        return residual_of_dictionary_filters(filter.filter(), scan->store().table());
+    return filter.filter();
+}
+
+}
+
+template<bool Predicated>
+void Filter<Predicated>::execute(const Match<Filter> &M, setup_t setup, pipeline_t pipeline, teardown_t teardown)
+{
+    /*----- Set minimal number of SIMD lanes preferred to get fully utilized SIMD vectors for the filter condition. --*/
+    CodeGenContext::Get().update_num_simd_lanes_preferred(16); // set own preference
+
+    std::optional<AdaptiveCondition> adaptive; ///< the adaptive order of the clauses of a branching filter, if used
+
+    /*----- Execute filter. -----*/
+    M.child.execute(
+        /* setup=    */ std::move(setup),
+        /* pipeline= */ [&, pipeline=std::move(pipeline)](){
+            const cnf::CNF filter = residual_filter(M.filter);
+            if (filter.empty()) {
+                pipeline(); // all clauses are already decided by the scan below
+                return;
+            }
+            if constexpr (Predicated) {
+                CodeGenContext::Get().env().add_predicate(filter);
+                pipeline();
+            } else {
+                M_insist(CodeGenContext::Get().num_simd_lanes() == 1, "invalid number of SIMD lanes");
+                if (options::wasm_adaptive_filter_sample_size and filter.size() >= 2) {
+                    /*----- Evaluate the clauses in the order adapted to their pass rates sampled at runtime. -----*/
+                    if (not adaptive) {
+                        std::vector<unsigned> costs;
+                        for (auto &clause : filter)
+                            costs.push_back(clause.size());
+                        adaptive.emplace(/* is_conjunction= */ true, costs);
+                    }
+                    M_insist(adaptive->num_terms() == filter.size());
+                    auto clause_satisfied = [&](std::size_t idx) -> Boolx1 {
+                        return CodeGenContext::Get().env().compile<_Boolx1>(cnf::CNF({ filter[idx] }))
+                                                          .is_true_and_not_null();
+                    };
+                    IF (adaptive->evaluate(clause_satisfied)) {
+                        pipeline();
+                    };
+                } else {
+                    IF (CodeGenContext::Get().env().compile<_Boolx1>(filter).is_true_and_not_null()) {
+                        pipeline();
+                    };
+                }
+            }
+        },
+        /* teardown= */ std::move(teardown)
+    );
+}
+
+
+/*======================================================================================================================
+ * LazyDisjunctiveFilter
+ *====================================================================================================================*/
+
+ConditionSet LazyDisjunctiveFilter::pre_condition(std::size_t child_idx, const std::tuple<const FilterOperator*>&)
+{
+     M_insist(child_idx == 0);
+
+    ConditionSet pre_cond;
+
+    /*----- Lazy disjunctive filter does not support SIMD. -----*/
+    pre_cond.add_condition(NoSIMD());
+
+    return pre_cond;
+}
+
+double LazyDisjunctiveFilter::cost(const Match<LazyDisjunctiveFilter> &M)
+{
+    const cnf::CNF &cond = M.filter.filter();
+    M_insist(cond.size() == 1, "disjunctive filter condition must be a single clause");
+    return cond[0].size() / 2.0; // on avg. half the number of predicates in the clause XXX consider selectivities
+}
+
+void LazyDisjunctiveFilter::execute(const Match<LazyDisjunctiveFilter> &M, setup_t setup, pipeline_t pipeline,
+                                    teardown_t teardown)
+{
+    const cnf::Clause &clause = M.filter.filter()[0];
+
+    std::optional<AdaptiveCondition> adaptive; ///< the adaptive order of the predicates, if used
+
+    M.child.execute(
+        /* setup=    */ std::move(setup),
+        /* pipeline= */ [&, pipeline=std::move(pipeline)](){
+            M_insist(CodeGenContext::Get().num_simd_lanes() == 1, "invalid number of SIMD lanes");
+            if (residual_filter(M.filter).empty()) {
+                pipeline(); // the clause is already decided by the scan below
+                return;
+            }
+            auto pred_satisfied = [&](const cnf::Predicate &pred) -> Boolx1 {
+                auto cond = CodeGenContext::Get().env().compile<_Boolx1>(*pred);
+                return pred.negative() ? cond.is_false_and_not_null() : cond.is_true_and_not_null();
+            };
+            if (options::wasm_adaptive_filter_sample_size and clause.size() >= 2) {
+                /*----- Evaluate the predicates in the order adapted to their pass rates sampled at runtime. -----*/
+                if (not adaptive)
+                    adaptive.emplace(/* is_conjunction= */ false, std::vector<unsigned>(clause.size(), 1U));
+                IF (adaptive->evaluate([&](std::size_t idx) { return pred_satisfied(clause[idx]); })) {
+                    pipeline();
+                };
+                return;
+            }
+            BLOCK(lazy_disjunctive_filter)
+            {
+                BLOCK(lazy_disjunctive_filter_then)
+                {
+                    for (const cnf::Predicate &pred : clause)
+                        GOTO(pred_satisfied(pred), lazy_disjunctive_filter_then); // break to remainder of pipline
+                    GOTO(lazy_disjunctive_filter); // skip pipeline
+                }
+                pipeline();
+            }
+        },
+        /* teardown= */ std::move(teardown)
+    );
+}
+
+
+/*======================================================================================================================
+ * Projection
+ *====================================================================================================================*/
+
+ConditionSet Projection::pre_condition(
     std::size_t child_idx,
     const std::tuple<const ProjectionOperator*> &partial_inner_nodes)
 {
@@ -869,26 +1664,80 @@ ConditionSet HashBasedGrouping::post_condition(const Match<HashBasedGrouping>&)
     return post_cond;
 }
 
-void HashBasedGrouping::execute(const Match<HashBasedGrouping> &M, setup_t setup, pipeline_t pipeline,
-                                teardown_t teardown)
+namespace {
+
+/** Returns the minimum and maximum value of the attribute \p attr as summarized by the zone map of its table, or
+ * `std::nullopt` if \p attr is nullable or not of integral type, its table has a finite data layout, or its table is
+ * empty.  Since the zone map is maintained incrementally, only rows appended since its last use are read.  Values are
+ * read by the zone map's `AttributeReader` and thus decoded, e.g. from frame-of-reference compression. */
+std::optional<std::pair<int64_t, int64_t>> attribute_min_max(const Attribute &attr)
+{
+    if (not attr.not_nullable or not attr.type->is_integral())
+        return std::nullopt;
+    if (attr.table.layout().is_finite())
+        return std::nullopt; // zones are only defined for infinite data layouts
+
+    auto &zone_map = attr.table.store().zone_map();
+    if (zone_map.num_zones() == 0)
+        return std::nullopt;
+
+    int64_t min = std::numeric_limits<int64_t>::max();
+    int64_t max = std::numeric_limits<int64_t>::lowest();
+    for (std::size_t zone = 0; zone != zone_map.num_zones(); ++zone) {
+        auto &s = zone_map.summary(attr, zone);
+        min = std::min(min, s.min);
+        max = std::max(max, s.max);
+    }
+    return std::make_pair(min, max);
+}
+
+/** Returns the domain of the grouping key of \p grouping as its minimum and the number of values between the minimum
+ * and maximum (both including) of the grouped attribute, or `std::nullopt` if \p grouping does not group on a single
+ * attribute with known minimum and maximum. */
+std::optional<std::pair<int64_t, uint64_t>> grouping_key_domain(const GroupingOperator &grouping)
+{
+    if (grouping.group_by().size() != 1)
+        return std::nullopt;
+    auto designator = cast<const Designator>(&grouping.group_by()[0].first.get());
+    if (not designator)
+        return std::nullopt;
+    auto attr = std::get_if<const Attribute*>(&designator->target());
+    if (not attr)
+        return std::nullopt;
+    auto min_max = attribute_min_max(**attr);
+    if (not min_max)
+        return std::nullopt;
+    const uint64_t range = uint64_t(min_max->second) - uint64_t(min_max->first); // no overflow of unsigned arithmetic
+    if (range == std::numeric_limits<uint64_t>::max())
+        return std::nullopt;
+    return std::make_pair(min_max->first, range + 1);
+}
+
+/** Emits code to group the tuples produced by \p child according to \p grouping using a hash table.  If \p domain is
+ * given as the minimum and the size of the domain of the single integral key, the hash table is directly addressed by
+ * the key minus the minimum, i.e. it is an array with one entry of aggregates per key of the domain. */
+void execute_hash_based_grouping(const GroupingOperator &grouping, const MatchBase &child,
+                                 std::optional<std::pair<int64_t, uint32_t>> domain, setup_t setup, pipeline_t pipeline,
+                                 teardown_t teardown)
 {
     // TODO: determine setup
     using PROBING_STRATEGY = QuadraticProbing;
     constexpr bool USE_CHAINED_HASHING = false;
+    constexpr bool USE_CONTROL_BYTES = true;
     constexpr uint64_t AGGREGATES_SIZE_THRESHOLD_IN_BITS = std::numeric_limits<uint64_t>::infinity();
     constexpr double HIGH_WATERMARK = 0.7;
 
-    const auto num_keys = M.grouping.group_by().size();
+    const auto num_keys = grouping.group_by().size();
 
     /*----- Compute hash table schema and information about aggregates, especially AVG aggregates. -----*/
     Schema ht_schema;
     /* Add key(s). */
     for (std::size_t i = 0; i < num_keys; ++i) {
-        auto &e = M.grouping.schema()[i];
+        auto &e = grouping.schema()[i];
         ht_schema.add(e.id, e.type, e.constraints);
     }
     /* Add payload. */
-    auto p = compute_aggregate_info(M.grouping.aggregates(), M.grouping.schema(), num_keys);
+    auto p = compute_aggregate_info(grouping.aggregates(), grouping.schema(), num_keys);
     const auto &aggregates = p.first;
     const auto &avg_aggregates = p.second;
     uint64_t aggregates_size_in_bits = 0;
@@ -899,9 +1748,11 @@ void HashBasedGrouping::execute(const Match<HashBasedGrouping> &M, setup_t setup
 
     /*----- Compute initial capacity of hash table. -----*/
     uint32_t initial_capacity;
-    if (M.grouping.has_info())
-        initial_capacity = std::ceil(M.grouping.info().estimated_cardinality / HIGH_WATERMARK);
-    else if (auto scan = cast<const ScanOperator>(M.grouping.child(0)))
+    if (domain)
+        initial_capacity = domain->second; // one slot per key of the domain, never grows
+    else if (grouping.has_info())
+        initial_capacity = std::ceil(grouping.info().estimated_cardinality / HIGH_WATERMARK);
+    else if (auto scan = cast<const ScanOperator>(grouping.child(0)))
         initial_capacity = std::ceil(scan->store().num_rows() / HIGH_WATERMARK);
     else
         initial_capacity = 1024; // fallback
@@ -921,6 +1772,10 @@ void HashBasedGrouping::execute(const Match<HashBasedGrouping> &M, setup_t setup
             ht = std::make_unique<GlobalOpenAddressingOutOfPlaceHashTable>(ht_schema, std::move(key_indices),
                                                                            initial_capacity);
         as<OpenAddressingHashTableBase>(*ht).set_probing_strategy<PROBING_STRATEGY>();
+        if (domain)
+            as<OpenAddressingHashTableBase>(*ht).set_direct_addressing(domain->first, domain->second);
+        else if (USE_CONTROL_BYTES)
+            as<OpenAddressingHashTableBase>(*ht).set_control_bytes();
     }
 
     /*----- Create child function. -----*/
@@ -930,7 +1785,7 @@ void HashBasedGrouping::execute(const Match<HashBasedGrouping> &M, setup_t setup
 
         std::optional<HashTable::entry_t> dummy; ///< *local* dummy slot
 
-        M.child.execute(
+        child.execute(
             /* setup=    */ setup_t::Make_Without_Parent([&](){
                 ht->setup();
                 ht->set_high_watermark(HIGH_WATERMARK);
@@ -942,7 +1797,7 @@ void HashBasedGrouping::execute(const Match<HashBasedGrouping> &M, setup_t setup
 
                 /*----- Insert key if not yet done. -----*/
                 std::vector<SQL_t> key;
-                for (auto &p : M.grouping.group_by())
+                for (auto &p : grouping.group_by())
                     key.emplace_back(env.compile(p.first.get()));
                 auto [entry, inserted] = ht->try_emplace(std::move(key));
 
@@ -1235,12 +2090,12 @@ void HashBasedGrouping::execute(const Match<HashBasedGrouping> &M, setup_t setup
         /*----- Compute key schema to detect duplicated keys. -----*/
         Schema key_schema;
         for (std::size_t i = 0; i < num_keys; ++i) {
-            auto &e = M.grouping.schema()[i];
+            auto &e = grouping.schema()[i];
             key_schema.add(e.id, e.type, e.constraints);
         }
 
         /*----- Add computed group tuples to current environment. ----*/
-        for (auto &e : M.grouping.schema().deduplicate()) {
+        for (auto &e : grouping.schema().deduplicate()) {
             try {
                 key_schema.find(e.id);
             } catch (invalid_argument&) {
@@ -1299,6 +2154,57 @@ void HashBasedGrouping::execute(const Match<HashBasedGrouping> &M, setup_t setup
     teardown_t(std::move(teardown), [&](){ ht->teardown(); })();
 }
 
+}
+
+void HashBasedGrouping::execute(const Match<HashBasedGrouping> &M, setup_t setup, pipeline_t pipeline,
+                                teardown_t teardown)
+{
+    execute_hash_based_grouping(M.grouping, M.child, std::nullopt, std::move(setup), std::move(pipeline),
+                                std::move(teardown));
+}
+
+ConditionSet IdentityHashGrouping::pre_condition(std::size_t child_idx,
+                                                 const std::tuple<const GroupingOperator*> &partial_inner_nodes)
+{
+    M_insist(child_idx == 0);
+
+    ConditionSet pre_cond;
+
+    /*----- Identity hash grouping can only be used for a single key with a small domain. -----*/
+    auto domain = grouping_key_domain(*std::get<0>(partial_inner_nodes));
+    if (not domain or domain->second > MAX_DOMAIN_SIZE) {
+        pre_cond.add_condition(Unsatisfiable());
+        return pre_cond;
+    }
+
+    /*----- Identity hash grouping does not support SIMD. -----*/
+    pre_cond.add_condition(NoSIMD());
+
+    return pre_cond;
+}
+
+ConditionSet IdentityHashGrouping::post_condition(const Match<IdentityHashGrouping>&)
+{
+    ConditionSet post_cond;
+
+    /*----- Identity hash grouping does not introduce predication (it is already handled by the hash table). -----*/
+    post_cond.add_condition(Predicated(false));
+
+    /*----- Identity hash grouping does not introduce SIMD. -----*/
+    post_cond.add_condition(NoSIMD());
+
+    return post_cond;
+}
+
+void IdentityHashGrouping::execute(const Match<IdentityHashGrouping> &M, setup_t setup, pipeline_t pipeline,
+                                   teardown_t teardown)
+{
+    auto domain = grouping_key_domain(M.grouping);
+    M_insist(domain and domain->second <= MAX_DOMAIN_SIZE);
+    execute_hash_based_grouping(M.grouping, M.child, std::make_pair(domain->first, uint32_t(domain->second)),
+                                std::move(setup), std::move(pipeline), std::move(teardown));
+}
+
 ConditionSet OrderedGrouping::pre_condition(
     std::size_t child_idx,
     const std::tuple<const GroupingOperator*> &partial_inner_nodes)
@@ -3088,9 +3994,11 @@ void Sorting::execute(const Match<Sorting> &M, setup_t setup, pipeline_t pipelin
     M_insist(bool(M.materializing_factory), "`wasm::Sorting` must have a factory for the materialized child");
     const auto buffer_schema = M.sorting.child(0)->schema().drop_constants().deduplicate();
     const auto sorting_schema = M.sorting.schema().drop_constants().deduplicate();
-    GlobalBuffer buffer(
-        buffer_schema, *M.materializing_factory, false, 0, std::move(setup), std::move(pipeline), std::move(teardown)
-    );
+    const bool use_radix_sort =
+        not options::wasm_quicksort and supports_radix_sort(buffer_schema, M.sorting.order_by());
+    GlobalBuffer buffer = use_radix_sort ? GlobalBuffer(buffer_schema, *M.materializing_factory) // resumed below
+                                         : GlobalBuffer(buffer_schema, *M.materializing_factory, false, 0,
+                                                        std::move(setup), std::move(pipeline), std::move(teardown));
 
     /*----- Create child function. -----*/
     FUNCTION(sorting_child_pipeline, void(void)) // create function for pipeline
@@ -3105,11 +4013,23 @@ void Sorting::execute(const Match<Sorting> &M, setup_t setup, pipeline_t pipelin
     }
     sorting_child_pipeline(); // call child function
 
-    /*----- Invoke sorting algorithm with buffer to sort. -----*/
-    quicksort(buffer, M.sorting.order_by());
+    if (use_radix_sort) {
+        /*----- Sort normalized keys and process the buffer by gathering its tuples in sorted order. -----*/
+        auto load = buffer.create_load_proxy(sorting_schema);
+        setup();
+        radix_sort(buffer, M.sorting.order_by(), [&](U32x1 tuple_id){
+            auto S = CodeGenContext::Get().scoped_environment();
+            load(tuple_id);
+            pipeline();
+        });
+        teardown();
+    } else {
+        /*----- Invoke sorting algorithm with buffer to sort. -----*/
+        quicksort(buffer, M.sorting.order_by());
 
-    /*----- Process sorted buffer. -----*/
-    buffer.resume_pipeline(sorting_schema);
+        /*----- Process sorted buffer. -----*/
+        buffer.resume_pipeline(sorting_schema);
+    }
 }
 
 ConditionSet NoOpSorting::pre_condition(std::size_t child_idx,
@@ -3142,10 +4062,18 @@ void NoOpSorting::execute(const Match<NoOpSorting> &M, setup_t setup, pipeline_t
  *====================================================================================================================*/
 
 template<bool Predicated>
-ConditionSet NestedLoopsJoin<Predicated>::pre_condition(std::size_t, const std::tuple<const JoinOperator*>&)
+ConditionSet NestedLoopsJoin<Predicated>::pre_condition(std::size_t,
+                                                        const std::tuple<const JoinOperator*> &partial_inner_nodes)
 {
     ConditionSet pre_cond;
 
+    /*----- Nested-loops join can only be used for inner joins. -----*/
+    auto &join = *std::get<0>(partial_inner_nodes);
+    if (join.is_semi_or_anti()) {
+        pre_cond.add_condition(Unsatisfiable());
+        return pre_cond;
+    }
+
     /*----- Nested-loops join does not support SIMD. -----*/
     pre_cond.add_condition(NoSIMD());
 
@@ -3266,9 +4194,9 @@ ConditionSet SimpleHashJoin<UniqueBuild, Predicated>::pre_condition(
 {
     ConditionSet pre_cond;
 
-    /*----- Simple hash join can only be used for binary joins on equi-predicates. -----*/
+    /*----- Simple hash join can only be used for binary inner joins on equi-predicates. -----*/
     auto &join = *std::get<0>(partial_inner_nodes);
-    if (not join.predicate().is_equi()) {
+    if (join.is_semi_or_anti() or not join.predicate().is_equi()) {
         pre_cond.add_condition(Unsatisfiable());
         return pre_cond;
     }
@@ -3325,7 +4253,13 @@ ConditionSet SimpleHashJoin<UniqueBuild, Predicated>::adapt_post_conditions(
 template<bool UniqueBuild, bool Predicated>
 double SimpleHashJoin<UniqueBuild, Predicated>::cost(const Match<SimpleHashJoin> &M)
 {
-    return 1.2 * M.build.info().estimated_cardinality + M.probe.info().estimated_cardinality;
+    const double build_cardinality = M.build.info().estimated_cardinality;
+    const double cost = 1.2 * build_cardinality + M.probe.info().estimated_cardinality;
+
+    /*----- Accesses to a hash table exceeding the cache mostly miss the cache. -----*/
+    if (estimated_hash_table_size_in_bytes(M.build.schema(), build_cardinality) > HASH_TABLE_CACHE_SIZE_IN_BYTES)
+        return HASH_TABLE_CACHE_MISS_PENALTY * cost;
+    return cost;
 }
 
 template<bool UniqueBuild, bool Predicated>
@@ -3335,6 +4269,7 @@ void SimpleHashJoin<UniqueBuild, Predicated>::execute(const Match<SimpleHashJoin
     // TODO: determine setup
     using PROBING_STRATEGY = QuadraticProbing;
     constexpr bool USE_CHAINED_HASHING = false;
+    constexpr bool USE_CONTROL_BYTES = true;
     constexpr uint64_t PAYLOAD_SIZE_THRESHOLD_IN_BITS = std::numeric_limits<uint64_t>::infinity();
     constexpr double HIGH_WATERMARK = 0.7;
 
@@ -3381,126 +4316,1051 @@ void SimpleHashJoin<UniqueBuild, Predicated>::execute(const Match<SimpleHashJoin
             ht = std::make_unique<GlobalOpenAddressingOutOfPlaceHashTable>(ht_schema, std::move(build_key_indices),
                                                                            initial_capacity);
         as<OpenAddressingHashTableBase>(*ht).set_probing_strategy<PROBING_STRATEGY>();
+        if (USE_CONTROL_BYTES)
+            as<OpenAddressingHashTableBase>(*ht).set_control_bytes();
     }
 
     /*----- Create function for build child. -----*/
-    FUNCTION(simple_hash_join_child_pipeline, void(void)) // create function for pipeline
+    FUNCTION(simple_hash_join_child_pipeline, void(void)) // create function for pipeline
+    {
+        auto S = CodeGenContext::Get().scoped_environment(); // create scoped environment for this function
+
+        M.children[0].get().execute(
+            /* setup=    */ setup_t::Make_Without_Parent([&](){
+                ht->setup();
+                ht->set_high_watermark(HIGH_WATERMARK);
+            }),
+            /* pipeline= */ [&](){
+                auto &env = CodeGenContext::Get().env();
+
+                std::optional<Boolx1> build_key_not_null;
+                for (auto &build_key : build_keys) {
+                    auto val = env.get(build_key);
+                    if (build_key_not_null)
+                        build_key_not_null.emplace(*build_key_not_null and not_null(val));
+                    else
+                        build_key_not_null.emplace(not_null(val));
+                }
+                M_insist(bool(build_key_not_null));
+                IF (*build_key_not_null) { // TODO: predicated version
+                    /*----- Insert key. -----*/
+                    std::vector<SQL_t> key;
+                    for (auto &build_key : build_keys)
+                        key.emplace_back(env.extract(build_key));
+                    auto entry = ht->emplace(std::move(key));
+
+                    /*----- Insert payload. -----*/
+                    for (auto &id : payload_ids) {
+                        std::visit(overloaded {
+                            [&]<sql_type T>(HashTable::reference_t<T> &&r) -> void { r = env.extract<T>(id); },
+                            [](std::monostate) -> void { M_unreachable("invalid reference"); },
+                        }, entry.extract(id));
+                    }
+                };
+            },
+            /* teardown= */ teardown_t::Make_Without_Parent([&](){ ht->teardown(); })
+        );
+    }
+    simple_hash_join_child_pipeline(); // call child function
+
+    M.children[1].get().execute(
+        /* setup=    */ setup_t(std::move(setup), [&](){ ht->setup(); }),
+        /* pipeline= */ [&, pipeline=std::move(pipeline)](){
+            auto &env = CodeGenContext::Get().env();
+
+            auto emit_tuple_and_resume_pipeline = [&, pipeline=std::move(pipeline)](HashTable::const_entry_t entry){
+                /*----- Add found entry from hash table, i.e. from build child, to current environment. -----*/
+                for (auto &e : ht_schema) {
+                    if (not entry.has(e.id)) { // entry may not contain build key in case `ht->find()` was used
+                        M_insist(contains(build_keys, e.id));
+                        M_insist(env.has(e.id), "build key must already be contained in the current environment");
+                        continue;
+                    }
+
+                    std::visit(overloaded {
+                        [&]<typename T>(HashTable::const_reference_t<Expr<T>> &&r) -> void {
+                            Expr<T> value = r;
+                            if (value.can_be_null()) {
+                                Var<Expr<T>> var(value); // introduce variable s.t. uses only load from it
+                                env.add(e.id, var);
+                            } else {
+                                /* introduce variable w/o NULL bit s.t. uses only load from it */
+                                Var<PrimitiveExpr<T>> var(value.insist_not_null());
+                                env.add(e.id, Expr<T>(var));
+                            }
+                        },
+                        [&](HashTable::const_reference_t<NChar> &&r) -> void {
+                            NChar value(r);
+                            Var<Ptr<Charx1>> var(value.val()); // introduce variable s.t. uses only load from it
+                            env.add(e.id, NChar(var, value.can_be_null(), value.length(),
+                                                value.guarantees_terminating_nul()));
+                        },
+                        [](std::monostate) -> void { M_unreachable("invalid reference"); },
+                    }, entry.extract(e.id));
+                }
+
+                /*----- Resume pipeline. -----*/
+                pipeline();
+            };
+
+            /* TODO: may check for NULL on probe keys as well, branching + predicated version */
+            /*----- Probe with probe key. -----*/
+            std::vector<SQL_t> key;
+            for (auto &probe_key : probe_keys)
+                key.emplace_back(env.get(probe_key));
+            if constexpr (UniqueBuild) {
+                /*----- Add build key to current environment since `ht->find()` will only return the payload values. -----*/
+                for (auto build_it = build_keys.cbegin(), probe_it = probe_keys.cbegin(); build_it != build_keys.cend();
+                     ++build_it, ++probe_it)
+                {
+                    M_insist(probe_it != probe_keys.cend());
+                    env.add(*build_it, env.get(*probe_it)); // since build and probe keys match for join partners
+                }
+
+                /*----- Try to find the *single* possible join partner. -----*/
+                auto p = ht->find(std::move(key));
+                auto &entry = p.first;
+                auto &found = p.second;
+                if constexpr (Predicated) {
+                    env.add_predicate(found);
+                    emit_tuple_and_resume_pipeline(std::move(entry));
+                } else {
+                    IF (found) {
+                        emit_tuple_and_resume_pipeline(std::move(entry));
+                    };
+                }
+            } else {
+                /*----- Search for *all* join partners. -----*/
+                ht->for_each_in_equal_range(std::move(key), std::move(emit_tuple_and_resume_pipeline), Predicated);
+            }
+        },
+        /* teardown= */ teardown_t(std::move(teardown), [&](){ ht->teardown(); })
+    );
+}
+
+/*======================================================================================================================
+ * RadixPartitionedHashJoin
+ *====================================================================================================================*/
+
+namespace {
+
+/** The partitions of an input of `RadixPartitionedHashJoin`.  Each partition is a singly linked list of chunks, which
+ * is only ever appended to.  A chunk consists of a pointer to the next chunk of its partition, followed by a fixed
+ * number of tuples.  Only the last chunk of a partition may be partially filled. */
+struct partitions_t
+{
+    Ptr<U32x1> heads; ///< per partition, the address of its first chunk
+    Ptr<U32x1> tails; ///< per partition, the address of its last chunk
+    Ptr<U32x1> counts; ///< per partition, the number of its tuples
+    Global<Ptr<void>> first_chunk; ///< the chunk allocated first; default initialized to nullptr
+    Global<U32x1> num_chunks; ///< the number of chunks allocated; default initialized to 0
+
+    /** Pre-allocates the partitions for \p num_partitions partitions and emits code to make all of them empty. */
+    partitions_t(uint32_t num_partitions)
+        : heads(Module::Allocator().pre_malloc<uint32_t>(num_partitions))
+        , tails(Module::Allocator().pre_malloc<uint32_t>(num_partitions))
+        , counts(Module::Allocator().pre_malloc<uint32_t>(num_partitions))
+    {
+        Var<U32x1> partition_id(0U);
+        WHILE (partition_id < num_partitions) {
+            *(counts.clone() + partition_id.val().make_signed()) = 0U;
+            partition_id += 1U;
+        }
+    }
+
+    void discard() {
+        heads.discard(); // since it was only cloned
+        tails.discard(); // since it was only cloned
+        counts.discard(); // since it was only cloned
+    }
+};
+
+}
+
+ConditionSet RadixPartitionedHashJoin::pre_condition(
+    std::size_t,
+    const std::tuple<const JoinOperator*, const Wildcard*, const Wildcard*> &partial_inner_nodes)
+{
+    ConditionSet pre_cond;
+
+    /*----- Radix-partitioned hash join can only be used for binary inner joins on equi-predicates. -----*/
+    auto &join = *std::get<0>(partial_inner_nodes);
+    if (join.is_semi_or_anti() or not join.predicate().is_equi()) {
+        pre_cond.add_condition(Unsatisfiable());
+        return pre_cond;
+    }
+
+    /*----- Radix-partitioned hash join does not support SIMD. -----*/
+    pre_cond.add_condition(NoSIMD());
+
+    return pre_cond;
+}
+
+ConditionSet RadixPartitionedHashJoin::post_condition(const Match<RadixPartitionedHashJoin>&)
+{
+    ConditionSet post_cond;
+
+    /*----- Radix-partitioned hash join does not introduce predication (it is already handled by the hash table). ---*/
+    post_cond.add_condition(Predicated(false));
+
+    /*----- Radix-partitioned hash join does not introduce SIMD. -----*/
+    post_cond.add_condition(NoSIMD());
+
+    return post_cond;
+}
+
+double RadixPartitionedHashJoin::cost(const Match<RadixPartitionedHashJoin> &M)
+{
+    if (options::wasm_radix_partitioned_hash_join)
+        return 0; // cheaper than any other implementation of the join
+
+    const double build_cardinality = M.build.info().estimated_cardinality;
+    const double probe_cardinality = M.probe.info().estimated_cardinality;
+
+    /* Each tuple of both inputs is scattered into its partition and loaded from there again.  In return, the hash
+     * table of each build partition fits into the cache. */
+    return 1.2 * build_cardinality + probe_cardinality + (build_cardinality + probe_cardinality);
+}
+
+void RadixPartitionedHashJoin::execute(const Match<RadixPartitionedHashJoin> &M, setup_t setup, pipeline_t pipeline,
+                                       teardown_t teardown)
+{
+    // TODO: determine setup
+    using PROBING_STRATEGY = QuadraticProbing;
+    constexpr double HIGH_WATERMARK = 0.7;
+    ///> the size in bytes the hash table of a build partition should not exceed, i.e. the size of the L2 cache
+    constexpr double PARTITION_SIZE_IN_BYTES = 256 * 1024;
+    ///> limits the fan-out s.t. the write cursors of all partitions stay in the L1 cache and the TLB while scattering
+    constexpr unsigned MAX_RADIX_BITS = 10;
+    ///> the number of tuples of a chunk of a partition; a power of 2 s.t. the slot of a tuple in its chunk is cheap
+    constexpr uint32_t CHUNK_NUM_TUPLES = 256;
+    ///> the size in bytes of the pointer to the next chunk in front of the tuples of a chunk, padded to 8-byte alignment
+    constexpr uint32_t CHUNK_HEADER_SIZE_IN_BYTES = 8;
+
+    M_insist(((M.join.schema() | M.join.predicate().get_required()) & M.build.schema()) == M.build.schema());
+    M_insist(M.build.schema().drop_constants() == M.build.schema());
+    const auto build_schema = M.build.schema().deduplicate();
+    const auto probe_schema = M.probe.schema().drop_constants().deduplicate();
+
+    /*----- Decompose each clause of the join predicate of the form `A.x = B.y` into parts `A.x` and `B.y`. -----*/
+    auto p = decompose_equi_predicate(M.join.predicate(), build_schema);
+    const std::vector<Schema::Identifier> &build_keys = p.first, &probe_keys = p.second;
+
+    /*----- Compute payload IDs. -----*/
+    std::vector<Schema::Identifier> payload_ids;
+    for (auto &e : build_schema) {
+        if (not contains(build_keys, e.id))
+            payload_ids.push_back(e.id);
+    }
+
+    /*----- Compute the number of partitions s.t. the hash table of each build partition fits into the cache. -----*/
+    double build_cardinality;
+    if (M.build.has_info())
+        build_cardinality = M.build.info().estimated_cardinality;
+    else if (auto scan = cast<const ScanOperator>(&M.build))
+        build_cardinality = scan->store().num_rows();
+    else
+        build_cardinality = 1024; // fallback
+    const double num_partitions_required =
+        estimated_hash_table_size_in_bytes(build_schema, build_cardinality) / PARTITION_SIZE_IN_BYTES;
+    const unsigned num_radix_bits =
+        std::min<unsigned>(std::ceil(std::log2(std::max(num_partitions_required, 2.0))), MAX_RADIX_BITS);
+    const uint32_t num_partitions = 1U << num_radix_bits;
+
+    /*----- Emit code to compute the partition of the current tuple from the highest bits of the hash of its key.  The
+     * lowest bits of the hash remain to address the buckets of the hash table of this partition. -----*/
+    auto partition_of = [&](const std::vector<Schema::Identifier> &keys) -> U32x1 {
+        auto &env = CodeGenContext::Get().env();
+        std::vector<std::pair<const Type*, SQL_t>> values;
+        for (std::size_t idx = 0; idx != keys.size(); ++idx) // hash with types of build keys, like the hash table
+            values.emplace_back(build_schema[build_keys[idx]].second.type, env.get(keys[idx]));
+        return (murmur3_64a_hash(std::move(values)) >> uint64_t(64 - num_radix_bits)).to<uint32_t>();
+    };
+
+    /*----- Create the data layouts of the chunks of both inputs. -----*/
+    const auto build_layout = M.materializing_factory->make(build_schema);
+    const auto probe_layout = M.materializing_factory->make(probe_schema);
+    auto chunk_size_in_bytes = [](const DataLayout &layout) -> uint32_t {
+        const uint32_t child_size_in_bytes = (layout.stride_in_bits() + 7) / 8;
+        const uint32_t child_num_tuples = layout.child().num_tuples();
+        M_insist(CHUNK_NUM_TUPLES % child_num_tuples == 0, "a chunk must consist of whole children of the layout");
+        const uint32_t size_in_bytes =
+            CHUNK_HEADER_SIZE_IN_BYTES + CHUNK_NUM_TUPLES / child_num_tuples * child_size_in_bytes;
+        return (size_in_bytes + 7U) / 8U * 8U; // pad s.t. consecutively allocated chunks are adjacent
+    };
+
+    /*----- Create the partitions of both inputs. -----*/
+    partitions_t build_partitions(num_partitions), probe_partitions(num_partitions);
+
+    /*----- Scatter the tuples of an input directly from its pipeline into the current chunk of their partition.
+     * Skip tuples with a NULL key since they cannot have a join partner. -----*/
+    auto scatter = [&](const MatchBase &child, partitions_t &partitions, const Schema &schema,
+                       const DataLayout &layout, const std::vector<Schema::Identifier> &keys)
+    {
+        const uint32_t chunk_size = chunk_size_in_bytes(layout);
+        child.execute(
+            /* setup=    */ setup_t::Make_Without_Parent(),
+            /* pipeline= */ [&](){
+                auto &env = CodeGenContext::Get().env();
+
+                std::optional<Boolx1> qualifies;
+                if (env.predicated())
+                    qualifies.emplace(env.extract_predicate<_Boolx1>().is_true_and_not_null());
+                for (auto &key : keys) {
+                    auto val = env.get(key);
+                    if (qualifies)
+                        qualifies.emplace(*qualifies and not_null(val));
+                    else
+                        qualifies.emplace(not_null(val));
+                }
+                M_insist(bool(qualifies));
+                IF (*qualifies) {
+                    const Var<U32x1> partition_id(partition_of(keys));
+                    const Var<Ptr<U32x1>> count(partitions.counts.clone() + partition_id.val().make_signed());
+                    const Var<Ptr<U32x1>> tail(partitions.tails.clone() + partition_id.val().make_signed());
+                    const Var<U32x1> slot(*count.val() bitand (CHUNK_NUM_TUPLES - 1U));
+
+                    /*----- Append a new chunk to the partition if its last chunk is full or if it has none. -----*/
+                    IF (slot == 0U) {
+                        auto chunk = Module::Allocator().allocate(chunk_size, /* align= */ 8);
+                        *chunk.val().to<uint32_t*>() = 0U; // set pointer to next chunk to nullptr
+                        IF (partitions.num_chunks == 0U) {
+                            partitions.first_chunk = chunk.val();
+                        };
+                        partitions.num_chunks += 1U;
+                        IF (*count.val() == 0U) {
+                            *(partitions.heads.clone() + partition_id.val().make_signed()) = chunk.val().to<uint32_t>();
+                        } ELSE {
+                            *Ptr<void>(*tail.val()).to<uint32_t*>() = chunk.val().to<uint32_t>();
+                        };
+                        *tail.val() = chunk.val().to<uint32_t>();
+                    };
+
+                    /*----- Write the tuple to the next slot of the last chunk. -----*/
+                    compile_store_point_access(schema, Ptr<void>(*tail.val()) + int32_t(CHUNK_HEADER_SIZE_IN_BYTES), layout,
+                                               schema, slot.val());
+                    *count.val() += 1U;
+                };
+            },
+            /* teardown= */ teardown_t::Make_Without_Parent()
+        );
+    };
+
+    /*----- Create functions for both children. -----*/
+    FUNCTION(radix_partitioned_hash_join_build_pipeline, void(void)) // create function for pipeline
+    {
+        auto S = CodeGenContext::Get().scoped_environment(); // create scoped environment for this function
+        scatter(M.children[0].get(), build_partitions, build_schema, build_layout, build_keys);
+    }
+    radix_partitioned_hash_join_build_pipeline(); // call child function
+
+    FUNCTION(radix_partitioned_hash_join_probe_pipeline, void(void)) // create function for pipeline
+    {
+        auto S = CodeGenContext::Get().scoped_environment(); // create scoped environment for this function
+        scatter(M.children[1].get(), probe_partitions, probe_schema, probe_layout, probe_keys);
+    }
+    radix_partitioned_hash_join_probe_pipeline(); // call child function
+
+    /*----- Emit a loop over the tuples of the partition with ID \p partition_id, which loads each tuple into a fresh
+     * scoped environment and then emits \p body. -----*/
+    auto for_each_tuple = [&](const partitions_t &partitions, const Schema &schema, const DataLayout &layout,
+                              const Var<U32x1> &partition_id, const std::function<void(void)> &body)
+    {
+        Var<U32x1> num_remaining(*(partitions.counts.clone() + partition_id.val().make_signed()));
+        Var<Ptr<void>> chunk(Ptr<void>(*(partitions.heads.clone() + partition_id.val().make_signed())));
+        WHILE (num_remaining != 0U) {
+            const Var<U32x1> num_tuples(Select(num_remaining > CHUNK_NUM_TUPLES, U32x1(CHUNK_NUM_TUPLES),
+                                               num_remaining.val()));
+            Var<U32x1> slot(0U);
+            WHILE (slot < num_tuples) {
+                auto S = CodeGenContext::Get().scoped_environment();
+                compile_load_point_access(schema, chunk + int32_t(CHUNK_HEADER_SIZE_IN_BYTES), layout, schema,
+                                          slot.val());
+                body();
+                slot += 1U;
+            }
+            num_remaining -= num_tuples;
+            chunk = Ptr<void>(*chunk.val().to<uint32_t*>()); // advance to next chunk
+        }
+    };
+
+    /*----- Create hash table for a single build partition. -----*/
+    std::vector<HashTable::index_t> build_key_indices;
+    for (auto &build_key : build_keys)
+        build_key_indices.push_back(build_schema[build_key].first);
+    const uint32_t initial_capacity =
+        std::ceil(build_cardinality / num_partitions / HIGH_WATERMARK) + 1; // at least one entry must be unoccupied
+    GlobalOpenAddressingInPlaceHashTable ht(build_schema, std::move(build_key_indices), initial_capacity);
+    ht.set_probing_strategy<PROBING_STRATEGY>();
+
+    /*----- Join the inputs partition-wise. -----*/
+    setup();
+    ht.setup();
+    ht.set_high_watermark(HIGH_WATERMARK);
+    Var<U32x1> partition_id(0U);
+    WHILE (partition_id < num_partitions) {
+        const Var<U32x1> build_count(*(build_partitions.counts.clone() + partition_id.val().make_signed()));
+        const Var<U32x1> probe_count(*(probe_partitions.counts.clone() + partition_id.val().make_signed()));
+
+        IF (build_count != 0U and probe_count != 0U) { // skip partitions without any join partners
+            /*----- Insert the tuples of the build partition into the hash table. -----*/
+            ht.clear();
+            for_each_tuple(build_partitions, build_schema, build_layout, partition_id, [&](){
+                auto &env = CodeGenContext::Get().env();
+
+
+                /*----- Insert key. -----*/
+                std::vector<SQL_t> key;
+                for (auto &build_key : build_keys)
+                    key.emplace_back(env.extract(build_key));
+                auto entry = ht.emplace(std::move(key));
+
+                /*----- Insert payload. -----*/
+                for (auto &id : payload_ids) {
+                    std::visit(overloaded {
+                        [&]<sql_type T>(HashTable::reference_t<T> &&r) -> void { r = env.extract<T>(id); },
+                        [](std::monostate) -> void { M_unreachable("invalid reference"); },
+                    }, entry.extract(id));
+                }
+            });
+
+            /*----- Probe the hash table with the tuples of the probe partition. -----*/
+            for_each_tuple(probe_partitions, probe_schema, probe_layout, partition_id, [&](){
+                auto &env = CodeGenContext::Get().env();
+
+                auto emit_tuple_and_resume_pipeline = [&](HashTable::const_entry_t entry){
+                    /*----- Add found entry from hash table, i.e. from build partition, to current environment. -----*/
+                    for (auto &e : build_schema) {
+                        std::visit(overloaded {
+                            [&]<typename T>(HashTable::const_reference_t<Expr<T>> &&r) -> void {
+                                Expr<T> value = r;
+                                if (value.can_be_null()) {
+                                    Var<Expr<T>> var(value); // introduce variable s.t. uses only load from it
+                                    env.add(e.id, var);
+                                } else {
+                                    /* introduce variable w/o NULL bit s.t. uses only load from it */
+                                    Var<PrimitiveExpr<T>> var(value.insist_not_null());
+                                    env.add(e.id, Expr<T>(var));
+                                }
+                            },
+                            [&](HashTable::const_reference_t<NChar> &&r) -> void {
+                                NChar value(r);
+                                Var<Ptr<Charx1>> var(value.val()); // introduce variable s.t. uses only load from it
+                                env.add(e.id, NChar(var, value.can_be_null(), value.length(),
+                                                    value.guarantees_terminating_nul()));
+                            },
+                            [](std::monostate) -> void { M_unreachable("invalid reference"); },
+                        }, entry.extract(e.id));
+                    }
+
+                    /*----- Resume pipeline. -----*/
+                    pipeline();
+                };
+
+                /*----- Search for *all* join partners. -----*/
+                std::vector<SQL_t> key;
+                for (auto &probe_key : probe_keys)
+                    key.emplace_back(env.get(probe_key));
+                ht.for_each_in_equal_range(std::move(key), std::move(emit_tuple_and_resume_pipeline),
+                                           /* predicated= */ false);
+            });
+        };
+
+        partition_id += 1U;
+    }
+    ht.teardown();
+    teardown();
+
+    /*----- Free the chunks of both inputs in reverse order of their allocation.  The chunks of an input are allocated
+     * in a row, hence they are freed as a whole. -----*/
+    Module::Allocator().deallocate(probe_partitions.first_chunk.val(),
+                                   probe_partitions.num_chunks.val() * chunk_size_in_bytes(probe_layout));
+    Module::Allocator().deallocate(build_partitions.first_chunk.val(),
+                                   build_partitions.num_chunks.val() * chunk_size_in_bytes(build_layout));
+
+    build_partitions.discard();
+    probe_partitions.discard();
+}
+
+/*======================================================================================================================
+ * BloomFilteredHashJoin
+ *====================================================================================================================*/
+
+ConditionSet BloomFilteredHashJoin::pre_condition(
+    std::size_t child_idx,
+    const std::tuple<const JoinOperator*, const Wildcard*, const Wildcard*> &partial_inner_nodes)
+{
+    ConditionSet pre_cond;
+
+    /*----- Bloom-filtered hash join can only be used for binary inner joins on equi-predicates. -----*/
+    auto &join = *std::get<0>(partial_inner_nodes);
+    if (join.is_semi_or_anti() or not join.predicate().is_equi()) {
+        pre_cond.add_condition(Unsatisfiable());
+        return pre_cond;
+    }
+
+    if (child_idx == 1) {
+        /*----- Bloom-filtered hash join needs a scan producing the probe keys to install its Bloom filter on. -----*/
+        auto &build = *std::get<1>(partial_inner_nodes);
+        auto &probe = *std::get<2>(partial_inner_nodes);
+        auto p = decompose_equi_predicate(join.predicate(), build.schema());
+        if (not find_scan_producing(probe, p.second)) {
+            pre_cond.add_condition(Unsatisfiable());
+            return pre_cond;
+        }
+    }
+
+    /*----- Bloom-filtered hash join does not support SIMD. -----*/
+    pre_cond.add_condition(NoSIMD());
+
+    return pre_cond;
+}
+
+ConditionSet BloomFilteredHashJoin::post_condition(const Match<BloomFilteredHashJoin>&)
+{
+    ConditionSet post_cond;
+
+    /*----- Bloom-filtered hash join does not introduce predication (it is already handled by the hash table). -----*/
+    post_cond.add_condition(Predicated(false));
+
+    /*----- Bloom-filtered hash join does not introduce SIMD. -----*/
+    post_cond.add_condition(NoSIMD());
+
+    return post_cond;
+}
+
+double BloomFilteredHashJoin::cost(const Match<BloomFilteredHashJoin> &M)
+{
+    constexpr double BLOOM_FILTER_FALSE_POSITIVE_RATE = 0.02;
+
+    if (options::wasm_bloom_filtered_hash_join)
+        return 0; // cheaper than any other implementation of the join
+
+    const double build_cardinality = M.build.info().estimated_cardinality;
+    const double probe_cardinality = M.probe.info().estimated_cardinality;
+    const double join_cardinality = M.join.info().estimated_cardinality;
+
+    /* Only probe tuples passing the Bloom filter, i.e. those with a join partner and the false positives, probe the
+     * hash table.  Checking the Bloom filter is much cheaper than probing the hash table. */
+    const double passing_fraction =
+        probe_cardinality ? std::min(1.0, join_cardinality / probe_cardinality + BLOOM_FILTER_FALSE_POSITIVE_RATE)
+                          : 1.0;
+    double cost = 1.2 * build_cardinality + passing_fraction * probe_cardinality;
+
+    /*----- Accesses to a hash table exceeding the cache mostly miss the cache. -----*/
+    if (estimated_hash_table_size_in_bytes(M.build.schema(), build_cardinality) > HASH_TABLE_CACHE_SIZE_IN_BYTES)
+        cost *= HASH_TABLE_CACHE_MISS_PENALTY;
+
+    return cost + 0.2 * (build_cardinality + probe_cardinality);
+}
+
+void BloomFilteredHashJoin::execute(const Match<BloomFilteredHashJoin> &M, setup_t setup, pipeline_t pipeline,
+                                    teardown_t teardown)
+{
+    // TODO: determine setup
+    using PROBING_STRATEGY = QuadraticProbing;
+    constexpr double HIGH_WATERMARK = 0.7;
+    constexpr uint32_t BLOOM_FILTER_BITS_PER_KEY = 16;
+    constexpr uint32_t BLOOM_FILTER_MAX_NUM_BLOCKS = 1U << 20; // i.e. 8 MiB
+
+    M_insist(((M.join.schema() | M.join.predicate().get_required()) & M.build.schema()) == M.build.schema());
+    M_insist(M.build.schema().drop_constants() == M.build.schema());
+    const auto ht_schema = M.build.schema().deduplicate();
+
+    /*----- Decompose each clause of the join predicate of the form `A.x = B.y` into parts `A.x` and `B.y`. -----*/
+    auto p = decompose_equi_predicate(M.join.predicate(), ht_schema);
+    const std::vector<Schema::Identifier> &build_keys = p.first, &probe_keys = p.second;
+
+    /*----- Find the scan to install the Bloom filter on. -----*/
+    auto probe_scan = find_scan_producing(M.probe, probe_keys);
+    M_insist(probe_scan, "pre-condition guarantees a scan producing the probe keys");
+
+    /*----- Compute payload IDs. -----*/
+    std::vector<Schema::Identifier> payload_ids;
+    for (auto &e : ht_schema) {
+        if (not contains(build_keys, e.id))
+            payload_ids.push_back(e.id);
+    }
+
+    /*----- Compute initial capacity of hash table. -----*/
+    double build_cardinality;
+    if (M.build.has_info())
+        build_cardinality = M.build.info().estimated_cardinality;
+    else if (auto scan = cast<const ScanOperator>(&M.build))
+        build_cardinality = scan->store().num_rows();
+    else
+        build_cardinality = 1024; // fallback
+    const uint32_t initial_capacity =
+        std::ceil(build_cardinality / HIGH_WATERMARK) + 1; // since at least one entry must always be unoccupied
+
+    /*----- Create hash table for build child. -----*/
+    std::vector<HashTable::index_t> build_key_indices;
+    for (auto &build_key : build_keys)
+        build_key_indices.push_back(ht_schema[build_key].first);
+    GlobalOpenAddressingInPlaceHashTable ht(ht_schema, std::move(build_key_indices), initial_capacity);
+    ht.set_probing_strategy<PROBING_STRATEGY>();
+
+    /*----- Create blocked Bloom filter, i.e. each key sets three bits within a single 64-bit block s.t. inserting and
+     * checking a key accesses only a single cache line. -----*/
+    const uint32_t num_blocks = std::min<uint32_t>(
+        ceil_to_pow_2(std::max<uint32_t>(std::ceil(build_cardinality * BLOOM_FILTER_BITS_PER_KEY / 64), 1U)),
+        BLOOM_FILTER_MAX_NUM_BLOCKS
+    );
+    Ptr<U64x1> bloom_filter = Module::Allocator().pre_malloc<uint64_t>(num_blocks);
+    {
+        Var<U32x1> block_id(0U);
+        WHILE (block_id < num_blocks) {
+            *(bloom_filter.clone() + block_id.val().make_signed()) = uint64_t(0);
+            block_id += 1U;
+        }
+    }
+
+    /*----- Emit code to compute the block and the bits of the Bloom filter for the key given by the identifiers \p keys
+     * in the current environment.  Hash with the types of the build keys, like the hash table. -----*/
+    auto bloom_filter_block_and_mask = [&](const std::vector<Schema::Identifier> &keys)
+        -> std::pair<Ptr<U64x1>, U64x1>
+    {
+        auto &env = CodeGenContext::Get().env();
+        std::vector<std::pair<const Type*, SQL_t>> values;
+        for (std::size_t idx = 0; idx != keys.size(); ++idx)
+            values.emplace_back(ht_schema[build_keys[idx]].second.type, env.get(keys[idx]));
+        const Var<U64x1> hash(murmur3_64a_hash(std::move(values)));
+        U32x1 block_id = (hash >> uint64_t(32)).to<uint32_t>() bitand (num_blocks - 1U);
+        U64x1 mask = (U64x1(1) << (hash bitand uint64_t(63))) bitor
+                     (U64x1(1) << ((hash >> uint64_t(6)) bitand uint64_t(63))) bitor
+                     (U64x1(1) << ((hash >> uint64_t(12)) bitand uint64_t(63)));
+        return { bloom_filter.clone() + block_id.make_signed(), std::move(mask) };
+    };
+
+    /*----- Create function for build child. -----*/
+    FUNCTION(bloom_filtered_hash_join_child_pipeline, void(void)) // create function for pipeline
+    {
+        auto S = CodeGenContext::Get().scoped_environment(); // create scoped environment for this function
+
+        M.children[0].get().execute(
+            /* setup=    */ setup_t::Make_Without_Parent([&](){
+                ht.setup();
+                ht.set_high_watermark(HIGH_WATERMARK);
+            }),
+            /* pipeline= */ [&](){
+                auto &env = CodeGenContext::Get().env();
+
+                std::optional<Boolx1> build_key_not_null;
+                for (auto &build_key : build_keys) {
+                    auto val = env.get(build_key);
+                    if (build_key_not_null)
+                        build_key_not_null.emplace(*build_key_not_null and not_null(val));
+                    else
+                        build_key_not_null.emplace(not_null(val));
+                }
+                M_insist(bool(build_key_not_null));
+                IF (*build_key_not_null) {
+                    /*----- Insert key into Bloom filter. -----*/
+                    auto [block, mask] = bloom_filter_block_and_mask(build_keys);
+                    *block |= std::move(mask);
+
+                    /*----- Insert key into hash table. -----*/
+                    std::vector<SQL_t> key;
+                    for (auto &build_key : build_keys)
+                        key.emplace_back(env.extract(build_key));
+                    auto entry = ht.emplace(std::move(key));
+
+                    /*----- Insert payload. -----*/
+                    for (auto &id : payload_ids) {
+                        std::visit(overloaded {
+                            [&]<sql_type T>(HashTable::reference_t<T> &&r) -> void { r = env.extract<T>(id); },
+                            [](std::monostate) -> void { M_unreachable("invalid reference"); },
+                        }, entry.extract(id));
+                    }
+                };
+            },
+            /* teardown= */ teardown_t::Make_Without_Parent([&](){ ht.teardown(); })
+        );
+    }
+    bloom_filtered_hash_join_child_pipeline(); // call child function
+
+    /*----- Install Bloom filter on the probe-side scan, i.e. discard tuples with a NULL key or whose key is definitely
+     * not contained in the hash table right after scanning them. -----*/
+    CodeGenContext::Get().push_sideways_filter(*probe_scan, [&]() -> Boolx1 {
+        auto &env = CodeGenContext::Get().env();
+        std::optional<Boolx1> probe_key_not_null;
+        for (auto &probe_key : probe_keys) {
+            auto val = env.get(probe_key);
+            if (probe_key_not_null)
+                probe_key_not_null.emplace(*probe_key_not_null and not_null(val));
+            else
+                probe_key_not_null.emplace(not_null(val));
+        }
+        M_insist(bool(probe_key_not_null));
+        Var<Boolx1> may_contain(false);
+        IF (*probe_key_not_null) {
+            auto [block, mask] = bloom_filter_block_and_mask(probe_keys);
+            const Var<U64x1> bits(mask);
+            may_contain = (U64x1(*block) bitand bits) == bits;
+        };
+        return may_contain;
+    });
+
+    M.children[1].get().execute(
+        /* setup=    */ setup_t(std::move(setup), [&](){ ht.setup(); }),
+        /* pipeline= */ [&, pipeline=std::move(pipeline)](){
+            auto &env = CodeGenContext::Get().env();
+
+            auto emit_tuple_and_resume_pipeline = [&, pipeline=std::move(pipeline)](HashTable::const_entry_t entry){
+                /*----- Add found entry from hash table, i.e. from build child, to current environment. -----*/
+                for (auto &e : ht_schema) {
+                    std::visit(overloaded {
+                        [&]<typename T>(HashTable::const_reference_t<Expr<T>> &&r) -> void {
+                            Expr<T> value = r;
+                            if (value.can_be_null()) {
+                                Var<Expr<T>> var(value); // introduce variable s.t. uses only load from it
+                                env.add(e.id, var);
+                            } else {
+                                /* introduce variable w/o NULL bit s.t. uses only load from it */
+                                Var<PrimitiveExpr<T>> var(value.insist_not_null());
+                                env.add(e.id, Expr<T>(var));
+                            }
+                        },
+                        [&](HashTable::const_reference_t<NChar> &&r) -> void {
+                            NChar value(r);
+                            Var<Ptr<Charx1>> var(value.val()); // introduce variable s.t. uses only load from it
+                            env.add(e.id, NChar(var, value.can_be_null(), value.length(),
+                                                value.guarantees_terminating_nul()));
+                        },
+                        [](std::monostate) -> void { M_unreachable("invalid reference"); },
+                    }, entry.extract(e.id));
+                }
+
+                /*----- Resume pipeline. -----*/
+                pipeline();
+            };
+
+            /*----- Search for *all* join partners. -----*/
+            std::vector<SQL_t> key;
+            for (auto &probe_key : probe_keys)
+                key.emplace_back(env.get(probe_key));
+            ht.for_each_in_equal_range(std::move(key), std::move(emit_tuple_and_resume_pipeline),
+                                       /* predicated= */ false);
+        },
+        /* teardown= */ teardown_t(std::move(teardown), [&](){ ht.teardown(); })
+    );
+
+    CodeGenContext::Get().pop_sideways_filter();
+    bloom_filter.discard(); // since it was only cloned
+}
+
+/*======================================================================================================================
+ * SimpleHashSemiJoin
+ *====================================================================================================================*/
+
+ConditionSet SimpleHashSemiJoin::pre_condition(
+    std::size_t,
+    const std::tuple<const JoinOperator*, const Wildcard*, const Wildcard*> &partial_inner_nodes)
+{
+    ConditionSet pre_cond;
+
+    /*----- Simple hash semi-join can only be used for semi-joins and anti-joins on equalities of identifiers. -----*/
+    auto &join = *std::get<0>(partial_inner_nodes);
+    if (not join.is_semi_or_anti() or not decompose_semi_join_predicate(join)) {
+        pre_cond.add_condition(Unsatisfiable());
+        return pre_cond;
+    }
+
+    /*----- Simple hash semi-join does not support SIMD. -----*/
+    pre_cond.add_condition(NoSIMD());
+
+    return pre_cond;
+}
+
+ConditionSet SimpleHashSemiJoin::adapt_post_conditions(
+    const Match<SimpleHashSemiJoin>&,
+    std::vector<std::reference_wrapper<const ConditionSet>> &&post_cond_children)
+{
+    M_insist(post_cond_children.size() == 2);
+
+    ConditionSet post_cond(post_cond_children[1].get()); // preserve conditions of probe child
+
+    /*----- Simple hash semi-join does not introduce predication. -----*/
+    post_cond.add_or_replace_condition(m::Predicated(false));
+
+    return post_cond;
+}
+
+double SimpleHashSemiJoin::cost(const Match<SimpleHashSemiJoin> &M)
+{
+    const double build_cardinality = M.build.info().estimated_cardinality;
+    const double cost = build_cardinality + M.probe.info().estimated_cardinality;
+
+    /*----- Accesses to a hash table exceeding the cache mostly miss the cache.  The table holds only the keys. -----*/
+    Schema keys_schema;
+    for (auto &id : decompose_semi_join_predicate(M.join)->first) {
+        if (not keys_schema.has(id))
+            keys_schema.add(M.build.schema()[id].second);
+    }
+    if (estimated_hash_table_size_in_bytes(keys_schema, build_cardinality) > HASH_TABLE_CACHE_SIZE_IN_BYTES)
+        return HASH_TABLE_CACHE_MISS_PENALTY * cost;
+    return cost;
+}
+
+void SimpleHashSemiJoin::execute(const Match<SimpleHashSemiJoin> &M, setup_t setup, pipeline_t pipeline,
+                                 teardown_t teardown)
+{
+    // TODO: determine setup
+    using PROBING_STRATEGY = QuadraticProbing;
+    constexpr double HIGH_WATERMARK = 0.7;
+
+    /*----- Decompose each clause of the join predicate of the form `A.x = B.y` or `A.x IN Q` into its parts. -----*/
+    auto p = decompose_semi_join_predicate(M.join);
+    M_insist(bool(p), "pre-condition guarantees a decomposable predicate");
+    const std::vector<Schema::Identifier> &build_keys = p->first, &probe_keys = p->second;
+
+    /*----- The hash table contains only the keys since no attribute of the build child is produced. -----*/
+    Schema ht_schema;
+    for (auto &build_key : build_keys) {
+        if (not ht_schema.has(build_key))
+            ht_schema.add(M.build.schema()[build_key].second);
+    }
+
+    /*----- Compute initial capacity of hash table. -----*/
+    uint32_t initial_capacity;
+    if (M.build.has_info())
+        initial_capacity = std::ceil(M.build.info().estimated_cardinality / HIGH_WATERMARK);
+    else if (auto scan = cast<const ScanOperator>(&M.build))
+        initial_capacity = std::ceil(scan->store().num_rows() / HIGH_WATERMARK);
+    else
+        initial_capacity = 1024; // fallback
+    ++initial_capacity; // since at least one entry must always be unoccupied for lookups
+
+    /*----- Create hash table for build child. -----*/
+    std::vector<HashTable::index_t> build_key_indices;
+    for (auto &build_key : build_keys)
+        build_key_indices.push_back(ht_schema[build_key].first);
+    GlobalOpenAddressingInPlaceHashTable ht(ht_schema, std::move(build_key_indices), initial_capacity);
+    ht.set_probing_strategy<PROBING_STRATEGY>();
+
+    /*----- Create flags whether the build child is empty and whether it produces a key containing NULL.  Both are
+     * required for null-aware anti-joins only. -----*/
+    Global<Boolx1> build_is_empty(true);
+    Global<Boolx1> build_has_null(false);
+
+    /*----- Create function for build child. -----*/
+    FUNCTION(simple_hash_semi_join_child_pipeline, void(void)) // create function for pipeline
+    {
+        auto S = CodeGenContext::Get().scoped_environment(); // create scoped environment for this function
+
+        M.children[0].get().execute(
+            /* setup=    */ setup_t::Make_Without_Parent([&](){
+                ht.setup();
+                ht.set_high_watermark(HIGH_WATERMARK);
+            }),
+            /* pipeline= */ [&](){
+                auto &env = CodeGenContext::Get().env();
+
+                auto insert = [&](){
+                    build_is_empty = false;
+
+                    std::optional<Boolx1> build_key_not_null;
+                    for (auto &build_key : build_keys) {
+                        auto val = env.get(build_key);
+                        if (build_key_not_null)
+                            build_key_not_null.emplace(*build_key_not_null and not_null(val));
+                        else
+                            build_key_not_null.emplace(not_null(val));
+                    }
+                    M_insist(bool(build_key_not_null));
+                    IF (*build_key_not_null) {
+                        /*----- Insert key iff not yet contained, i.e. each key is contained exactly once. -----*/
+                        std::vector<SQL_t> key;
+                        for (auto &build_key : build_keys)
+                            key.emplace_back(env.get(build_key));
+                        auto [entry, inserted] = ht.try_emplace(std::move(key));
+                        inserted.discard(); // duplicate keys are irrelevant for semi-joins
+                    } ELSE {
+                        build_has_null = true; // a key containing NULL never matches
+                    };
+                };
+                if (env.predicated()) {
+                    IF (env.extract_predicate<_Boolx1>().is_true_and_not_null()) {
+                        insert();
+                    };
+                } else {
+                    insert();
+                }
+            },
+            /* teardown= */ teardown_t::Make_Without_Parent([&](){ ht.teardown(); })
+        );
+    }
+    simple_hash_semi_join_child_pipeline(); // call child function
+
+    M.children[1].get().execute(
+        /* setup=    */ setup_t(std::move(setup), [&](){ ht.setup(); }),
+        /* pipeline= */ [&, pipeline=std::move(pipeline)](){
+            auto &env = CodeGenContext::Get().env();
+
+            std::optional<Boolx1> probe_key_not_null;
+            for (auto &probe_key : probe_keys) {
+                auto val = env.get(probe_key);
+                if (probe_key_not_null)
+                    probe_key_not_null.emplace(*probe_key_not_null and not_null(val));
+                else
+                    probe_key_not_null.emplace(not_null(val));
+            }
+            M_insist(bool(probe_key_not_null));
+            const Var<Boolx1> key_not_null(std::move(*probe_key_not_null));
+
+            /*----- Look up the probe key exactly once, s.t. each probe tuple is produced at most once. -----*/
+            Var<Boolx1> found(false);
+            IF (key_not_null) {
+                std::vector<SQL_t> key;
+                for (auto &probe_key : probe_keys)
+                    key.emplace_back(env.get(probe_key));
+                auto [entry, found_] = ht.find(std::move(key));
+                found = std::move(found_);
+            };
+
+            /*----- Resume pipeline iff the probe tuple qualifies. -----*/
+            std::optional<Boolx1> qualifies;
+            switch (M.join.kind()) {
+                case JoinOperator::J_Inner:
+                    M_unreachable("pre-condition guarantees a semi-join or anti-join");
+                case JoinOperator::J_Semi:
+                    qualifies.emplace(found);
+                    break;
+                case JoinOperator::J_Anti:
+                    qualifies.emplace(not found);
+                    break;
+                case JoinOperator::J_NullAwareAnti:
+                    /* `x NOT IN Q` is `TRUE` iff `Q` is empty or neither `x` nor any value of `Q` is NULL and `x` is
+                     * not found.  Otherwise, it is `FALSE` or `NULL`. */
+                    qualifies.emplace(Boolx1(build_is_empty) or (key_not_null and not Boolx1(build_has_null) and
+                                                                 not found));
+                    break;
+            }
+            IF (*qualifies) {
+                pipeline();
+            };
+        },
+        /* teardown= */ teardown_t(std::move(teardown), [&](){ ht.teardown(); })
+    );
+}
+
+/*======================================================================================================================
+ * NestedLoopsSemiJoin
+ *====================================================================================================================*/
+
+ConditionSet NestedLoopsSemiJoin::pre_condition(
+    std::size_t,
+    const std::tuple<const JoinOperator*, const Wildcard*, const Wildcard*> &partial_inner_nodes)
+{
+    ConditionSet pre_cond;
+
+    /*----- Nested-loops semi-join can only be used for semi-joins and anti-joins. -----*/
+    auto &join = *std::get<0>(partial_inner_nodes);
+    if (not join.is_semi_or_anti()) {
+        pre_cond.add_condition(Unsatisfiable());
+        return pre_cond;
+    }
+
+    /*----- Nested-loops semi-join does not support SIMD. -----*/
+    pre_cond.add_condition(NoSIMD());
+
+    return pre_cond;
+}
+
+ConditionSet NestedLoopsSemiJoin::adapt_post_conditions(
+    const Match<NestedLoopsSemiJoin>&,
+    std::vector<std::reference_wrapper<const ConditionSet>> &&post_cond_children)
+{
+    M_insist(post_cond_children.size() == 2);
+
+    ConditionSet post_cond(post_cond_children[1].get()); // preserve conditions of probe child
+
+    /*----- Nested-loops semi-join does not introduce predication. -----*/
+    post_cond.add_or_replace_condition(m::Predicated(false));
+
+    return post_cond;
+}
+
+double NestedLoopsSemiJoin::cost(const Match<NestedLoopsSemiJoin> &M)
+{
+    return M.build.info().estimated_cardinality * M.probe.info().estimated_cardinality;
+}
+
+void NestedLoopsSemiJoin::execute(const Match<NestedLoopsSemiJoin> &M, setup_t setup, pipeline_t pipeline,
+                                  teardown_t teardown)
+{
+    /*----- Split the predicate into the `IN` clauses of a null-aware anti-join, which match if `TRUE` *or* `NULL`, and
+     * all other clauses, which match only if `TRUE`. -----*/
+    cnf::CNF clauses, in_clauses;
+    for (auto &clause : M.join.predicate()) {
+        auto binary = cast<const BinaryExpr>(&clause[0].expr());
+        if (M.join.kind() == JoinOperator::J_NullAwareAnti and binary and binary->tok == TK_In)
+            in_clauses.push_back(clause);
+        else
+            clauses.push_back(clause);
+    }
+
+    /*----- Create infinite buffer to materialize the build child. -----*/
+    const auto schema = M.build.schema().drop_constants().deduplicate();
+    GlobalBuffer buffer(schema, *M.materializing_factory);
+
+    /*----- Create function for build child. -----*/
+    FUNCTION(nested_loops_semi_join_child_pipeline, void(void)) // create function for pipeline
     {
         auto S = CodeGenContext::Get().scoped_environment(); // create scoped environment for this function
 
         M.children[0].get().execute(
-            /* setup=    */ setup_t::Make_Without_Parent([&](){
-                ht->setup();
-                ht->set_high_watermark(HIGH_WATERMARK);
-            }),
-            /* pipeline= */ [&](){
-                auto &env = CodeGenContext::Get().env();
-
-                std::optional<Boolx1> build_key_not_null;
-                for (auto &build_key : build_keys) {
-                    auto val = env.get(build_key);
-                    if (build_key_not_null)
-                        build_key_not_null.emplace(*build_key_not_null and not_null(val));
-                    else
-                        build_key_not_null.emplace(not_null(val));
-                }
-                M_insist(bool(build_key_not_null));
-                IF (*build_key_not_null) { // TODO: predicated version
-                    /*----- Insert key. -----*/
-                    std::vector<SQL_t> key;
-                    for (auto &build_key : build_keys)
-                        key.emplace_back(env.extract(build_key));
-                    auto entry = ht->emplace(std::move(key));
-
-                    /*----- Insert payload. -----*/
-                    for (auto &id : payload_ids) {
-                        std::visit(overloaded {
-                            [&]<sql_type T>(HashTable::reference_t<T> &&r) -> void { r = env.extract<T>(id); },
-                            [](std::monostate) -> void { M_unreachable("invalid reference"); },
-                        }, entry.extract(id));
-                    }
-                };
-            },
-            /* teardown= */ teardown_t::Make_Without_Parent([&](){ ht->teardown(); })
+            /* setup=    */ setup_t::Make_Without_Parent([&](){ buffer.setup(); }),
+            /* pipeline= */ [&](){ buffer.consume(); },
+            /* teardown= */ teardown_t::Make_Without_Parent([&](){ buffer.teardown(); })
         );
     }
-    simple_hash_join_child_pipeline(); // call child function
+    nested_loops_semi_join_child_pipeline(); // call child function
 
     M.children[1].get().execute(
-        /* setup=    */ setup_t(std::move(setup), [&](){ ht->setup(); }),
+        /* setup=    */ std::move(setup),
         /* pipeline= */ [&, pipeline=std::move(pipeline)](){
-            auto &env = CodeGenContext::Get().env();
-
-            auto emit_tuple_and_resume_pipeline = [&, pipeline=std::move(pipeline)](HashTable::const_entry_t entry){
-                /*----- Add found entry from hash table, i.e. from build child, to current environment. -----*/
-                for (auto &e : ht_schema) {
-                    if (not entry.has(e.id)) { // entry may not contain build key in case `ht->find()` was used
-                        M_insist(contains(build_keys, e.id));
-                        M_insist(env.has(e.id), "build key must already be contained in the current environment");
-                        continue;
-                    }
-
-                    std::visit(overloaded {
-                        [&]<typename T>(HashTable::const_reference_t<Expr<T>> &&r) -> void {
-                            Expr<T> value = r;
-                            if (value.can_be_null()) {
-                                Var<Expr<T>> var(value); // introduce variable s.t. uses only load from it
-                                env.add(e.id, var);
-                            } else {
-                                /* introduce variable w/o NULL bit s.t. uses only load from it */
-                                Var<PrimitiveExpr<T>> var(value.insist_not_null());
-                                env.add(e.id, Expr<T>(var));
-                            }
-                        },
-                        [&](HashTable::const_reference_t<NChar> &&r) -> void {
-                            NChar value(r);
-                            Var<Ptr<Charx1>> var(value.val()); // introduce variable s.t. uses only load from it
-                            env.add(e.id, NChar(var, value.can_be_null(), value.length(),
-                                                value.guarantees_terminating_nul()));
-                        },
-                        [](std::monostate) -> void { M_unreachable("invalid reference"); },
-                    }, entry.extract(e.id));
+            /*----- Evaluate the predicate for the buffered tuples until the first match. -----*/
+            Var<Boolx1> matched(false);
+            auto load = buffer.create_load_proxy();
+            Var<U32x1> tuple_id(0U);
+            WHILE (not matched and tuple_id < buffer.size()) {
+                /* Extend a copy of the environment of the probe tuple by the current build tuple. */
+                Environment env;
+                env.add(CodeGenContext::Get().env());
+                auto S = CodeGenContext::Get().scoped_environment(std::move(env));
+                load(tuple_id);
+
+                std::optional<Boolx1> match;
+                if (not clauses.empty())
+                    match.emplace(CodeGenContext::Get().env().compile<_Boolx1>(clauses).is_true_and_not_null());
+                if (not in_clauses.empty()) {
+                    auto in = not CodeGenContext::Get().env().compile<_Boolx1>(in_clauses).is_false_and_not_null();
+                    if (match)
+                        match.emplace(*match and in);
+                    else
+                        match.emplace(in);
                 }
+                if (match)
+                    matched = std::move(*match);
+                else
+                    matched = true; // no clauses, i.e. every build tuple matches
+                tuple_id += 1U;
+            }
 
-                /*----- Resume pipeline. -----*/
+            /*----- Resume pipeline iff the probe tuple qualifies. -----*/
+            IF (M.join.is_anti() ? not matched : Boolx1(matched)) {
                 pipeline();
             };
-
-            /* TODO: may check for NULL on probe keys as well, branching + predicated version */
-            /*----- Probe with probe key. -----*/
-            std::vector<SQL_t> key;
-            for (auto &probe_key : probe_keys)
-                key.emplace_back(env.get(probe_key));
-            if constexpr (UniqueBuild) {
-                /*----- Add build key to current environment since `ht->find()` will only return the payload values. -----*/
-                for (auto build_it = build_keys.cbegin(), probe_it = probe_keys.cbegin(); build_it != build_keys.cend();
-                     ++build_it, ++probe_it)
-                {
-                    M_insist(probe_it != probe_keys.cend());
-                    env.add(*build_it, env.get(*probe_it)); // since build and probe keys match for join partners
-                }
-
-                /*----- Try to find the *single* possible join partner. -----*/
-                auto p = ht->find(std::move(key));
-                auto &entry = p.first;
-                auto &found = p.second;
-                if constexpr (Predicated) {
-                    env.add_predicate(found);
-                    emit_tuple_and_resume_pipeline(std::move(entry));
-                } else {
-                    IF (found) {
-                        emit_tuple_and_resume_pipeline(std::move(entry));
-                    };
-                }
-            } else {
-                /*----- Search for *all* join partners. -----*/
-                ht->for_each_in_equal_range(std::move(key), std::move(emit_tuple_and_resume_pipeline), Predicated);
-            }
         },
-        /* teardown= */ teardown_t(std::move(teardown), [&](){ ht->teardown(); })
+        /* teardown= */ std::move(teardown)
     );
 }
 
+/*======================================================================================================================
+ * SortMergeJoin
+ *====================================================================================================================*/
+
 template<bool SortLeft, bool SortRight, bool Predicated>
 ConditionSet SortMergeJoin<SortLeft, SortRight, Predicated>::pre_condition(
     std::size_t child_idx,
@@ -3508,9 +5368,9 @@ ConditionSet SortMergeJoin<SortLeft, SortRight, Predicated>::pre_condition(
 {
     ConditionSet pre_cond;
 
-    /*----- Sort merge join can only be used for binary joins on conjunctions of equi-predicates. -----*/
+    /*----- Sort merge join can only be used for binary inner joins on conjunctions of equi-predicates. -----*/
     auto &join = *std::get<0>(partial_inner_nodes);
-    if (not join.predicate().is_equi()) {
+    if (join.is_semi_or_anti() or not join.predicate().is_equi()) {
         pre_cond.add_condition(Unsatisfiable());
         return pre_cond;
     }
@@ -3823,6 +5683,202 @@ void Limit::execute(const Match<Limit> &M, setup_t setup, pipeline_t pipeline, t
 }
 
 
+/*======================================================================================================================
+ * Limit combined with Sorting
+ *====================================================================================================================*/
+
+ConditionSet TopK::pre_condition(std::size_t child_idx,
+                                 const std::tuple<const LimitOperator*, const SortingOperator*> &partial_inner_nodes)
+{
+    M_insist(child_idx == 0);
+
+    ConditionSet pre_cond;
+
+    /*----- Top-k can only be used if the heap of offset plus limit tuples is non-empty and small. -----*/
+    auto &limit = *std::get<0>(partial_inner_nodes);
+    const std::size_t k = limit.offset() + limit.limit();
+    if (k == 0 or k > MAX_K) {
+        pre_cond.add_condition(Unsatisfiable());
+        return pre_cond;
+    }
+
+    /*----- Top-k does not support SIMD. -----*/
+    pre_cond.add_condition(NoSIMD());
+
+    return pre_cond;
+}
+
+double TopK::cost(const Match<TopK> &M)
+{
+    if (options::wasm_top_k)
+        return 0; // cheaper than any other implementation of the limit and the sorting
+
+    /*----- Without an estimate of the input size, assume that the heap is considerably smaller than the input. -----*/
+    if (not M.sorting.has_info())
+        return 1.5;
+
+    /*----- A heap holding the entire input saves nothing over sorting it but costs more per tuple.  Otherwise, each
+     * tuple is compared against the root and sifted through at most log(k) levels instead of being sorted among all n
+     * tuples, i.e. the cost grows with log(k) / log(n) towards the cost of `Sorting` plus `Limit`. -----*/
+    const double k = M.limit.offset() + M.limit.limit();
+    const double n = M.sorting.info().estimated_cardinality;
+    if (k >= n)
+        return 2.5;
+    return 0.5 + 1.5 * std::log2(k + 1) / std::log2(n + 1);
+}
+
+ConditionSet TopK::post_condition(const Match<TopK> &M)
+{
+    ConditionSet post_cond;
+
+    /*----- Top-k does not introduce predication. -----*/
+    post_cond.add_condition(Predicated(false));
+
+    /*----- Top-k does sort the data. -----*/
+    Sortedness::order_t orders;
+    for (auto &o : M.sorting.order_by()) {
+        Schema::Identifier id(o.first);
+        if (orders.find(id) == orders.cend())
+            orders.add(id, o.second ? Sortedness::O_ASC : Sortedness::O_DESC);
+    }
+    post_cond.add_condition(Sortedness(std::move(orders)));
+
+    /*----- Top-k does not introduce SIMD. -----*/
+    post_cond.add_condition(NoSIMD());
+
+    return post_cond;
+}
+
+void TopK::execute(const Match<TopK> &M, setup_t setup, pipeline_t pipeline, teardown_t teardown)
+{
+    const uint32_t k = M.limit.offset() + M.limit.limit();
+    M_insist(k != 0 and k <= MAX_K);
+    const auto &order = M.sorting.order_by();
+
+    /*----- Create finite buffer to keep the heap of the first k tuples.  Reserve one more slot s.t. the buffer never
+     * becomes full and thus never resumes a pipeline on its own. -----*/
+    M_insist(bool(M.materializing_factory), "`wasm::TopK` must have a factory for the materialized child");
+    const auto buffer_schema = M.sorting.child(0)->schema().drop_constants().deduplicate();
+    const auto topk_schema = M.limit.schema().drop_constants().deduplicate();
+    GlobalBuffer heap(buffer_schema, *M.materializing_factory, false, k + 1);
+
+    /*----- Create load, store, and swap proxies for the heap. -----*/
+    auto load  = heap.create_load_proxy();
+    auto store = heap.create_store_proxy();
+    auto swap  = heap.create_swap_proxy();
+
+    /*----- Emit code to restore the heap property, i.e. each tuple is greater than or equal to its children, for the
+     * subtree rooted at the given ID of the full heap. -----*/
+    auto sift_down = [&](U32x1 root) {
+        Var<U32x1> pos(root);
+        WHILE ((pos << 1U) + 1U < k) { // tuple at `pos` has a left child
+            /*----- Determine the greater child. -----*/
+            Var<U32x1> child((pos << 1U) + 1U);
+            IF (child + 1U < k) { // tuple at `pos` has a right child
+                auto env_left = [&](){
+                    auto S = CodeGenContext::Get().scoped_environment();
+                    load(child);
+                    return S.extract();
+                }();
+                auto env_right = [&](){
+                    auto S = CodeGenContext::Get().scoped_environment();
+                    load(child + 1U);
+                    return S.extract();
+                }();
+                child += (compare(env_left, env_right, order) < 0).to<uint32_t>();
+            };
+
+            /*----- Swap with the greater child if it is greater, otherwise the heap property is restored. -----*/
+            auto env_pos = [&](){
+                auto S = CodeGenContext::Get().scoped_environment();
+                load(pos);
+                return S.extract();
+            }();
+            auto env_child = [&](){
+                auto S = CodeGenContext::Get().scoped_environment();
+                load(child);
+                return S.extract();
+            }();
+            IF (compare(env_pos, env_child, order) < 0) {
+                swap(pos, child, env_pos, env_child);
+                pos = child.val();
+            } ELSE {
+                pos = k; // abort loop
+            };
+        }
+    };
+
+    /*----- Create child function. -----*/
+    FUNCTION(topk_child_pipeline, void(void)) // create function for pipeline
+    {
+        auto S = CodeGenContext::Get().scoped_environment(); // create scoped environment for this function
+
+        M.child.execute(
+            /* setup=    */ setup_t::Make_Without_Parent([&](){ heap.setup(); }),
+            /* pipeline= */ [&](){
+                auto &env = CodeGenContext::Get().env();
+
+                /*----- If predication is used, introduce pred. var. to only insert qualifying tuples. -----*/
+                std::optional<Var<Boolx1>> pred;
+                if (env.predicated()) {
+                    M_insist(CodeGenContext::Get().num_simd_lanes() == 1, "invalid number of SIMD lanes");
+                    pred = env.extract_predicate<_Boolx1>().is_true_and_not_null();
+                }
+
+                auto insert = [&](){
+                    IF (heap.size() < k) {
+                        /*----- Append tuple and establish the heap as soon as it contains k tuples. -----*/
+                        heap.consume();
+                        IF (heap.size() == k) {
+                            Var<U32x1> i(k / 2);
+                            WHILE (i != 0U) {
+                                i -= 1U;
+                                sift_down(i);
+                            }
+                        };
+                    } ELSE {
+                        /*----- Replace the root, i.e. the greatest tuple, if the current tuple is smaller. -----*/
+                        auto env_root = [&](){
+                            auto S = CodeGenContext::Get().scoped_environment();
+                            load(U32x1(0U));
+                            return S.extract();
+                        }();
+                        IF (compare(CodeGenContext::Get().env(), env_root, order) < 0) {
+                            store(U32x1(0U));
+                            sift_down(U32x1(0U));
+                        };
+                    };
+                };
+                if (pred) {
+                    IF (*pred) {
+                        insert();
+                    };
+                } else {
+                    insert();
+                }
+            },
+            /* teardown= */ teardown_t::Make_Without_Parent([&](){ heap.teardown(); })
+        );
+    }
+    topk_child_pipeline(); // call child function
+
+    /*----- Sort the heap. -----*/
+    quicksort(heap, order);
+
+    /*----- Process the sorted heap, skipping the first `offset` tuples. -----*/
+    auto load_result = heap.create_load_proxy(topk_schema);
+    setup();
+    Var<U32x1> tuple_id(uint32_t(M.limit.offset()));
+    WHILE (tuple_id < heap.size()) {
+        auto S = CodeGenContext::Get().scoped_environment();
+        load_result(tuple_id);
+        pipeline();
+        tuple_id += 1U;
+    }
+    teardown();
+}
+
+
 /*======================================================================================================================
  * Grouping combined with Join
  *====================================================================================================================*/
@@ -3844,9 +5900,9 @@ ConditionSet HashBasedGroupJoin::pre_condition(
         }
     }
 
-    /*----- Hash-based group-join can only be used for binary joins on equi-predicates. -----*/
+    /*----- Hash-based group-join can only be used for binary inner joins on equi-predicates. -----*/
     auto &join = *std::get<1>(partial_inner_nodes);
-    if (not join.predicate().is_equi()) {
+    if (join.is_semi_or_anti() or not join.predicate().is_equi()) {
         pre_cond.add_condition(Unsatisfiable());
         return pre_cond;
     }
@@ -4570,21 +6626,24 @@ void HashBasedGroupJoin::execute(const Match<HashBasedGroupJoin> &M, setup_t set
 
 void Match<m::wasm::NoOp>::print(std::ostream &out, unsigned level) const
 {
-    indent(out, level) << "wasm::NoOp (cumulative cost " << cost() << ')';
+    indent(out, level) << "wasm::NoOp (" << statistics() << ')';
     this->child.print(out, level + 1);
 }
 
 template<bool SIMDfied>
 void Match<m::wasm::Callback<SIMDfied>>::print(std::ostream &out, unsigned level) const
 {
-    indent(out, level) << "wasm::Callback (cumulative cost " << cost() << ')';
+    indent(out, level) << "wasm::Callback ";
+    if (this->result_set_num_tuples_)
+        out << "with result set windows of " << *this->result_set_num_tuples_ << " tuples ";
+    out << '(' << statistics() << ')';
     this->child.print(out, level + 1);
 }
 
 template<bool SIMDfied>
 void Match<m::wasm::Print<SIMDfied>>::print(std::ostream &out, unsigned level) const
 {
-    indent(out, level) << "wasm::Print " << print_.schema() << " (cumulative cost " << cost() << ')';
+    indent(out, level) << "wasm::Print " << print_.schema() << " (" << statistics() << ')';
     this->child.print(out, level + 1);
 }
 
@@ -4592,7 +6651,20 @@ template<bool SIMDfied>
 void Match<m::wasm::Scan<SIMDfied>>::print(std::ostream &out, unsigned level) const
 {
     indent(out, level) << M_CONSTEXPR_COND(SIMDfied, "wasm::SIMDScan(", "wasm::Scan(") << M_notnull(scan.alias())
-                       << ") " << scan.schema() << " (cumulative cost " << cost() << ')';
+                       << ") " << scan.schema() << " (" << statistics() << ')';
+}
+
+void Match<m::wasm::IndexScan>::print(std::ostream &out, unsigned level) const
+{
+    indent(out, level) << "wasm::IndexScan(" << M_notnull(scan.alias()) << ") using index " << range.index->name
+                       << " (ID " << range.index->id << ") on keys [" << range.lower << ", " << range.upper << "] "
+                       << filter.schema() << " (" << statistics() << ')';
+}
+
+void Match<m::wasm::LateMaterializingScan>::print(std::ostream &out, unsigned level) const
+{
+    indent(out, level) << "wasm::LateMaterializingScan(" << M_notnull(scan.alias()) << ") " << predicate_schema
+                       << " with payload " << payload_schema << " (" << statistics() << ')';
 }
 
 template<bool Predicated>
@@ -4601,7 +6673,7 @@ void Match<m::wasm::Filter<Predicated>>::print(std::ostream &out, unsigned level
     indent(out, level) << "wasm::" << (Predicated ? "Predicated" : "Branching") << "Filter ";
     if (this->buffer_factory_)
         out << "with " << this->buffer_num_tuples_ << " tuples output buffer ";
-    out << filter.schema() << " (cumulative cost " << cost() << ')';
+    out << filter.schema() << " (" << statistics() << ')';
     this->child.print(out, level + 1);
 }
 
@@ -4615,44 +6687,50 @@ void Match<m::wasm::LazyDisjunctiveFilter>::print(std::ostream &out, unsigned le
         if (it != clause.cbegin()) out << " → ";
         out << *it;
     }
-    out << ' ' << filter.schema() << " (cumulative cost " << cost() << ')';
+    out << ' ' << filter.schema() << " (" << statistics() << ')';
     this->child.print(out, level + 1);
 }
 
 void Match<m::wasm::Projection>::print(std::ostream &out, unsigned level) const
 {
-    indent(out, level) << "wasm::Projection " << projection.schema() << " (cumulative cost " << cost() << ')';
+    indent(out, level) << "wasm::Projection " << projection.schema() << " (" << statistics() << ')';
     if (this->child)
         this->child->get().print(out, level + 1);
 }
 
 void Match<m::wasm::HashBasedGrouping>::print(std::ostream &out, unsigned level) const
 {
-    indent(out, level) << "wasm::HashBasedGrouping " << grouping.schema() << " (cumulative cost " << cost() << ')';
+    indent(out, level) << "wasm::HashBasedGrouping " << grouping.schema() << " (" << statistics() << ')';
+    this->child.print(out, level + 1);
+}
+
+void Match<m::wasm::IdentityHashGrouping>::print(std::ostream &out, unsigned level) const
+{
+    indent(out, level) << "wasm::IdentityHashGrouping " << grouping.schema() << " (" << statistics() << ')';
     this->child.print(out, level + 1);
 }
 
 void Match<m::wasm::OrderedGrouping>::print(std::ostream &out, unsigned level) const
 {
-    indent(out, level) << "wasm::OrderedGrouping " << grouping.schema() << " (cumulative cost " << cost() << ')';
+    indent(out, level) << "wasm::OrderedGrouping " << grouping.schema() << " (" << statistics() << ')';
     this->child.print(out, level + 1);
 }
 
 void Match<m::wasm::Aggregation>::print(std::ostream &out, unsigned level) const
 {
-    indent(out, level) << "wasm::Aggregation " << aggregation.schema() << " (cumulative cost " << cost() << ')';
+    indent(out, level) << "wasm::Aggregation " << aggregation.schema() << " (" << statistics() << ')';
     this->child.print(out, level + 1);
 }
 
 void Match<m::wasm::Sorting>::print(std::ostream &out, unsigned level) const
 {
-    indent(out, level) << "wasm::Sorting " << sorting.schema() << " (cumulative cost " << cost() << ')';
+    indent(out, level) << "wasm::Sorting " << sorting.schema() << " (" << statistics() << ')';
     this->child.print(out, level + 1);
 }
 
 void Match<m::wasm::NoOpSorting>::print(std::ostream &out, unsigned level) const
 {
-    indent(out, level) << "wasm::NoOpSorting (cumulative cost " << cost() << ')';
+    indent(out, level) << "wasm::NoOpSorting (" << statistics() << ')';
     this->child.print(out, level + 1);
 }
 
@@ -4662,7 +6740,7 @@ void Match<m::wasm::NestedLoopsJoin<Predicated>>::print(std::ostream &out, unsig
     indent(out, level) << "wasm::" << (Predicated ? "Predicated" : "") << "NestedLoopsJoin ";
     if (this->buffer_factory_)
         out << "with " << this->buffer_num_tuples_ << " tuples output buffer ";
-    out << join.schema() << " (cumulative cost " << cost() << ')';
+    out << join.schema() << " (" << statistics() << ')';
 
     ++level;
     std::size_t i = children.size();
@@ -4680,7 +6758,83 @@ void Match<m::wasm::SimpleHashJoin<Unique, Predicated>>::print(std::ostream &out
     if (Unique) out << " on UNIQUE key ";
     if (this->buffer_factory_)
         out << "with " << this->buffer_num_tuples_ << " tuples output buffer ";
-    out << join.schema() << " (cumulative cost " << cost() << ')';
+    out << join.schema() << " (" << statistics() << ')';
+
+    ++level;
+    const MatchBase &build = children[0].get();
+    const MatchBase &probe = children[1].get();
+    indent(out, level) << "probe input";
+    probe.print(out, level + 1);
+    indent(out, level) << "build input";
+    build.print(out, level + 1);
+}
+
+void Match<m::wasm::RadixPartitionedHashJoin>::print(std::ostream &out, unsigned level) const
+{
+    indent(out, level) << "wasm::RadixPartitionedHashJoin ";
+    if (this->buffer_factory_)
+        out << "with " << this->buffer_num_tuples_ << " tuples output buffer ";
+    out << join.schema() << " (" << statistics() << ')';
+
+    ++level;
+    const MatchBase &build = children[0].get();
+    const MatchBase &probe = children[1].get();
+    indent(out, level) << "probe input";
+    probe.print(out, level + 1);
+    indent(out, level) << "build input";
+    build.print(out, level + 1);
+}
+
+void Match<m::wasm::BloomFilteredHashJoin>::print(std::ostream &out, unsigned level) const
+{
+    indent(out, level) << "wasm::BloomFilteredHashJoin ";
+    if (this->buffer_factory_)
+        out << "with " << this->buffer_num_tuples_ << " tuples output buffer ";
+    out << join.schema() << " (" << statistics() << ')';
+
+    ++level;
+    const MatchBase &build = children[0].get();
+    const MatchBase &probe = children[1].get();
+    indent(out, level) << "probe input";
+    probe.print(out, level + 1);
+    indent(out, level) << "build input";
+    build.print(out, level + 1);
+}
+
+void Match<m::wasm::SimpleHashSemiJoin>::print(std::ostream &out, unsigned level) const
+{
+    indent(out, level) << "wasm::SimpleHashSemiJoin ";
+    switch (join.kind()) {
+        case JoinOperator::J_Inner:         M_unreachable("not a semi-join");
+        case JoinOperator::J_Semi:          out << "semi ";             break;
+        case JoinOperator::J_Anti:          out << "anti ";             break;
+        case JoinOperator::J_NullAwareAnti: out << "null-aware anti ";  break;
+    }
+    if (this->buffer_factory_)
+        out << "with " << this->buffer_num_tuples_ << " tuples output buffer ";
+    out << join.schema() << " (" << statistics() << ')';
+
+    ++level;
+    const MatchBase &build = children[0].get();
+    const MatchBase &probe = children[1].get();
+    indent(out, level) << "probe input";
+    probe.print(out, level + 1);
+    indent(out, level) << "build input";
+    build.print(out, level + 1);
+}
+
+void Match<m::wasm::NestedLoopsSemiJoin>::print(std::ostream &out, unsigned level) const
+{
+    indent(out, level) << "wasm::NestedLoopsSemiJoin ";
+    switch (join.kind()) {
+        case JoinOperator::J_Inner:         M_unreachable("not a semi-join");
+        case JoinOperator::J_Semi:          out << "semi ";             break;
+        case JoinOperator::J_Anti:          out << "anti ";             break;
+        case JoinOperator::J_NullAwareAnti: out << "null-aware anti ";  break;
+    }
+    if (this->buffer_factory_)
+        out << "with " << this->buffer_num_tuples_ << " tuples output buffer ";
+    out << join.schema() << " (" << statistics() << ')';
 
     ++level;
     const MatchBase &build = children[0].get();
@@ -4708,7 +6862,7 @@ void Match<m::wasm::SortMergeJoin<SortLeft, SortRight, Predicated>>::print(std::
         out << "and materializing left input ";
     else if (this->right_materializing_factory)
         out << "and materializing right input ";
-    out << join.schema() << " (cumulative cost " << cost() << ')';
+    out << join.schema() << " (" << statistics() << ')';
 
     ++level;
     const MatchBase &left = children[0].get();
@@ -4721,7 +6875,13 @@ void Match<m::wasm::SortMergeJoin<SortLeft, SortRight, Predicated>>::print(std::
 
 void Match<m::wasm::Limit>::print(std::ostream &out, unsigned level) const
 {
-    indent(out, level) << "wasm::Limit " << limit.schema() << " (cumulative cost " << cost() << ')';
+    indent(out, level) << "wasm::Limit " << limit.schema() << " (" << statistics() << ')';
+    this->child.print(out, level + 1);
+}
+
+void Match<m::wasm::TopK>::print(std::ostream &out, unsigned level) const
+{
+    indent(out, level) << "wasm::TopK " << limit.schema() << " (" << statistics() << ')';
     this->child.print(out, level + 1);
 }
 
@@ -4730,7 +6890,7 @@ void Match<m::wasm::HashBasedGroupJoin>::print(std::ostream &out, unsigned level
     indent(out, level) << "wasm::HashBasedGroupJoin ";
     if (this->buffer_factory_)
         out << "with " << this->buffer_num_tuples_ << " tuples output buffer ";
-    out << grouping.schema() << " (cumulative cost " << cost() << ')';
+    out << grouping.schema() << " (" << statistics() << ')';
 
     ++level;
     const MatchBase &build = children[0].get();
@@ -33,30 +33,46 @@ namespace m {
 
 #define M_WASM_OPERATOR_LIST(X) \
     X(NoOp) \
+    X(IndexScan) \
+    X(LateMaterializingScan) \
     X(LazyDisjunctiveFilter) \
     X(Projection) \
     X(HashBasedGrouping) \
+    X(IdentityHashGrouping) \
     X(OrderedGrouping) \
     X(Aggregation) \
     X(Sorting) \
     X(NoOpSorting) \
     X(Limit) \
+    X(TopK) \
     X(HashBasedGroupJoin) \
+    X(RadixPartitionedHashJoin) \
+    X(BloomFilteredHashJoin) \
+    X(SimpleHashSemiJoin) \
+    X(NestedLoopsSemiJoin) \
     M_WASM_OPERATOR_LIST_TEMPLATED(X)
 
 
 // forward declarations
 #define M_WASM_OPERATOR_DECLARATION_LIST(X) \
     X(NoOp) \
+    X(IndexScan) \
+    X(LateMaterializingScan) \
     X(LazyDisjunctiveFilter) \
     X(Projection) \
     X(HashBasedGrouping) \
+    X(IdentityHashGrouping) \
     X(OrderedGrouping) \
     X(Aggregation) \
     X(Sorting) \
     X(NoOpSorting) \
     X(Limit) \
-    X(HashBasedGroupJoin)
+    X(TopK) \
+    X(HashBasedGroupJoin) \
+    X(RadixPartitionedHashJoin) \
+    X(BloomFilteredHashJoin) \
+    X(SimpleHashSemiJoin) \
+    X(NestedLoopsSemiJoin)
 #define DECLARE(OP) \
     namespace wasm { struct OP; } \
     template<> struct Match<wasm::OP>;
@@ -98,6 +114,9 @@ struct NoOp : PhysicalOperator<NoOp, NoOpOperator>
 template<bool SIMDfied>
 struct Callback : PhysicalOperator<Callback<SIMDfied>, CallbackOperator>
 {
+    ///> the multiple of which the batch size of a batched SIMDfied callback must be, s.t. windows fit all SIMD widths
+    static constexpr std::size_t WINDOW_SIZE_MULTIPLE = 64;
+
     static void execute(const Match<Callback> &M, setup_t setup, pipeline_t pipeline, teardown_t teardown);
     static double cost(const Match<Callback>&) { return 1.0; }
     static ConditionSet pre_condition(std::size_t child_idx,
@@ -123,6 +142,60 @@ struct Scan : PhysicalOperator<Scan<SIMDfied>, ScanOperator>
     static ConditionSet post_condition(const Match<Scan> &M);
 };
 
+/** Fuses a `FilterOperator` with its child `ScanOperator` if the filter contains sargable clauses, i.e.\ comparisons of
+ * an indexed attribute of the scanned table with a constant.  Looks up the range of qualifying keys in the `Index` and
+ * loads only the tuples of the row IDs in this range by point accesses.  The remaining clauses of the filter are
+ * evaluated on the loaded tuples. */
+struct IndexScan : PhysicalOperator<IndexScan, pattern_t<FilterOperator, ScanOperator>>
+{
+    ///> the number of row IDs copied from the index into linear memory at once
+    static constexpr uint32_t ROW_ID_BATCH_SIZE = 1024;
+
+    /** The range of keys of an `Index` qualifying for the sargable clauses of a filter. */
+    struct key_range_t
+    {
+        const Index *index; ///< the index to look up
+        int64_t lower; ///< the smallest qualifying key
+        int64_t upper; ///< the greatest qualifying key
+        cnf::CNF residual; ///< the clauses of the filter not answered by the index
+        std::size_t num_entries; ///< the number of index entries in the range at the time of optimization
+
+        bool empty() const { return lower > upper; }
+    };
+
+    /** Returns the key range of the index on the table scanned by \p scan with the fewest entries qualifying for the
+     * sargable clauses of \p filter, or `std::nullopt` if no clause of \p filter is sargable.  The indexes must be
+     * up to date, see `Index::update()`. */
+    static std::optional<key_range_t> Compute_Key_Range(const FilterOperator &filter, const ScanOperator &scan);
+
+    static void execute(const Match<IndexScan> &M, setup_t setup, pipeline_t pipeline, teardown_t teardown);
+    static double cost(const Match<IndexScan> &M);
+    static ConditionSet pre_condition(std::size_t child_idx,
+                                      const std::tuple<const FilterOperator*, const ScanOperator*>
+                                          &partial_inner_nodes);
+    static ConditionSet post_condition(const Match<IndexScan> &M);
+};
+
+/** Fuses a `FilterOperator` with its child `ScanOperator` to materialize tuples *late*.  Sequentially loads only the
+ * attributes referenced by the filter and evaluates the filter.  Loads the remaining attributes of the scan, the
+ * *payload*, only for qualifying tuples by point accesses.  Like `Scan`, skips zones rejected by the table's zone map,
+ * decides clauses on dictionary encoded attributes by their codes, and applies sideways filters.  Pays off for
+ * selective filters on wide tables whose data layout stores the values of each attribute consecutively, e.g.\ column
+ * stores. */
+struct LateMaterializingScan : PhysicalOperator<LateMaterializingScan, pattern_t<FilterOperator, ScanOperator>>
+{
+    /** Splits the schema of \p scan into the attributes referenced by \p filter and the payload. */
+    static std::pair<Schema, Schema> Split_Schema(const FilterOperator &filter, const ScanOperator &scan);
+
+    static void execute(const Match<LateMaterializingScan> &M, setup_t setup, pipeline_t pipeline,
+                        teardown_t teardown);
+    static double cost(const Match<LateMaterializingScan> &M);
+    static ConditionSet pre_condition(std::size_t child_idx,
+                                      const std::tuple<const FilterOperator*, const ScanOperator*>
+                                          &partial_inner_nodes);
+    static ConditionSet post_condition(const Match<LateMaterializingScan> &M);
+};
+
 template<bool Predicated>
 struct Filter : PhysicalOperator<Filter<Predicated>, FilterOperator>
 {
@@ -159,6 +232,22 @@ struct HashBasedGrouping : PhysicalOperator<HashBasedGrouping, GroupingOperator>
     static ConditionSet post_condition(const Match<HashBasedGrouping> &M);
 };
 
+/** Groups on a single integral key whose domain, i.e. the range between the minimum and maximum of the grouped
+ * attribute, is small.  The groups are kept in an array with one entry of aggregates and an occupancy bit per key of
+ * the domain, which is directly addressed by the key minus the minimum, i.e. keys are neither hashed, probed, nor
+ * compared.  A key outside of the domain, e.g. of a row appended after computing the domain, aborts the query. */
+struct IdentityHashGrouping : PhysicalOperator<IdentityHashGrouping, GroupingOperator>
+{
+    ///> the maximum size of the key domain, i.e. the maximum number of buckets required by distinct keys
+    static constexpr std::size_t MAX_DOMAIN_SIZE = 1UL << 18;
+
+    static void execute(const Match<IdentityHashGrouping> &M, setup_t setup, pipeline_t pipeline, teardown_t teardown);
+    static double cost(const Match<IdentityHashGrouping>&) { return 1.5; }
+    static ConditionSet pre_condition(std::size_t child_idx,
+                                      const std::tuple<const GroupingOperator*> &partial_inner_nodes);
+    static ConditionSet post_condition(const Match<IdentityHashGrouping> &M);
+};
+
 struct OrderedGrouping : PhysicalOperator<OrderedGrouping, GroupingOperator>
 {
     private:
@@ -260,6 +349,64 @@ struct SimpleHashJoin
                           std::vector<std::reference_wrapper<const ConditionSet>> &&post_cond_children);
 };
 
+/** A hash join that partitions both inputs by the radix bits of the join key's hash s.t. the hash table of each build
+ * partition fits into the cache, and then joins the inputs partition-wise. */
+struct RadixPartitionedHashJoin
+    : PhysicalOperator<RadixPartitionedHashJoin, pattern_t<JoinOperator, Wildcard, Wildcard>>
+{
+    static void execute(const Match<RadixPartitionedHashJoin> &M, setup_t setup, pipeline_t pipeline,
+                        teardown_t teardown);
+    static double cost(const Match<RadixPartitionedHashJoin> &M);
+    static ConditionSet
+    pre_condition(std::size_t child_idx,
+                  const std::tuple<const JoinOperator*, const Wildcard*, const Wildcard*> &partial_inner_nodes);
+    static ConditionSet post_condition(const Match<RadixPartitionedHashJoin> &M);
+};
+
+/** A hash join that builds a Bloom filter on the build keys alongside its hash table and installs it as sideways filter
+ * on the probe-side scan, s.t. probe tuples without join partner are mostly discarded right after being scanned. */
+struct BloomFilteredHashJoin
+    : PhysicalOperator<BloomFilteredHashJoin, pattern_t<JoinOperator, Wildcard, Wildcard>>
+{
+    static void execute(const Match<BloomFilteredHashJoin> &M, setup_t setup, pipeline_t pipeline,
+                        teardown_t teardown);
+    static double cost(const Match<BloomFilteredHashJoin> &M);
+    static ConditionSet
+    pre_condition(std::size_t child_idx,
+                  const std::tuple<const JoinOperator*, const Wildcard*, const Wildcard*> &partial_inner_nodes);
+    static ConditionSet post_condition(const Match<BloomFilteredHashJoin> &M);
+};
+
+/** A semi-join or anti-join that collects the distinct keys of the build input in a hash table and produces each tuple
+ * of the probe input at most once, depending on whether its key is found. */
+struct SimpleHashSemiJoin
+    : PhysicalOperator<SimpleHashSemiJoin, pattern_t<JoinOperator, Wildcard, Wildcard>>
+{
+    static void execute(const Match<SimpleHashSemiJoin> &M, setup_t setup, pipeline_t pipeline, teardown_t teardown);
+    static double cost(const Match<SimpleHashSemiJoin> &M);
+    static ConditionSet
+    pre_condition(std::size_t child_idx,
+                  const std::tuple<const JoinOperator*, const Wildcard*, const Wildcard*> &partial_inner_nodes);
+    static ConditionSet
+    adapt_post_conditions(const Match<SimpleHashSemiJoin> &M,
+                          std::vector<std::reference_wrapper<const ConditionSet>> &&post_cond_children);
+};
+
+/** A semi-join or anti-join that materializes the build input and evaluates the join predicate for each tuple of the
+ * probe input with the materialized tuples until the first match. */
+struct NestedLoopsSemiJoin
+    : PhysicalOperator<NestedLoopsSemiJoin, pattern_t<JoinOperator, Wildcard, Wildcard>>
+{
+    static void execute(const Match<NestedLoopsSemiJoin> &M, setup_t setup, pipeline_t pipeline, teardown_t teardown);
+    static double cost(const Match<NestedLoopsSemiJoin> &M);
+    static ConditionSet
+    pre_condition(std::size_t child_idx,
+                  const std::tuple<const JoinOperator*, const Wildcard*, const Wildcard*> &partial_inner_nodes);
+    static ConditionSet
+    adapt_post_conditions(const Match<NestedLoopsSemiJoin> &M,
+                          std::vector<std::reference_wrapper<const ConditionSet>> &&post_cond_children);
+};
+
 template<bool SortLeft, bool SortRight, bool Predicated>
 struct SortMergeJoin
     : PhysicalOperator<SortMergeJoin<SortLeft, SortRight, Predicated>, pattern_t<JoinOperator, Wildcard, Wildcard>>
@@ -282,6 +429,23 @@ struct Limit : PhysicalOperator<Limit, LimitOperator>
                                       const std::tuple<const LimitOperator*> &partial_inner_nodes);
 };
 
+/** Fuses a `LimitOperator` with its child `SortingOperator`:  keeps only the first *k = offset + limit* tuples
+ * according to the ordering in a bounded max-heap of *k* tuples instead of materializing and sorting the entire input.
+ * The root of the heap is the greatest of the current top-*k* tuples and is replaced by each smaller incoming tuple.
+ * Only pays off if *k* is small relative to the size of the input. */
+struct TopK : PhysicalOperator<TopK, pattern_t<LimitOperator, SortingOperator>>
+{
+    ///> the maximum number of tuples, i.e. offset plus limit, to keep in the heap
+    static constexpr std::size_t MAX_K = 1UL << 16;
+
+    static void execute(const Match<TopK> &M, setup_t setup, pipeline_t pipeline, teardown_t teardown);
+    static double cost(const Match<TopK> &M);
+    static ConditionSet pre_condition(std::size_t child_idx,
+                                      const std::tuple<const LimitOperator*, const SortingOperator*>
+                                          &partial_inner_nodes);
+    static ConditionSet post_condition(const Match<TopK> &M);
+};
+
 struct HashBasedGroupJoin
     : PhysicalOperator<HashBasedGroupJoin, pattern_t<GroupingOperator, pattern_t<JoinOperator, Wildcard, Wildcard>>>
 {
@@ -333,7 +497,7 @@ struct Match<wasm::NoOp> : MatchBase
         M_insist(children.size() == 1);
     }
 
-    void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
         wasm::NoOp::execute(*this, std::move(setup), std::move(pipeline), std::move(teardown));
     }
     std::string name() const override { return "wasm::NoOp"; }
@@ -350,6 +514,7 @@ struct Match<wasm::Callback<SIMDfied>> : MatchBase
     std::unique_ptr<const storage::DataLayoutFactory> result_set_factory;
     std::optional<std::size_t> result_set_num_tuples_;
 
+
     Match(const CallbackOperator *Callback, std::vector<std::reference_wrapper<const MatchBase>> &&children)
         : callback(*Callback)
         , child(children[0])
@@ -359,9 +524,17 @@ struct Match<wasm::Callback<SIMDfied>> : MatchBase
         )) // TODO: let optimizer decide this
     {
         M_insist(children.size() == 1);
+
+        /*----- A batched callback reads each window of the result set as a single PAX block, i.e.\ in columns, and as
+         * a single batch.  Thus, the window size is the batch size. -----*/
+        if (callback.is_batched()) {
+            result_set_factory = std::make_unique<storage::PAXLayoutFactory>(storage::PAXLayoutFactory::NTuples,
+                                                                             callback.batch_size());
+            result_set_num_tuples_ = callback.batch_size();
+        }
     }
 
-    void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
         wasm::Callback<SIMDfied>::execute(*this, std::move(setup), std::move(pipeline), std::move(teardown));
     }
     std::string name() const override { return "wasm::Callback"; }
@@ -389,7 +562,7 @@ struct Match<wasm::Print<SIMDfied>> : MatchBase
         M_insist(children.size() == 1);
     }
 
-    void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
         wasm::Print<SIMDfied>::execute(*this, std::move(setup), std::move(pipeline), std::move(teardown));
     }
     std::string name() const override { return "wasm::Print"; }
@@ -413,7 +586,7 @@ struct Match<wasm::Scan<SIMDfied>> : MatchBase
         M_insist(children.empty());
     }
 
-    void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
         if (buffer_factory_) {
             auto buffer_schema = scan.schema().drop_constants().deduplicate();
             if (buffer_schema.num_entries()) {
@@ -447,6 +620,74 @@ struct Match<wasm::Scan<SIMDfied>> : MatchBase
     void print(std::ostream &out, unsigned level) const override;
 };
 
+template<>
+struct Match<wasm::IndexScan> : MatchBase
+{
+    const FilterOperator &filter;
+    const ScanOperator &scan;
+    const wasm::IndexScan::key_range_t range;
+
+    Match(const FilterOperator *filter, const ScanOperator *scan,
+          std::vector<std::reference_wrapper<const MatchBase>> &&children)
+        : filter(*filter)
+        , scan(*scan)
+        , range(wasm::IndexScan::Compute_Key_Range(*filter, *scan).value())
+    {
+        M_insist(children.empty());
+    }
+
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+        wasm::IndexScan::execute(*this, std::move(setup), std::move(pipeline), std::move(teardown));
+    }
+
+    std::string name() const override {
+        std::ostringstream oss;
+        oss << "wasm::IndexScan(" << scan.alias() << ')';
+        return oss.str();
+    }
+
+    protected:
+    void print(std::ostream &out, unsigned level) const override;
+};
+
+template<>
+struct Match<wasm::LateMaterializingScan> : MatchBase
+{
+    const FilterOperator &filter;
+    const ScanOperator &scan;
+    const Schema predicate_schema; ///< the attributes of the scan referenced by the filter
+    const Schema payload_schema; ///< the remaining attributes of the scan
+
+    Match(const FilterOperator *filter, const ScanOperator *scan,
+          std::vector<std::reference_wrapper<const MatchBase>> &&children)
+        : Match(*filter, *scan, wasm::LateMaterializingScan::Split_Schema(*filter, *scan))
+    {
+        M_insist(children.empty());
+    }
+
+    private:
+    Match(const FilterOperator &filter, const ScanOperator &scan, std::pair<Schema, Schema> schemas)
+        : filter(filter)
+        , scan(scan)
+        , predicate_schema(std::move(schemas.first))
+        , payload_schema(std::move(schemas.second))
+    { }
+
+    public:
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+        wasm::LateMaterializingScan::execute(*this, std::move(setup), std::move(pipeline), std::move(teardown));
+    }
+
+    std::string name() const override {
+        std::ostringstream oss;
+        oss << "wasm::LateMaterializingScan(" << scan.alias() << ')';
+        return oss.str();
+    }
+
+    protected:
+    void print(std::ostream &out, unsigned level) const override;
+};
+
 template<bool Predicated>
 struct Match<wasm::Filter<Predicated>> : MatchBase
 {
@@ -464,7 +705,7 @@ struct Match<wasm::Filter<Predicated>> : MatchBase
         M_insist(children.size() == 1);
     }
 
-    void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
         execute_buffered(*this, filter.schema(), buffer_factory_, buffer_num_tuples_,
                          std::move(setup), std::move(pipeline), std::move(teardown));
     }
@@ -494,7 +735,7 @@ struct Match<wasm::LazyDisjunctiveFilter> : MatchBase
         M_insist(children.size() == 1);
     }
 
-    void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
         execute_buffered(*this, filter.schema(), buffer_factory_, buffer_num_tuples_,
                          std::move(setup), std::move(pipeline), std::move(teardown));
     }
@@ -522,7 +763,7 @@ struct Match<wasm::Projection> : MatchBase
         }
     }
 
-    void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
         wasm::Projection::execute(*this, std::move(setup), std::move(pipeline), std::move(teardown));
     }
     std::string name() const override { return "wasm::Projection"; }
@@ -544,7 +785,7 @@ struct Match<wasm::HashBasedGrouping> : MatchBase
         M_insist(children.size() == 1);
     }
 
-    void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
         wasm::HashBasedGrouping::execute(*this, std::move(setup), std::move(pipeline), std::move(teardown));
     }
     std::string name() const override { return "wasm::HashBasedGrouping"; }
@@ -553,6 +794,28 @@ struct Match<wasm::HashBasedGrouping> : MatchBase
     void print(std::ostream &out, unsigned level) const override;
 };
 
+template<>
+struct Match<wasm::IdentityHashGrouping> : MatchBase
+{
+    const GroupingOperator &grouping;
+    const MatchBase &child;
+
+    Match(const GroupingOperator *grouping, std::vector<std::reference_wrapper<const MatchBase>> &&children)
+        : grouping(*grouping)
+        , child(children[0])
+    {
+        M_insist(children.size() == 1);
+    }
+
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+        wasm::IdentityHashGrouping::execute(*this, std::move(setup), std::move(pipeline), std::move(teardown));
+    }
+    std::string name() const override { return "wasm::IdentityHashGrouping"; }
+
+    protected:
+    void print(std::ostream &out, unsigned level) const override;
+};
+
 template<>
 struct Match<wasm::OrderedGrouping> : MatchBase
 {
@@ -566,7 +829,7 @@ struct Match<wasm::OrderedGrouping> : MatchBase
         M_insist(children.size() == 1);
     }
 
-    void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
         wasm::OrderedGrouping::execute(*this, std::move(setup), std::move(pipeline), std::move(teardown));
     }
     std::string name() const override { return "wasm::OrderedGrouping"; }
@@ -588,7 +851,7 @@ struct Match<wasm::Aggregation> : MatchBase
         M_insist(children.size() == 1);
     }
 
-    void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
         wasm::Aggregation::execute(*this, std::move(setup), std::move(pipeline), std::move(teardown));
     }
     std::string name() const override { return "wasm::Aggregation"; }
@@ -612,7 +875,7 @@ struct Match<wasm::Sorting> : MatchBase
         M_insist(children.size() == 1);
     }
 
-    void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
         wasm::Sorting::execute(*this, std::move(setup), std::move(pipeline), std::move(teardown));
     }
     std::string name() const override { return "wasm::Sorting"; }
@@ -632,7 +895,7 @@ struct Match<wasm::NoOpSorting> : MatchBase
         M_insist(children.size() == 1);
     }
 
-    void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
         wasm::NoOpSorting::execute(*this, std::move(setup), std::move(pipeline), std::move(teardown));
     }
     std::string name() const override { return "wasm::NoOpSorting"; }
@@ -662,7 +925,7 @@ struct Match<wasm::NestedLoopsJoin<Predicated>> : MatchBase
             materializing_factories_.emplace_back(std::make_unique<storage::RowLayoutFactory>()); // TODO: let optimizer decide this
     }
 
-    void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
         execute_buffered(*this, join.schema(), buffer_factory_, buffer_num_tuples_,
                          std::move(setup), std::move(pipeline), std::move(teardown));
     }
@@ -697,7 +960,7 @@ struct Match<wasm::SimpleHashJoin<UniqueBuild, Predicated>> : MatchBase
         M_insist(this->children.size() == 2);
     }
 
-    void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
         execute_buffered(*this, join.schema(), buffer_factory_, buffer_num_tuples_,
                          std::move(setup), std::move(pipeline), std::move(teardown));
     }
@@ -713,6 +976,142 @@ struct Match<wasm::SimpleHashJoin<UniqueBuild, Predicated>> : MatchBase
     void print(std::ostream &out, unsigned level) const override;
 };
 
+template<>
+struct Match<wasm::RadixPartitionedHashJoin> : MatchBase
+{
+    private:
+    std::unique_ptr<const storage::DataLayoutFactory> buffer_factory_;
+    std::size_t buffer_num_tuples_;
+    public:
+    const JoinOperator &join;
+    const Wildcard &build;
+    const Wildcard &probe;
+    std::vector<std::reference_wrapper<const MatchBase>> children;
+    std::unique_ptr<const storage::DataLayoutFactory> materializing_factory;
+
+    Match(const JoinOperator *join, const Wildcard *build, const Wildcard *probe,
+          std::vector<std::reference_wrapper<const MatchBase>> &&children)
+        : join(*join)
+        , build(*build)
+        , probe(*probe)
+        , children(std::move(children))
+        , materializing_factory(std::make_unique<storage::RowLayoutFactory>()) // TODO: let optimizer decide this
+    {
+        M_insist(this->children.size() == 2);
+    }
+
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+        execute_buffered(*this, join.schema(), buffer_factory_, buffer_num_tuples_,
+                         std::move(setup), std::move(pipeline), std::move(teardown));
+    }
+
+    std::string name() const override { return "wasm::RadixPartitionedHashJoin"; }
+
+    protected:
+    void print(std::ostream &out, unsigned level) const override;
+};
+
+template<>
+struct Match<wasm::BloomFilteredHashJoin> : MatchBase
+{
+    private:
+    std::unique_ptr<const storage::DataLayoutFactory> buffer_factory_;
+    std::size_t buffer_num_tuples_;
+    public:
+    const JoinOperator &join;
+    const Wildcard &build;
+    const Wildcard &probe;
+    std::vector<std::reference_wrapper<const MatchBase>> children;
+
+    Match(const JoinOperator *join, const Wildcard *build, const Wildcard *probe,
+          std::vector<std::reference_wrapper<const MatchBase>> &&children)
+        : join(*join)
+        , build(*build)
+        , probe(*probe)
+        , children(std::move(children))
+    {
+        M_insist(this->children.size() == 2);
+    }
+
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+        execute_buffered(*this, join.schema(), buffer_factory_, buffer_num_tuples_,
+                         std::move(setup), std::move(pipeline), std::move(teardown));
+    }
+
+    std::string name() const override { return "wasm::BloomFilteredHashJoin"; }
+
+    protected:
+    void print(std::ostream &out, unsigned level) const override;
+};
+
+template<>
+struct Match<wasm::SimpleHashSemiJoin> : MatchBase
+{
+    private:
+    std::unique_ptr<const storage::DataLayoutFactory> buffer_factory_;
+    std::size_t buffer_num_tuples_;
+    public:
+    const JoinOperator &join;
+    const Wildcard &build;
+    const Wildcard &probe;
+    std::vector<std::reference_wrapper<const MatchBase>> children;
+
+    Match(const JoinOperator *join, const Wildcard *build, const Wildcard *probe,
+          std::vector<std::reference_wrapper<const MatchBase>> &&children)
+        : join(*join)
+        , build(*build)
+        , probe(*probe)
+        , children(std::move(children))
+    {
+        M_insist(this->children.size() == 2);
+    }
+
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+        execute_buffered(*this, join.schema(), buffer_factory_, buffer_num_tuples_,
+                         std::move(setup), std::move(pipeline), std::move(teardown));
+    }
+
+    std::string name() const override { return "wasm::SimpleHashSemiJoin"; }
+
+    protected:
+    void print(std::ostream &out, unsigned level) const override;
+};
+
+template<>
+struct Match<wasm::NestedLoopsSemiJoin> : MatchBase
+{
+    private:
+    std::unique_ptr<const storage::DataLayoutFactory> buffer_factory_;
+    std::size_t buffer_num_tuples_;
+    public:
+    const JoinOperator &join;
+    const Wildcard &build;
+    const Wildcard &probe;
+    std::vector<std::reference_wrapper<const MatchBase>> children;
+    std::unique_ptr<const storage::DataLayoutFactory> materializing_factory;
+
+    Match(const JoinOperator *join, const Wildcard *build, const Wildcard *probe,
+          std::vector<std::reference_wrapper<const MatchBase>> &&children)
+        : join(*join)
+        , build(*build)
+        , probe(*probe)
+        , children(std::move(children))
+        , materializing_factory(std::make_unique<storage::RowLayoutFactory>()) // TODO: let optimizer decide this
+    {
+        M_insist(this->children.size() == 2);
+    }
+
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+        execute_buffered(*this, join.schema(), buffer_factory_, buffer_num_tuples_,
+                         std::move(setup), std::move(pipeline), std::move(teardown));
+    }
+
+    std::string name() const override { return "wasm::NestedLoopsSemiJoin"; }
+
+    protected:
+    void print(std::ostream &out, unsigned level) const override;
+};
+
 template<bool SortLeft, bool SortRight, bool Predicated>
 struct Match<wasm::SortMergeJoin<SortLeft, SortRight, Predicated>> : MatchBase
 {
@@ -735,7 +1134,7 @@ struct Match<wasm::SortMergeJoin<SortLeft, SortRight, Predicated>> : MatchBase
         M_insist(this->children.size() == 2);
     }
 
-    void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
         wasm::SortMergeJoin<SortLeft, SortRight, Predicated>::execute(
             *this, std::move(setup), std::move(pipeline), std::move(teardown)
         );
@@ -773,7 +1172,7 @@ struct Match<wasm::Limit> : MatchBase
         M_insist(children.size() == 1);
     }
 
-    void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
         wasm::Limit::execute(*this, std::move(setup), std::move(pipeline), std::move(teardown));
     }
     std::string name() const override { return "wasm::Limit"; }
@@ -782,6 +1181,33 @@ struct Match<wasm::Limit> : MatchBase
     void print(std::ostream &out, unsigned level) const override;
 };
 
+template<>
+struct Match<wasm::TopK> : MatchBase
+{
+    const LimitOperator &limit;
+    const SortingOperator &sorting;
+    const MatchBase &child;
+    std::unique_ptr<const storage::DataLayoutFactory> materializing_factory;
+
+    Match(const LimitOperator *limit, const SortingOperator *sorting,
+          std::vector<std::reference_wrapper<const MatchBase>> &&children)
+        : limit(*limit)
+        , sorting(*sorting)
+        , child(children[0])
+        , materializing_factory(std::make_unique<storage::RowLayoutFactory>()) // TODO: let optimizer decide this
+    {
+        M_insist(children.size() == 1);
+    }
+
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+        wasm::TopK::execute(*this, std::move(setup), std::move(pipeline), std::move(teardown));
+    }
+    std::string name() const override { return "wasm::TopK"; }
+
+    protected:
+    void print(std::ostream &out, unsigned level) const override;
+};
+
 template<>
 struct Match<wasm::HashBasedGroupJoin> : MatchBase
 {
@@ -806,7 +1232,7 @@ struct Match<wasm::HashBasedGroupJoin> : MatchBase
         M_insist(this->children.size() == 2);
     }
 
-    void execute(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
+    void execute_impl(setup_t setup, pipeline_t pipeline, teardown_t teardown) const override {
         execute_buffered(*this, grouping.schema(), buffer_factory_, buffer_num_tuples_,
                          std::move(setup), std::move(pipeline), std::move(teardown));
     }
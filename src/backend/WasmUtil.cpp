@@ -2,8 +2,11 @@
 
 #include "backend/Interpreter.hpp"
 #include "backend/WasmMacro.hpp"
+#include <mutable/storage/Dictionary.hpp>
 #include <mutable/util/concepts.hpp>
 #include <optional>
+#include <sstream>
+#include <utility>
 
 
 using namespace m;
@@ -142,6 +145,58 @@ void ExprCompiler::operator()(const ast::Constant &e)
         return;
     }
 
+    if (e.is_placeholder()) { // read the value bound upon execution from an imported global, see `create_env()`
+        const std::string name = "param_" + std::to_string(e.placeholder_index());
+        auto set_parameter = [this, &e, &name]<std::size_t L>(){
+            auto set_helper = overloaded {
+                [this]<sql_type T>(T &&actual) { this->set(std::forward<T>(actual)); },
+                [](auto&&) { M_unreachable("not a SQL type"); }
+            };
+            auto load = [&name]<typename T>() -> PrimitiveExpr<T, L> {
+                auto value = Module::Get().get_global<T>(name.c_str());
+                if constexpr (L == 1)
+                    return value;
+                else
+                    return value.template broadcast<L>();
+            };
+
+            visit(overloaded {
+                [&](const Boolean&) { set_helper(_Bool<L>(load.template operator()<bool>())); },
+                [&](const Numeric &n) {
+                    switch (n.kind) {
+                        case Numeric::N_Int:
+                        case Numeric::N_Decimal:
+                            switch (n.size()) {
+                                default: M_unreachable("invalid integer size");
+                                case  8: set_helper(_I8<L>(load.template operator()<int8_t>()));   break;
+                                case 16: set_helper(_I16<L>(load.template operator()<int16_t>())); break;
+                                case 32: set_helper(_I32<L>(load.template operator()<int32_t>())); break;
+                                case 64: set_helper(_I64<L>(load.template operator()<int64_t>())); break;
+                            }
+                            break;
+                        case Numeric::N_Float:
+                            if (n.size() <= 32)
+                                set_helper(_Float<L>(load.template operator()<float>()));
+                            else
+                                set_helper(_Double<L>(load.template operator()<double>()));
+                    }
+                },
+                [&](const Date&) { set_helper(_I32<L>(load.template operator()<int32_t>())); },
+                [&](const DateTime&) { set_helper(_I64<L>(load.template operator()<int64_t>())); },
+                [](auto&&) { M_unreachable("invalid type of placeholder"); },
+            }, *e.type());
+        };
+        switch (CodeGenContext::Get().num_simd_lanes()) {
+            default: M_unreachable("invalid number of SIMD lanes");
+            case  1: set_parameter.operator()<1>();  break;
+            case  2: set_parameter.operator()<2>();  break;
+            case  4: set_parameter.operator()<4>();  break;
+            case  8: set_parameter.operator()<8>();  break;
+            case 16: set_parameter.operator()<16>(); break;
+        }
+        return;
+    }
+
     /* Interpret constant. */
     auto value = Interpreter::eval(e);
 
@@ -298,7 +353,8 @@ void ExprCompiler::operator()(const ast::BinaryExpr &e)
         case TK_PERCENT:        BINOP(%);
 
         /*----- Comparison operations --------------------------------------------------------------------------------*/
-        case TK_EQUAL:          CMPOP(==, EQ);
+        case TK_EQUAL:
+        case TK_In:             CMPOP(==, EQ); // within a semi-join, `IN` compares with a single value
         case TK_BANG_EQUAL:     CMPOP(!=, NE);
         case TK_LESS:           CMPOP(<,  LT);
         case TK_LESS_EQUAL:     CMPOP(<=, LE);
@@ -479,6 +535,13 @@ thread_local std::unique_ptr<CodeGenContext> CodeGenContext::the_context_;
  * compile data layout
  *====================================================================================================================*/
 
+Ptr<Charx1> m::wasm::dictionary_entries(const Dictionary &dictionary)
+{
+    std::ostringstream oss;
+    oss << "dict_" << dictionary.id << "_mem";
+    return Module::Get().get_global<void*>(oss.str().c_str()).to<char*>();
+}
+
 namespace m {
 
 namespace wasm {
@@ -1055,7 +1118,9 @@ compile_data_layout_sequential(const Schema &tuple_schema, Ptr<void> base_addres
                 }
             } else { // regular entry
                 auto &layout_entry = layout_schema[leaf_info.leaf.index()];
-                M_insist(*layout_entry.type == *leaf_info.leaf.type());
+                M_insist(leaf_info.leaf.dictionary() ? *leaf_info.leaf.type() == *Dictionary::Code_Type()
+                         : leaf_info.leaf.reference() ? leaf_info.leaf.type()->is_integral()
+                                                      : *layout_entry.type == *leaf_info.leaf.type());
                 auto tuple_it = tuple_schema.find(layout_entry.id);
                 if (tuple_it == tuple_schema.end())
                     continue; // entry not contained in tuple schema
@@ -1190,6 +1255,7 @@ compile_data_layout_sequential(const Schema &tuple_schema, Ptr<void> base_addres
                             static constexpr std::size_t lanes = T::num_simd_lanes;
                             M_insist(static_bit_offset == 0,
                                      "leaf offset of `Numeric`, `Date`, or `DateTime` must be byte aligned");
+                            M_insist(not leaf_info.leaf.reference(), "cannot store to compressed leaf");
                             BLOCK_OPEN(stores) {
                                 auto [value, is_null] = env.get<T>(tuple_it->id).split(); // get value
                                 is_null.discard(); // handled at NULL bitmap leaf
@@ -1207,11 +1273,36 @@ compile_data_layout_sequential(const Schema &tuple_schema, Ptr<void> base_addres
                             static constexpr std::size_t lanes = T::num_simd_lanes;
                             M_insist(static_bit_offset == 0,
                                      "leaf offset of `Numeric`, `Date`, or `DateTime` must be byte aligned");
-                            BLOCK_OPEN(loads) {
-                                Var<PrimitiveExpr<type, lanes>> value(
-                                    *(ptr + static_byte_offset).template to<type*, lanes>()
-                                );
-                                new (&values[tuple_idx]) SQL_t(T(value));
+                            if (auto reference = leaf_info.leaf.reference()) {
+                                /* Decompress by loading the differences in the narrower type of the leaf, widening
+                                 * them lane-wise to the type of the attribute, and adding the frame of reference. */
+                                auto decompress = [&]<typename C>() {
+                                    if constexpr (std::is_integral_v<type> and sizeof(C) < sizeof(type)) {
+                                        BLOCK_OPEN(loads) {
+                                            PrimitiveExpr<C, lanes> delta =
+                                                *(ptr + static_byte_offset).template to<C*, lanes>();
+                                            Var<PrimitiveExpr<type, lanes>> value(
+                                                delta.template to<type, lanes>() + type(*reference)
+                                            );
+                                            new (&values[tuple_idx]) SQL_t(T(value));
+                                        }
+                                    } else {
+                                        M_unreachable("invalid type of compressed leaf");
+                                    }
+                                };
+                                switch (leaf_info.leaf.type()->size()) {
+                                    default: M_unreachable("invalid size of compressed leaf");
+                                    case  8: decompress.template operator()<int8_t>();  break;
+                                    case 16: decompress.template operator()<int16_t>(); break;
+                                    case 32: decompress.template operator()<int32_t>(); break;
+                                }
+                            } else {
+                                BLOCK_OPEN(loads) {
+                                    Var<PrimitiveExpr<type, lanes>> value(
+                                        *(ptr + static_byte_offset).template to<type*, lanes>()
+                                    );
+                                    new (&values[tuple_idx]) SQL_t(T(value));
+                                }
                             }
                         },
                         []<typename>() {
@@ -1274,6 +1365,7 @@ compile_data_layout_sequential(const Schema &tuple_schema, Ptr<void> base_addres
                             M_insist(static_bit_offset == 0, "leaf offset of `CharacterSequence` must be byte aligned");
                             if constexpr (IsStore) {
                                 /*----- Store value. -----*/
+                                M_insist(not leaf_info.leaf.dictionary(), "cannot store to dictionary encoded leaf");
                                 BLOCK_OPEN(stores) {
                                     auto value = env.get<NChar>(tuple_it->id); // get value
                                     IF (value.clone().not_null()) {
@@ -1284,7 +1376,15 @@ compile_data_layout_sequential(const Schema &tuple_schema, Ptr<void> base_addres
                             } else {
                                 /*----- Load value. -----*/
                                 BLOCK_OPEN(loads) {
-                                    Ptr<Charx1> address((ptr + static_byte_offset).template to<char*>());
+                                    Ptr<Charx1> address = [&]() -> Ptr<Charx1> {
+                                        if (auto dictionary = leaf_info.leaf.dictionary()) {
+                                            /* Decode the code to the address of its entry in the dictionary. */
+                                            U32x1 code = *(ptr + static_byte_offset).template to<uint32_t*>();
+                                            return dictionary_entries(*dictionary) +
+                                                   (code * uint32_t(dictionary->entry_size())).make_signed();
+                                        }
+                                        return (ptr + static_byte_offset).template to<char*>();
+                                    }();
                                     new (&values[tuple_idx]) SQL_t(
                                         NChar(address, layout_entry.nullable(), cs.length, cs.is_varying)
                                     );
@@ -2009,7 +2109,9 @@ void compile_data_layout_point_access(const Schema &tuple_schema, Ptr<void> base
                 }
             } else { // regular entry
                 auto &layout_entry = layout_schema[leaf_info.leaf.index()];
-                M_insist(*layout_entry.type == *leaf_info.leaf.type());
+                M_insist(leaf_info.leaf.dictionary() ? *leaf_info.leaf.type() == *Dictionary::Code_Type()
+                         : leaf_info.leaf.reference() ? leaf_info.leaf.type()->is_integral()
+                                                      : *layout_entry.type == *leaf_info.leaf.type());
                 auto tuple_it = tuple_schema.find(layout_entry.id);
                 if (tuple_it == tuple_schema.end())
                     continue; // entry not contained in tuple schema
@@ -2062,6 +2164,7 @@ void compile_data_layout_point_access(const Schema &tuple_schema, Ptr<void> base
                         using type = typename T::type;
                         M_insist(static_bit_offset == 0,
                                  "leaf offset of `Numeric`, `Date`, or `DateTime` must be byte aligned");
+                        M_insist(not leaf_info.leaf.reference(), "cannot store to compressed leaf");
                         auto [value, is_null] = env.get<T>(tuple_it->id).split(); // get value
                         is_null.discard(); // handled at NULL bitmap leaf
                         *(ptr + static_byte_offset).template to<type*>() = value;
@@ -2071,8 +2174,28 @@ void compile_data_layout_point_access(const Schema &tuple_schema, Ptr<void> base
                         using type = typename T::type;
                         M_insist(static_bit_offset == 0,
                                  "leaf offset of `Numeric`, `Date`, or `DateTime` must be byte aligned");
-                        Var<PrimitiveExpr<type>> value(*(ptr + static_byte_offset).template to<type*>());
-                        new (&values[tuple_idx]) SQL_t(T(value));
+                        if (auto reference = leaf_info.leaf.reference()) {
+                            /* Decompress by loading the difference in the narrower type of the leaf, widening it to
+                             * the type of the attribute, and adding the frame of reference. */
+                            auto decompress = [&]<typename C>() {
+                                if constexpr (std::is_integral_v<type> and sizeof(C) < sizeof(type)) {
+                                    PrimitiveExpr<C> delta = *(ptr + static_byte_offset).template to<C*>();
+                                    Var<PrimitiveExpr<type>> value(delta.template to<type>() + type(*reference));
+                                    new (&values[tuple_idx]) SQL_t(T(value));
+                                } else {
+                                    M_unreachable("invalid type of compressed leaf");
+                                }
+                            };
+                            switch (leaf_info.leaf.type()->size()) {
+                                default: M_unreachable("invalid size of compressed leaf");
+                                case  8: decompress.template operator()<int8_t>();  break;
+                                case 16: decompress.template operator()<int16_t>(); break;
+                                case 32: decompress.template operator()<int32_t>(); break;
+                            }
+                        } else {
+                            Var<PrimitiveExpr<type>> value(*(ptr + static_byte_offset).template to<type*>());
+                            new (&values[tuple_idx]) SQL_t(T(value));
+                        }
                     };
                     /*----- Select call target (store or load) and visit attribute type. -----*/
 #define CALL(TYPE) if constexpr (IsStore) store.template operator()<TYPE>(); else load.template operator()<TYPE>()
@@ -2113,15 +2236,25 @@ void compile_data_layout_point_access(const Schema &tuple_schema, Ptr<void> base
                         },
                         [&](const CharacterSequence &cs) {
                             M_insist(static_bit_offset == 0, "leaf offset of `CharacterSequence` must be byte aligned");
-                            Ptr<Charx1> addr = (ptr + static_byte_offset).template to<char*>();
                             if constexpr (IsStore) {
                                 /*----- Store value. -----*/
+                                M_insist(not leaf_info.leaf.dictionary(), "cannot store to dictionary encoded leaf");
+                                Ptr<Charx1> addr = (ptr + static_byte_offset).template to<char*>();
                                 auto value = env.get<NChar>(tuple_it->id); // get value
                                 IF (value.clone().not_null()) {
                                     strncpy(addr, value, U32x1(cs.size() / 8)).discard();
                                 };
                             } else {
                                 /*----- Load value. -----*/
+                                Ptr<Charx1> addr = [&]() -> Ptr<Charx1> {
+                                    if (auto dictionary = leaf_info.leaf.dictionary()) {
+                                        /* Decode the code to the address of its entry in the dictionary. */
+                                        U32x1 code = *(ptr + static_byte_offset).template to<uint32_t*>();
+                                        return dictionary_entries(*dictionary) +
+                                               (code * uint32_t(dictionary->entry_size())).make_signed();
+                                    }
+                                    return (ptr + static_byte_offset).template to<char*>();
+                                }();
                                 new (&values[tuple_idx]) SQL_t(
                                     NChar(addr, layout_entry.nullable(), cs.length, cs.is_varying)
                                 );
@@ -3104,6 +3237,61 @@ _Boolx1 m::wasm::like(NChar _str, NChar _pattern, const char escape_char)
 }
 
 
+/*======================================================================================================================
+ * per-lane execution
+ *====================================================================================================================*/
+
+U32x1 m::wasm::num_qualifying_tuples(SQL_boolean_t &&pred)
+{
+    return std::visit(overloaded {
+        [](std::monostate) -> U32x1 { M_unreachable("invalid predicate"); },
+        []<sql_boolean_type T>(T &&pred) -> U32x1 {
+            M_insist(T::num_simd_lanes == CodeGenContext::Get().num_simd_lanes(),
+                     "number of SIMD lanes of predicate and pipeline must match");
+            if constexpr (T::num_simd_lanes == 1)
+                return pred.is_true_and_not_null().template to<uint32_t>();
+            else
+                return pred.is_true_and_not_null().bitmask().popcnt();
+        },
+    }, std::move(pred));
+}
+
+void m::wasm::execute_per_lane(const pipeline_t &pipeline)
+{
+    auto &context = CodeGenContext::Get();
+    const Environment &env = context.env(); // remains the outer environment while the lanes are emitted
+    M_insist(env.predicated(), "per-lane execution requires predication");
+
+    std::visit(overloaded {
+        [](std::monostate) -> void { M_unreachable("invalid predicate"); },
+        [&]<sql_boolean_type T>(T &&_pred) -> void {
+            static constexpr std::size_t L = T::num_simd_lanes;
+            M_insist(L == context.num_simd_lanes(), "number of SIMD lanes of predicate and pipeline must match");
+            if constexpr (L == 1) {
+                M_unreachable("scalar tuples need no per-lane execution");
+            } else {
+                /*----- Evaluate the predicate only once for all lanes. -----*/
+                const Var<PrimitiveExpr<bool, L>> pred(_pred.is_true_and_not_null());
+
+                /*----- Emit the pipeline for each lane, but skip the entire SIMD batch if no lane fulfills the
+                 * predicate. -----*/
+                IF (pred.val().any_true()) {
+                    context.set_num_simd_lanes(1);
+                    [&]<std::size_t... Lanes>(std::index_sequence<Lanes...>) {
+                        ([&](){
+                            auto S = context.scoped_environment(env.get_lane<Lanes>());
+                            context.env().add_predicate(_Boolx1(pred.template extract<Lanes>()));
+                            pipeline();
+                        }(), ...);
+                    }(std::make_index_sequence<L>());
+                    context.set_num_simd_lanes(L);
+                };
+            }
+        },
+    }, context.env().extract_predicate());
+}
+
+
 /*======================================================================================================================
  * comparator
  *====================================================================================================================*/
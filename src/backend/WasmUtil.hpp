@@ -2,12 +2,16 @@
 
 #include "backend/PhysicalOperator.hpp"
 #include "backend/WasmDSL.hpp"
+#include <algorithm>
 #include <functional>
+#include <memory>
 #include <mutable/catalog/Schema.hpp>
 #include <mutable/parse/AST.hpp>
 #include <mutable/util/concepts.hpp>
 #include <optional>
+#include <string_view>
 #include <variant>
+#include <vector>
 
 
 namespace m {
@@ -572,6 +576,26 @@ struct Environment
     }
     ///> Returns the **copied** entry for identifier \p id.
     SQL_t operator[](Schema::Identifier id) const { return get(id); }
+    ///> Returns a new `Environment` with the **copied** values of the SIMD lane \tparam Lane of all entries.  Scalar
+    ///> entries are copied entirely.  The predication predicate is *not* copied.
+    template<std::size_t Lane>
+    Environment get_lane() const {
+        Environment res;
+        for (auto &p : exprs_) {
+            std::visit(overloaded {
+                [](std::monostate) -> void { M_unreachable("invalid expression"); },
+                [&res, &p]<sql_type T>(const T &e) -> void {
+                    if constexpr (T::num_simd_lanes == 1)
+                        res.add(p.first, e.clone());
+                    else if constexpr (Lane < T::num_simd_lanes)
+                        res.add(p.first, e.clone().template extract<Lane>());
+                    else
+                        M_unreachable("SIMD lane out of range");
+                },
+            }, p.second);
+        }
+        return res;
+    }
 
 
     /*----- Expression and CNF compilation ---------------------------------------------------------------------------*/
@@ -686,11 +710,30 @@ struct Scope
  * - an `ExprCompiler` to compile expressions within the current `Environment`
  * - the number of tuples written to the result set
  * / the number of SIMD lanes currently used
+ * - the sideways filters installed on scans
  */
 struct CodeGenContext
 {
     friend struct Scope;
 
+    /** A counter of the occurrences of an event, e.g. produced tuples or hash table collisions, in the code of a
+     * physical operator. */
+    struct operator_counter_t
+    {
+        const MatchBase *match; ///< the match of the physical operator
+        const char *event; ///< the name of the counted event
+        std::unique_ptr<Global<U64x1>> value; ///< the variable holding the number of occurrences
+    };
+
+    /** A filter installed on a scan by a physical operator further up the plan, e.g. a Bloom filter on join keys, to
+     * discard tuples that cannot qualify for this operator right after they are scanned. */
+    struct sideways_filter_t
+    {
+        const ScanOperator *scan; ///< the scan whose tuples are filtered
+        ///> emits code evaluating to `true` iff the current tuple of `scan` may qualify
+        std::function<Boolx1(void)> filter;
+    };
+
     private:
     Environment *env_ = nullptr; ///< environment for locally bound identifiers
     Global<U32x1> num_tuples_; ///< variable to hold the number of result tuples produced
@@ -699,6 +742,14 @@ struct CodeGenContext
     std::size_t num_simd_lanes_ = 1;
     ///> number of SIMD lanes currently preferred, i.e. 1 for scalar and at least 2 for vectorial values
     std::size_t num_simd_lanes_preferred_ = 1;
+    ///> whether to emit code to count events of physical operators
+    bool instrumented_ = false;
+    ///> the match of the physical operator currently emitting code, if any
+    const MatchBase *current_match_ = nullptr;
+    ///> the counters of events of physical operators, in the order of their creation
+    std::vector<operator_counter_t> operator_counters_;
+    ///> the sideways filters currently installed, in the order of their installation
+    std::vector<sideways_filter_t> sideways_filters_;
 
     public:
     CodeGenContext() = default;
@@ -775,6 +826,60 @@ struct CodeGenContext
     void update_num_simd_lanes_preferred(std::size_t n) {
         num_simd_lanes_preferred_ = std::max(num_simd_lanes_preferred_, n);
     }
+
+    /** Returns `true` iff code to count events of physical operators is emitted.  Instrumentation counts but never
+     * times operators: the operators of a pipeline are fused into a single function and interleave per tuple, hence
+     * an operator has no code region of its own, and Wasm can only read a clock through a host call, which costs
+     * more than the per-tuple work it would measure.  Sample the time per pipeline function with `perf` instead. */
+    bool instrumented() const { return instrumented_; }
+    /** Sets whether code to count events of physical operators is emitted. */
+    void instrumented(bool b) { instrumented_ = b; }
+
+    /** Returns the match of the physical operator currently emitting code, if any. */
+    const MatchBase * current_match() const { return current_match_; }
+    /** Sets the match of the physical operator currently emitting code to \p M and returns the previous one. */
+    const MatchBase * current_match(const MatchBase *M) { return std::exchange(current_match_, M); }
+
+    /** Emits code to add \p n to the counter of \p event of the physical operator with match \p M.  Emits no code
+     * unless instrumentation is enabled. */
+    void count_event(const MatchBase &M, const char *event, U64x1 n = U64x1(1)) {
+        if (not instrumented_) {
+            n.discard();
+            return;
+        }
+        auto it = std::find_if(operator_counters_.begin(), operator_counters_.end(), [&](const auto &counter) {
+            return counter.match == &M and std::string_view(counter.event) == event;
+        });
+        if (it == operator_counters_.end()) {
+            operator_counters_.push_back({ &M, event, std::make_unique<Global<U64x1>>() }); // initialized to 0
+            it = std::prev(operator_counters_.end());
+        }
+        *it->value += n;
+    }
+    /** Emits code to add \p n to the counter of \p event of the physical operator currently emitting code.  Emits
+     * no code unless instrumentation is enabled. */
+    void count_event(const char *event, U64x1 n = U64x1(1)) {
+        if (current_match_)
+            count_event(*current_match_, event, n);
+        else
+            n.discard();
+    }
+
+    /** Returns all counters of events of physical operators. */
+    const std::vector<operator_counter_t> & operator_counters() const { return operator_counters_; }
+
+    /** Installs \p filter as sideways filter on the scan \p scan.  Must be called before the code of \p scan is
+     * emitted.  Filters must be removed in reverse order of their installation. */
+    void push_sideways_filter(const ScanOperator &scan, std::function<Boolx1(void)> filter) {
+        sideways_filters_.push_back({ &scan, std::move(filter) });
+    }
+    /** Removes the sideways filter installed last. */
+    void pop_sideways_filter() {
+        M_insist(not sideways_filters_.empty(), "no sideways filter installed");
+        sideways_filters_.pop_back();
+    }
+    /** Returns all sideways filters currently installed. */
+    const std::vector<sideways_filter_t> & sideways_filters() const { return sideways_filters_; }
 };
 
 inline Scope::Scope(Environment inner)
@@ -852,6 +957,11 @@ compile_load_sequential(const Schema &tuple_schema, Ptr<void> base_address, cons
 void compile_store_point_access(const Schema &tuple_schema, Ptr<void> base_address, const storage::DataLayout &layout,
                                 const Schema &layout_schema, U32x1 tuple_id);
 
+/** Returns the address of the entries of \p dictionary in linear memory, where they are mapped after the store of the
+ * dictionary's table.  The string of code `c` is located at this address plus `c` times `Dictionary::entry_size()`.
+ * Loads from leaves encoded by \p dictionary compute the addresses of their strings this way. */
+Ptr<Charx1> dictionary_entries(const Dictionary &dictionary);
+
 /** Compiles the data layout \p layout starting at memory address \p base_address and containing tuples of schema
  * \p layout_schema such that it loads the single tuple with schema \p tuple_schema and ID \p tuple_id.
  *
@@ -1177,6 +1287,18 @@ T signum(T value)
     return (value.clone() > type(0)).template to<type>() - (value < type(0)).template to<type>();
 }
 
+/** Returns the number of tuples of the current, possibly SIMDfied, batch which fulfill the predication predicate
+ * \p pred, i.e. the number of its lanes which are `TRUE` and not `NULL`.  Works for any number of SIMD lanes the
+ * predicate may have. */
+U32x1 num_qualifying_tuples(SQL_boolean_t &&pred);
+
+/** Emits \p pipeline once for each SIMD lane of the current predicated `Environment`, each time within a scalar
+ * `Environment` holding the values and the predicate of this lane and with the number of SIMD lanes set to 1.  The
+ * number of lanes is the one of the predication predicate, which must match the one of the current pipeline.  Skips
+ * all lanes at runtime if none fulfills the predicate.  Allows consumers that support predication only for scalar
+ * tuples, e.g. stores into a `Buffer`, to consume SIMD vectors. */
+void execute_per_lane(const pipeline_t &pipeline);
+
 /** Compares two tuples, which must be already loaded into the environments \p env_left and \p env_right, according to
  * the ordering \p order (the second element of each pair is `true` iff the corresponding sorting should be
  * ascending).  Note that the value NULL is always considered smaller regardless of the ordering.
@@ -1,7 +1,12 @@
 #include "backend/WebAssembly.hpp"
 
 #include <binaryen-c.h>
+#include <chrono>
 #include <iostream>
+#include <limits>
+#include <mutable/storage/Dictionary.hpp>
+#include <mutable/util/exception.hpp>
+#include <string>
 #include <sys/mman.h>
 #include <utility>
 
@@ -55,7 +60,7 @@ M_LCOV_EXCL_STOP
 WasmEngine::WasmContext::WasmContext(uint32_t id, config_t config, const Operator &plan, std::size_t size)
     : config_(config)
     , id(id)
-    , plan(plan)
+    , plan(&plan)
     , vm(size)
 {
     install_guard_page(); // map nullptr page
@@ -63,29 +68,170 @@ WasmEngine::WasmContext::WasmContext(uint32_t id, config_t config, const Operato
     M_insist(size <= WASM_MAX_MEMORY);
 }
 
-uint32_t WasmEngine::WasmContext::map_table(const Table &table)
+void WasmEngine::WasmContext::reuse(unsigned id, const Operator &plan)
 {
-    M_insist(Is_Page_Aligned(heap));
+    this->id = id;
+    this->plan = &plan;
+    result_set_factory.reset();
+    qualifying_zones_.clear();
+    qualifying_codes_.clear();
+    num_table_mappings_ = 0;
+    saved_setup_time_ = duration::zero();
+    heap = get_pagesize(); // skip nullptr page, which is retained
+}
 
+void WasmEngine::WasmContext::release()
+{
+    /* Mappings of the previous plan beyond the mappings of the current plan may since have been overwritten. */
+    table_mappings_.resize(num_table_mappings_);
+
+    /* Discard the contents of the heap, s.t. the next plan again starts with zeroed memory. */
+    if (heap_memory_offset_) {
+#if __linux
+        M_DISCARD madvise(vm.as<uint8_t*>() + heap_memory_offset_, vm.size() - heap_memory_offset_, MADV_REMOVE);
+#else
+        heap_memory_ = memory::Memory();
+        heap_memory_offset_ = 0;
+#endif
+    }
+}
+
+namespace {
+
+/** Returns the number of bytes, aligned to whole pages, of the store of \p table that is mapped into linear memory. */
+std::size_t store_mapping_size(const Table &table)
+{
     const auto num_rows_per_instance = table.layout().child().num_tuples();
     const auto instance_stride_in_bytes = table.layout().stride_in_bits() / 8U;
     const std::size_t num_instances = (table.store().num_rows() + num_rows_per_instance - 1) / num_rows_per_instance;
     const std::size_t bytes = instance_stride_in_bytes * num_instances;
+    return Ceil_To_Next_Page(bytes);
+}
+
+}
+
+std::size_t WasmEngine::WasmContext::Table_Mapping_Size(const Table &table)
+{
+    std::size_t aligned_bytes = store_mapping_size(table);
+    for (auto &attr : table) {
+        if (attr.dictionary)
+            aligned_bytes += Ceil_To_Next_Page(attr.dictionary->size_in_bytes());
+    }
+    return aligned_bytes;
+}
+
+std::size_t WasmEngine::WasmContext::Dictionary_Mapping_Offset(const Attribute &attr)
+{
+    M_insist(bool(attr.dictionary), "attribute must be dictionary encoded");
+    std::size_t offset = store_mapping_size(attr.table);
+    for (auto &other : attr.table) {
+        if (&other == &attr)
+            return offset;
+        if (other.dictionary)
+            offset += Ceil_To_Next_Page(other.dictionary->size_in_bytes());
+    }
+    M_unreachable("attribute not found in its table");
+}
+
+uint32_t WasmEngine::WasmContext::map_table(const Table &table)
+{
+    M_insist(Is_Page_Aligned(heap));
 
     /* Map entry into WebAssembly linear memory. */
     const auto off = heap;
-    const auto aligned_bytes = Ceil_To_Next_Page(bytes);
+    const auto aligned_bytes = Table_Mapping_Size(table);
     const auto &mem = table.store().memory();
+
+    /* Retain the mapping of a previous plan if the table's store has neither grown nor moved since. */
+    if (num_table_mappings_ < table_mappings_.size()) {
+        auto &mapping = table_mappings_[num_table_mappings_];
+        if (mapping.table == &table and mapping.store_addr == mem.addr() and mapping.size == aligned_bytes and
+            mapping.offset == off)
+        {
+            ++num_table_mappings_;
+            saved_setup_time_ += mapping.setup_time;
+            if (aligned_bytes)
+                heap += aligned_bytes + get_pagesize(); // skip mapping and its guard page
+            M_insist(Is_Page_Aligned(heap));
+            return off;
+        }
+        table_mappings_.resize(num_table_mappings_); // all following mappings are invalidated as well
+    }
+
+    const auto begin = std::chrono::high_resolution_clock::now();
     if (aligned_bytes) {
-        mem.map(aligned_bytes, 0, vm, off);
+        /* Check that the table and its guard page fit into the virtual address space.  Otherwise, `heap` would
+         * silently overflow. */
+        if (std::size_t(heap) + aligned_bytes + get_pagesize() > vm.size()) {
+            throw backend_exception(
+                "table " + std::string(table.name) + " of " + std::to_string(aligned_bytes) +
+                " bytes does not fit into the remaining " + std::to_string(vm.size() - heap) +
+                " bytes of WebAssembly linear memory, which is limited to 4 GiB per query"
+            );
+        }
+        /* Map the store, followed by the entries of the dictionaries of all dictionary encoded attributes. */
+        if (const auto store_bytes = store_mapping_size(table))
+            mem.map(store_bytes, 0, vm, off);
+        for (auto &attr : table) {
+            if (not attr.dictionary)
+                continue;
+            if (const auto dictionary_bytes = Ceil_To_Next_Page(attr.dictionary->size_in_bytes()))
+                attr.dictionary->memory().map(dictionary_bytes, 0, vm, off + Dictionary_Mapping_Offset(attr));
+        }
         heap += aligned_bytes;
         install_guard_page();
     }
     M_insist(Is_Page_Aligned(heap));
+    table_mappings_.push_back({ &table, mem.addr(), aligned_bytes, off,
+                                std::chrono::high_resolution_clock::now() - begin });
+    ++num_table_mappings_;
 
     return off;
 }
 
+void WasmEngine::WasmContext::map_heap()
+{
+    M_insist(Is_Page_Aligned(heap));
+
+    if (heap_memory_offset_ == heap) { // still mapped by a previous plan
+        saved_setup_time_ += heap_setup_time_;
+        return;
+    }
+
+    const auto begin = std::chrono::high_resolution_clock::now();
+    const auto bytes_remaining = vm.size() - heap;
+    if (not heap_memory_.size())
+        heap_memory_ = heap_allocator_.allocate(vm.size()); // large enough for any `heap`
+    heap_memory_.map(bytes_remaining, 0, vm, heap);
+    heap_memory_offset_ = heap;
+    heap_setup_time_ = std::chrono::high_resolution_clock::now() - begin;
+}
+
+uint32_t WasmEngine::WasmContext::next_qualifying_row(uint32_t scan_id, uint32_t row_id) const
+{
+    auto it = qualifying_zones_.find(scan_id);
+    if (it == qualifying_zones_.end())
+        return row_id; // no zones installed, hence all rows qualify
+    auto &[zone_size, qualifies] = it->second;
+    for (std::size_t zone = row_id / zone_size; zone < qualifies.size(); ++zone) {
+        if (qualifies[zone])
+            return std::max<std::size_t>(row_id, zone * zone_size);
+    }
+    return std::numeric_limits<uint32_t>::max();
+}
+
+uint32_t WasmEngine::WasmContext::end_of_qualifying_rows(uint32_t scan_id, uint32_t row_id) const
+{
+    auto it = qualifying_zones_.find(scan_id);
+    if (it == qualifying_zones_.end())
+        return std::numeric_limits<uint32_t>::max(); // no zones installed, hence all rows qualify
+    auto &[zone_size, qualifies] = it->second;
+    std::size_t zone = row_id / zone_size;
+    while (zone < qualifies.size() and qualifies[zone])
+        ++zone;
+    return zone < qualifies.size() ? zone * zone_size : std::numeric_limits<uint32_t>::max();
+}
+
 void WasmEngine::WasmContext::install_guard_page()
 {
     M_insist(Is_Page_Aligned(heap));
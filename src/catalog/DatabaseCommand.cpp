@@ -1,6 +1,7 @@
 #include <mutable/catalog/DatabaseCommand.hpp>
 
 #include "backend/StackMachine.hpp"
+#include "storage/Compression.hpp"
 #include <mutable/catalog/Catalog.hpp>
 #include <mutable/IR/Optimizer.hpp>
 #include <mutable/mutable.hpp>
@@ -31,6 +32,34 @@ void learn_spns::execute(Diagnostic &diag)
     if (not Options::Get().quiet) { diag.out() << "Learned SPN on every table in " << DB.name << ".\n"; }
 }
 
+void compress::execute(Diagnostic &diag)
+{
+    auto &C = Catalog::Get();
+    if (not C.has_database_in_use()) { diag.err() << "No database selected.\n"; return; }
+    auto &DB = C.get_database_in_use();
+
+    std::vector<Table*> tables;
+    if (args().empty()) {
+        for (auto it = DB.begin_tables(); it != DB.end_tables(); ++it)
+            tables.push_back(it->second);
+    } else {
+        for (auto &name : args()) {
+            try {
+                tables.push_back(&DB.get_table(C.pool(name.c_str())));
+            } catch (std::out_of_range) {
+                diag.err() << "Table " << name << " does not exist in database " << DB.name << ".\n";
+                return;
+            }
+        }
+    }
+
+    std::size_t num_compressed = 0;
+    for (auto table : tables)
+        num_compressed += storage::compress(*table);
+
+    if (not Options::Get().quiet) { diag.out() << "Compressed " << num_compressed << " attributes.\n"; }
+}
+
 __attribute__((constructor(201)))
 static void register_instructions()
 {
@@ -38,6 +67,7 @@ static void register_instructions()
 #define REGISTER(NAME, DESCRIPTION) \
     C.register_instruction<NAME>(#NAME, DESCRIPTION)
     REGISTER(learn_spns, "create an SPN for every table in the database");
+    REGISTER(compress, "compress the integral attributes of the given tables or of every table in the database");
 #undef REGISTER
 }
 
@@ -107,8 +137,7 @@ void InsertRecords::execute(Diagnostic&)
 
     auto &I = ast<ast::InsertStmt>();
     auto &T = DB.get_table(I.table_name.text);
-    auto &store = T.store();
-    StoreWriter W(store);
+    StoreWriter W(T);
     auto &S = W.schema();
     Tuple tup(S);
 
@@ -217,6 +246,19 @@ void CreateTable::execute(Diagnostic &diag)
         diag.out() << "Created table " << table->name << ".\n";
 }
 
+void CreateIndex::execute(Diagnostic &diag)
+{
+    auto &DB = Catalog::Get().get_database_in_use();
+    try {
+        auto &index = DB.add_index(index_name_, attr_);
+        if (not Options::Get().quiet)
+            diag.out() << "Created index " << index.name << " on " << attr_.table.name << '(' << attr_.name
+                       << ") with " << index.size() << " entries.\n";
+    } catch (std::invalid_argument) {
+        diag.err() << "Index " << index_name_ << " already exists in database " << DB.name << ".\n";
+    }
+}
+
 
 #define ACCEPT(CLASS) \
     void CLASS::accept(DatabaseCommandVisitor &v) { v(*this); } \
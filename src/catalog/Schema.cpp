@@ -55,13 +55,26 @@ bool Attribute::is_unique() const {
                       std::find_if(primary_key.cbegin(), primary_key.cend(), pred) != primary_key.cend());
 }
 
+void Attribute::encode_by_dictionary()
+{
+    auto cs = cast<const CharacterSequence>(type);
+    if (not cs)
+        throw invalid_argument("only attributes of character sequence type can be dictionary encoded");
+    if (not dictionary)
+        dictionary = std::make_unique<Dictionary>(*cs);
+}
+
 M_LCOV_EXCL_START
 void Attribute::dump(std::ostream &out) const
 {
     out << "Attribute `" << table.name << "`.`" << name << "`, "
         << "id " << id << ", "
-        << "type " << *type
-        << std::endl;
+        << "type " << *type;
+    if (dictionary)
+        out << ", encoded by dictionary " << dictionary->id;
+    if (frame_of_reference)
+        out << ", compressed to " << *frame_of_reference->type << " relative to " << frame_of_reference->reference;
+    out << std::endl;
 }
 
 void Attribute::dump() const { dump(std::cerr); }
@@ -89,8 +102,22 @@ Schema Table::schema(const char *alias) const
 }
 
 void Table::layout(const storage::DataLayoutFactory &factory) {
-    view v(cbegin(), cend(), [](auto it) -> auto & { return it->type; });
-    layout_ = factory.make(v.begin(), v.end());
+    std::vector<const Type*> types;
+    for (auto &attr : attrs_) {
+        if (attr.dictionary)
+            types.push_back(Dictionary::Code_Type());
+        else if (attr.frame_of_reference)
+            types.push_back(attr.frame_of_reference->type);
+        else
+            types.push_back(attr.type);
+    }
+    layout_ = factory.make(std::move(types));
+    for (auto &attr : attrs_) {
+        if (attr.dictionary)
+            layout_.encode(attr.id, *attr.dictionary);
+        if (attr.frame_of_reference)
+            layout_.compress(attr.id, attr.frame_of_reference->reference);
+    }
 }
 
 M_LCOV_EXCL_START
@@ -134,12 +161,45 @@ Database::Database(const char *name)
 
 Database::~Database()
 {
+    for (auto &i : indexes_)
+        delete i.second;
     for (auto &r : tables_)
         delete r.second;
     for (auto &f : functions_)
         delete f.second;
 }
 
+Index & Database::get_index(uint32_t id) const
+{
+    for (auto &i : indexes_) {
+        if (i.second->id == id)
+            return *i.second;
+    }
+    throw std::out_of_range("index with that ID does not exist");
+}
+
+Index & Database::add_index(const char *name, const Attribute &attr)
+{
+    auto it = indexes_.find(name);
+    if (it != indexes_.end()) throw std::invalid_argument("index with that name already exists");
+    it = indexes_.emplace_hint(it, name, new Index(name, attr));
+    it->second->update();
+    return *it->second;
+}
+
+std::vector<Index*> Database::indexes_of(const Table &table) const
+{
+    std::vector<Index*> indexes;
+    for (auto &i : indexes_) {
+        if (&i.second->table() == &table)
+            indexes.push_back(i.second);
+    }
+    std::sort(indexes.begin(), indexes.end(), [](const Index *left, const Index *right) {
+        return left->id < right->id;
+    });
+    return indexes;
+}
+
 const Function * Database::get_function(const char *name) const
 {
     try {
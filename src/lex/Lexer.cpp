@@ -84,6 +84,7 @@ after:
             LEX('=', ">=", TK_GREATER_EQUAL, ) );
         LEX(',', ",", TK_COMMA, );
         LEX(';', ";", TK_SEMICOL, );
+        LEX('?', "?", TK_QMARK, );
         LEX('.', ".", TK_DOT,
             LEX('.', "..", TK_DOTDOT, )
             case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
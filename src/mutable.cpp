@@ -8,13 +8,17 @@
 #include "parse/Parser.hpp"
 #include "parse/Sema.hpp"
 #include "parse/Sema.hpp"
+#include "storage/Compression.hpp"
 #include <cerrno>
+#include <condition_variable>
+#include <exception>
 #include <fstream>
 #include <mutable/catalog/DatabaseCommand.hpp>
 #include <mutable/io/Reader.hpp>
 #include <mutable/IR/Tuple.hpp>
 #include <mutable/Options.hpp>
 #include <mutable/util/Diagnostic.hpp>
+#include <mutex>
 
 
 using namespace m;
@@ -208,8 +212,7 @@ void m::execute_statement(Diagnostic &diag, const ast::Stmt &stmt, const bool is
     } else if (auto I = cast<const ast::InsertStmt>(&stmt)) {
         auto &DB = C.get_database_in_use();
         auto &T = DB.get_table(I->table_name.text);
-        auto &store = T.store();
-        StoreWriter W(store);
+        StoreWriter W(T);
         auto &S = W.schema();
         Tuple tup(S);
 
@@ -262,6 +265,9 @@ void m::execute_statement(Diagnostic &diag, const ast::Stmt &stmt, const bool is
                     [&](const NotNullConstraint&) {
                         T.at(attr->name.text).not_nullable = true;
                     },
+                    [&](const DictionaryConstraint&) {
+                        T.at(attr->name.text).encode_by_dictionary();
+                    },
                     [&](const ReferenceConstraint &ref) {
                         auto &ref_table = DB.get_table(ref.table_name.text);
                         auto &ref_attr = ref_table.at(ref.attr_name.text);
@@ -274,6 +280,10 @@ void m::execute_statement(Diagnostic &diag, const ast::Stmt &stmt, const bool is
 
         T.layout(C.data_layout());
         T.store(C.create_store(T));
+    } else if (auto S = cast<const ast::CreateIndexStmt>(&stmt)) {
+        auto &DB = C.get_database_in_use();
+        auto &T = DB.get_table(S->table_name.text);
+        DB.add_index(S->index_name.text, T.at(S->attr_name.text));
     } else if (auto S = cast<const ast::DSVImportStmt>(&stmt)) {
         auto &DB = C.get_database_in_use();
         auto &T = DB.get_table(S->table_name.text);
@@ -333,20 +343,250 @@ void m::execute_instruction(Diagnostic &diag, const Instruction &instruction)
     }
 }
 
-void m::execute_query(Diagnostic&, const SelectStmt &stmt, std::unique_ptr<Consumer> consumer)
+namespace {
+
+/** The query graph and the optimizer of a planned query.  Both own expressions referenced by the plan and must hence
+ * outlive its execution. */
+struct planned_query_t
+{
+    std::unique_ptr<QueryGraph> query_graph;
+    std::unique_ptr<Optimizer> optimizer;
+};
+
+/** Optimizes \p stmt and adds the resulting plan as child to \p consumer. */
+planned_query_t plan_query(const SelectStmt &stmt, Consumer &consumer)
 {
     Catalog &C = Catalog::Get();
     auto query_graph = M_TIME_EXPR(QueryGraph::Build(stmt), "Construct the query graph", C.timer());
 
-    Optimizer Opt(C.plan_enumerator(), C.cost_function());
-    auto optree = M_TIME_EXPR(Opt(*query_graph), "Compute the query plan", C.timer());
+    auto Opt = std::make_unique<Optimizer>(C.plan_enumerator(), C.cost_function());
+    auto optree = M_TIME_EXPR((*Opt)(*query_graph), "Compute the query plan", C.timer());
 
-    consumer->add_child(optree.release());
+    consumer.add_child(optree.release());
+    return { std::move(query_graph), std::move(Opt) };
+}
 
+/** Executes the plan of \p consumer with the backend of the current thread. */
+void execute_plan(const Consumer &consumer)
+{
+    Catalog &C = Catalog::Get();
     static thread_local std::unique_ptr<Backend> backend;
     if (not backend)
         backend = M_TIME_EXPR(C.create_backend(), "Create backend", C.timer());
-    M_TIME_EXPR(backend->execute(*consumer), "Execute the query", C.timer());
+    M_TIME_EXPR(backend->execute(consumer), "Execute the query", C.timer());
+}
+
+/** Returns \p params as parameters to bind to the placeholders of \p stmt.  Throws `invalid_argument` if their number
+ * does not match. */
+Interpreter::parameters_t parameters_of(Diagnostic &diag, const PreparedStatement &stmt,
+                                        const std::vector<Value> &params)
+{
+    if (params.size() != stmt.num_parameters()) {
+        diag.err() << "Expected " << stmt.num_parameters() << " parameters, got " << params.size() << ".\n";
+        throw invalid_argument("number of parameters does not match number of placeholders");
+    }
+
+    Interpreter::parameters_t parameters;
+    parameters.reserve(params.size());
+    for (std::size_t idx = 0; idx != params.size(); ++idx)
+        parameters.emplace_back(stmt.parameter_type(idx), params[idx]);
+    return parameters;
+}
+
+}
+
+void m::execute_query(Diagnostic&, const SelectStmt &stmt, std::unique_ptr<Consumer> consumer)
+{
+    auto planned = plan_query(stmt, *consumer);
+    execute_plan(*consumer);
+}
+
+std::unique_ptr<PreparedStatement> m::prepare_query(Diagnostic &diag, const std::string &str)
+{
+    Catalog &C = Catalog::Get();
+
+    std::istringstream in(str);
+    Lexer lexer(diag, C.get_pool(), "-", in);
+    Parser parser(lexer);
+    auto stmt = M_TIME_EXPR(std::unique_ptr<Stmt>(parser.parse_Stmt()), "Parse the statement", C.timer());
+    if (diag.num_errors() != 0)
+        throw frontend_exception("syntactic error in statement");
+    M_insist(diag.num_errors() == 0);
+
+    if (not is<SelectStmt>(stmt.get())) {
+        diag.err() << "Only SELECT statements can be prepared.\n";
+        throw frontend_exception("statement cannot be prepared");
+    }
+
+    Sema sema(diag);
+    M_TIME_EXPR(sema(*stmt), "Semantic analysis", C.timer());
+    if (diag.num_errors() != 0)
+        throw frontend_exception("semantic error in statement");
+    M_insist(diag.num_errors() == 0);
+
+    std::vector<const PrimitiveType*> parameter_types;
+    for (auto ty : sema.placeholder_types())
+        parameter_types.push_back(as<const PrimitiveType>(M_notnull(ty)));
+
+    return std::make_unique<PreparedStatement>(std::unique_ptr<SelectStmt>(as<SelectStmt>(stmt.release())),
+                                               std::move(parameter_types));
+}
+
+void m::execute_query(Diagnostic &diag, const PreparedStatement &stmt, const std::vector<Value> &params,
+                      std::unique_ptr<Consumer> consumer)
+{
+    Interpreter::Bind_Parameters(parameters_of(diag, stmt, params));
+    try {
+        execute_query(diag, stmt.stmt(), std::move(consumer));
+    } catch (...) {
+        Interpreter::Bind_Parameters({});
+        throw;
+    }
+    Interpreter::Bind_Parameters({});
+}
+
+/*----- QueryHandle --------------------------------------------------------------------------------------------------*/
+
+struct m::QueryHandle::channel_t
+{
+    std::mutex mutex;
+    std::condition_variable cv; ///< signals a change of `is_started`, `batch`, `is_done`, or `is_cancelled`
+    bool is_started = false; ///< whether the client has requested the first batch
+    const ResultBatch *batch = nullptr; ///< the batch passed to the client, if any; reset by the client to resume
+    bool is_done = false; ///< whether the executing thread has finished
+    bool is_cancelled = false; ///< whether the client has cancelled the query
+    std::exception_ptr exception; ///< the exception thrown during execution, if any
+
+    /** Suspends the calling, executing thread until the client requests the first batch.  Returns `false` iff the
+     * query was cancelled before. */
+    bool wait_for_start() {
+        std::unique_lock lock(mutex);
+        cv.wait(lock, [this]() { return is_started or is_cancelled; });
+        return not is_cancelled;
+    }
+
+    /** Passes \p b to the client and suspends the calling, executing thread until the client has released \p b.
+     * Throws `runtime_error` to abort the execution if the query is cancelled. */
+    void pass(const ResultBatch &b) {
+        std::unique_lock lock(mutex);
+        if (is_cancelled)
+            throw runtime_error("query cancelled");
+        batch = &b;
+        cv.notify_all();
+        cv.wait(lock, [this]() { return batch == nullptr or is_cancelled; });
+        if (is_cancelled)
+            throw runtime_error("query cancelled");
+    }
+
+    /** Marks the execution as finished, with the exception \p e if it failed. */
+    void finish(std::exception_ptr e) {
+        std::unique_lock lock(mutex);
+        if (not is_cancelled)
+            exception = std::move(e);
+        batch = nullptr;
+        is_done = true;
+        cv.notify_all();
+    }
+};
+
+m::QueryHandle::QueryHandle(Schema schema, std::shared_ptr<channel_t> channel, std::thread executor)
+    : schema_(std::move(schema))
+    , channel_(std::move(channel))
+    , executor_(std::move(executor))
+    , client_(std::this_thread::get_id())
+{ }
+
+m::QueryHandle::~QueryHandle()
+{
+    cancel();
+    executor_.join();
+}
+
+const ResultBatch * m::QueryHandle::next_batch()
+{
+    M_insist(std::this_thread::get_id() == client_, "must only be called by the thread that opened the query");
+    std::unique_lock lock(channel_->mutex);
+    if (not channel_->is_started or channel_->batch) {
+        channel_->is_started = true;
+        channel_->batch = nullptr; // release the previous batch and thereby resume the executing thread
+        channel_->cv.notify_all();
+    }
+    channel_->cv.wait(lock, [this]() { return channel_->batch or channel_->is_done or channel_->is_cancelled; });
+    if (channel_->exception)
+        std::rethrow_exception(std::exchange(channel_->exception, nullptr));
+    return channel_->is_cancelled ? nullptr : channel_->batch;
+}
+
+void m::QueryHandle::cancel()
+{
+    M_insist(std::this_thread::get_id() == client_, "must only be called by the thread that opened the query");
+    std::unique_lock lock(channel_->mutex);
+    if (channel_->is_done)
+        return;
+    channel_->is_cancelled = true;
+    channel_->cv.notify_all();
+    channel_->cv.wait(lock, [this]() { return channel_->is_done; }); // wait for the executing thread to abort
+}
+
+namespace {
+
+/** Plans \p stmt on the calling thread and executes the plan on a new thread with \p parameters bound, passing the
+ * results in batches of \p batch_size tuples through the returned `QueryHandle`.  The new thread starts executing
+ * only when the client requests the first batch, and it disposes of the plan and the backend before it finishes.
+ * Hence, it only runs while the client waits for it. */
+std::unique_ptr<QueryHandle> start_query(const SelectStmt &stmt, Interpreter::parameters_t parameters,
+                                         std::size_t batch_size)
+{
+    if (batch_size == 0)
+        throw invalid_argument("batch size must not be 0");
+
+    auto channel = std::make_shared<QueryHandle::channel_t>();
+    auto consumer = std::make_unique<CallbackOperator>(
+        [channel](const Schema&, const ResultBatch &batch) { channel->pass(batch); },
+        batch_size
+    );
+    auto planned = plan_query(stmt, *consumer);
+    Schema schema = consumer->schema().drop_constants().deduplicate();
+
+    std::thread executor([channel, consumer=std::move(consumer), planned=std::move(planned),
+                          parameters=std::move(parameters)]() mutable {
+        std::exception_ptr exception;
+        if (channel->wait_for_start()) {
+            /* Measurements span the suspensions of this thread and would collide with those of the client and of
+             * other queries, hence record them separately. */
+            Timer timer;
+            Catalog::Thread_Timer(&timer);
+            Interpreter::Bind_Parameters(std::move(parameters));
+            try {
+                /* Unlike `execute_plan()`, do not keep the backend in a thread-local, since it would be destroyed
+                 * when this thread exits, i.e. after the client was resumed. */
+                auto backend = Catalog::Get().create_backend();
+                backend->execute(*consumer);
+            } catch (...) {
+                exception = std::current_exception();
+            }
+            Interpreter::Bind_Parameters({});
+            Catalog::Thread_Timer(nullptr);
+        }
+        consumer.reset(); // dispose of the plan before the expressions it references
+        planned = planned_query_t();
+        channel->finish(std::move(exception));
+    });
+
+    return std::make_unique<QueryHandle>(std::move(schema), std::move(channel), std::move(executor));
+}
+
+}
+
+std::unique_ptr<QueryHandle> m::open_query(Diagnostic&, const SelectStmt &stmt, std::size_t batch_size)
+{
+    return start_query(stmt, {}, batch_size);
+}
+
+std::unique_ptr<QueryHandle> m::open_query(Diagnostic &diag, const PreparedStatement &stmt,
+                                           const std::vector<Value> &params, std::size_t batch_size)
+{
+    return start_query(stmt.stmt(), parameters_of(diag, stmt, params), batch_size);
 }
 
 void m::load_from_CSV(Diagnostic &diag, Table &table, const std::filesystem::path &path, std::size_t num_rows,
@@ -408,10 +648,11 @@ void m::execute_file(Diagnostic &diag, const std::filesystem::path &path)
     }
 }
 
-m::StoreWriter::StoreWriter(Store &store)
-    : store_(store)
+m::StoreWriter::StoreWriter(Table &table)
+    : table_(table)
+    , store_(table.store())
 {
-    for (auto &attr : store.table())
+    for (auto &attr : table)
         S.add({attr.table.name, attr.name}, attr.type);
 }
 
@@ -419,6 +660,11 @@ m::StoreWriter::~StoreWriter() { }
 
 void m::StoreWriter::append(const Tuple &tup) const
 {
+    /* If a value of `tup` does not fit into the frame of reference of its compressed attribute, widen the frame.  This
+     * changes the data layout, hence the writer must be recompiled. */
+    if (storage::widen_frames_of_reference(table_, tup))
+        layout_ = nullptr;
+
     store_.append();
     if (layout_ != &store_.table().layout()) {
         layout_ = &store_.table().layout();
@@ -164,6 +164,12 @@ Schema Expr::get_required() const
                     schema.add(id, fn.type());
                 throw visit_stop_recursion{}; // TODO: throw visit_skip_subtree after Luca's MR
             }
+        },
+        [&schema](const QueryExpr &q) {
+            /* The single value of a nested query is provided as attribute `$res` of the query's alias. */
+            Schema::Identifier id(q.alias(), Catalog::Get().pool("$res"));
+            if (q.type()->is_primitive() and not schema.has(id)) // avoid duplicates
+                schema.add(id, q.type());
         }
     };
     visit(visitor, *this, m::tag<ConstPreOrderExprVisitor>());
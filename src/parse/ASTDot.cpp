@@ -296,6 +296,11 @@ void ASTDot::operator()(Const<NotNullConstraint> &c)
     indent() << id(c) << " [label=<<B>NOT NULL</B>>];";
 }
 
+void ASTDot::operator()(Const<DictionaryConstraint> &c)
+{
+    indent() << id(c) << " [label=<<B>DICTIONARY</B>>];";
+}
+
 void ASTDot::operator()(Const<CheckConditionConstraint> &c)
 {
     (*this)(*c.cond);
@@ -346,6 +351,11 @@ void ASTDot::operator()(Const<CreateTableStmt>&)
     // TODO implement
 }
 
+void ASTDot::operator()(Const<CreateIndexStmt>&)
+{
+    // TODO implement
+}
+
 void ASTDot::operator()(Const<SelectStmt> &s)
 {
     out << '\n';
@@ -220,6 +220,11 @@ void ASTDumper::operator()(Const<NotNullConstraint> &c)
     indent() << "NotNullConstraint (" << c.tok.pos << ')';
 }
 
+void ASTDumper::operator()(Const<DictionaryConstraint> &c)
+{
+    indent() << "DictionaryConstraint (" << c.tok.pos << ')';
+}
+
 void ASTDumper::operator()(Const<CheckConditionConstraint> &c)
 {
     indent() << "CheckConditionConstraint (" << c.tok.pos << ')';
@@ -286,6 +291,8 @@ void ASTDumper::operator()(Const<CreateTableStmt> &s)
                 indent() << "UNIQUE (" << c->tok.pos << ')';
             } else if (is<NotNullConstraint>(c)) {
                 indent() << "NOT NULL (" << c->tok.pos << ')';
+            } else if (is<DictionaryConstraint>(c)) {
+                indent() << "DICTIONARY (" << c->tok.pos << ')';
             } else if (auto check = cast<CheckConditionConstraint>(c.get())) {
                 indent() << "CHECK (" << c->tok.pos << ')';
                 ++indent_;
@@ -304,6 +311,15 @@ void ASTDumper::operator()(Const<CreateTableStmt> &s)
     --indent_;
 }
 
+void ASTDumper::operator()(Const<CreateIndexStmt> &s)
+{
+    indent() << "CreateIndexStmt: index " << s.index_name.text << " (" << s.index_name.pos << ')';
+    ++indent_;
+    indent() << "table " << s.table_name.text << " (" << s.table_name.pos << ')';
+    indent() << "attribute " << s.attr_name.text << " (" << s.attr_name.pos << ')';
+    --indent_;
+}
+
 void ASTDumper::operator()(Const<SelectStmt> &s)
 {
     indent() << "SelectStmt";
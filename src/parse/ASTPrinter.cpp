@@ -40,7 +40,7 @@ void ASTPrinter::operator()(Const<FnApplicationExpr> &e)
 void ASTPrinter::operator()(Const<UnaryExpr> &e)
 {
     out << '(' << e.op().text;
-    if (e.op() == TK_Not) out << ' ';
+    if (e.op() == TK_Not or e.op() == TK_Exists) out << ' ';
     (*this)(*e.expr);
     out << ')';
 }
@@ -158,6 +158,11 @@ void ASTPrinter::operator()(Const<NotNullConstraint>&)
     out << "NOT NULL";
 }
 
+void ASTPrinter::operator()(Const<DictionaryConstraint>&)
+{
+    out << "DICTIONARY";
+}
+
 void ASTPrinter::operator()(Const<CheckConditionConstraint> &c)
 {
     out << "CHECK (" << *c.cond << ')';
@@ -214,6 +219,11 @@ void ASTPrinter::operator()(Const<CreateTableStmt> &s)
     out << "\n);";
 }
 
+void ASTPrinter::operator()(Const<CreateIndexStmt> &s)
+{
+    out << "CREATE INDEX " << s.index_name.text << " ON " << s.table_name.text << " (" << s.attr_name.text << ");";
+}
+
 void ASTPrinter::operator()(Const<SelectStmt> &s)
 {
     bool was_nested = is_nested_;
@@ -39,7 +39,8 @@ int get_precedence(const TokenType tt)
         case TK_GREATER_EQUAL:
         case TK_EQUAL:
         case TK_BANG_EQUAL:
-        case TK_Like:               ++p;
+        case TK_Like:
+        case TK_In:                 ++p;
         /* logical NOT */
         case TK_Not:                ++p;
         /* logical AND */
@@ -131,6 +132,7 @@ std::unique_ptr<Instruction> Parser::parse_Instruction()
 std::unique_ptr<Stmt> Parser::parse_Stmt()
 {
     std::unique_ptr<Stmt> stmt = nullptr;
+    num_placeholders_ = 0;
     switch (token().type) {
         default:
             stmt = std::make_unique<ErrorStmt>(token());
@@ -145,13 +147,14 @@ std::unique_ptr<Stmt> Parser::parse_Stmt()
             switch (token().type) {
                 default:
                     stmt = std::make_unique<ErrorStmt>(token());
-                    diag.e(token().pos) << "expected a create database statement or a create table statement, got "
-                                        << token().text << '\n';
+                    diag.e(token().pos) << "expected a create database statement, a create table statement, or a "
+                                           "create index statement, got " << token().text << '\n';
                     recover(follow_set_CREATE_DATABASE_STATEMENT);
                     break;
 
                 case TK_Database: stmt = parse_CreateDatabaseStmt(); break;
                 case TK_Table:    stmt = parse_CreateTableStmt(); break;
+                case TK_Index:    stmt = parse_CreateIndexStmt(); break;
             }
             break;
         }
@@ -253,6 +256,13 @@ std::unique_ptr<Stmt> Parser::parse_CreateTableStmt()
                     break;
                 }
 
+                /* 'DICTIONARY' */
+                case TK_Dictionary: {
+                    Token tok = consume();
+                    constraints.push_back(std::make_unique<DictionaryConstraint>(tok));
+                    break;
+                }
+
                 /* 'CHECK' '(' expression ')' */
                 case TK_Check: {
                     Token tok = consume();
@@ -304,6 +314,31 @@ error_recovery:
     return std::make_unique<ErrorStmt>(start);
 }
 
+std::unique_ptr<Stmt> Parser::parse_CreateIndexStmt()
+{
+    Token start = token();
+
+    /* 'INDEX' identifier 'ON' identifier '(' identifier ')' */
+    if (not expect(TK_Index)) goto error_recovery;
+    {
+        Token index_name = token();
+        if (not expect(TK_IDENTIFIER)) goto error_recovery;
+        if (not expect(TK_On)) goto error_recovery;
+        Token table_name = token();
+        if (not expect(TK_IDENTIFIER)) goto error_recovery;
+        if (not expect(TK_LPAR)) goto error_recovery;
+        Token attr_name = token();
+        if (not expect(TK_IDENTIFIER)) goto error_recovery;
+        if (not expect(TK_RPAR)) goto error_recovery;
+
+        return std::make_unique<CreateIndexStmt>(index_name, table_name, attr_name);
+    }
+
+error_recovery:
+    recover(follow_set_CREATE_INDEX_STATEMENT);
+    return std::make_unique<ErrorStmt>(start);
+}
+
 std::unique_ptr<Stmt> Parser::parse_SelectStmt()
 {
     std::unique_ptr<Clause> select = parse_SelectClause();
@@ -734,7 +769,8 @@ error_recovery:
 std::unique_ptr<Expr> Parser::parse_Expr(const int precedence_lhs, std::unique_ptr<Expr> lhs)
 {
     /*
-     * primary-expression ::= designator | constant | '(' expression ')' | '(' select-statement ')' ;
+     * primary-expression ::= designator | constant | '?' | '(' expression ')' | '(' select-statement ')' |
+     *                        'EXISTS' '(' select-statement ')' ;
      * unary-expression ::= [ '+' | '-' | '~' ] postfix-expression ;
      * logical-not-expression ::= 'NOT' logical-not-expression | comparative-expression ;
      */
@@ -756,6 +792,14 @@ std::unique_ptr<Expr> Parser::parse_Expr(const int precedence_lhs, std::unique_p
         case TK_HEX_FLOAT:
             lhs = std::make_unique<Constant>(consume());
             break;
+        case TK_QMARK: {
+            /* Number the placeholders of a statement consecutively, starting at 1, and make the number part of the
+             * text.  Thereby, distinct placeholders are never considered equal. */
+            Token tok = consume();
+            tok.text = lexer.pool(("?" + std::to_string(++num_placeholders_)).c_str());
+            lhs = std::make_unique<Constant>(tok);
+            break;
+        }
         case TK_LPAR:
             consume();
             if (token().type == TK_Select)
@@ -766,6 +810,20 @@ std::unique_ptr<Expr> Parser::parse_Expr(const int precedence_lhs, std::unique_p
                 recover(follow_set_PRIMARY_EXPRESSION);
             }
             break;
+        case TK_Exists: {
+            auto tok = consume();
+            if (not expect(TK_LPAR)) {
+                recover(follow_set_PRIMARY_EXPRESSION);
+                lhs = std::make_unique<ErrorExpr>(tok);
+                break;
+            }
+            auto query = std::make_unique<QueryExpr>(token(), parse_SelectStmt());
+            if (not expect(TK_RPAR)) {
+                recover(follow_set_PRIMARY_EXPRESSION);
+            }
+            lhs = std::make_unique<UnaryExpr>(tok, std::move(query));
+            break;
+        }
 
         /* unary-expression */
         case TK_PLUS:
@@ -810,12 +868,25 @@ std::unique_ptr<Expr> Parser::parse_Expr(const int precedence_lhs, std::unique_p
         lhs = std::make_unique<FnApplicationExpr>(lpar, std::move(lhs), std::move(args));
     }
 
+    /* comparative-expression ::= expression comparison-operator expression | expression [ 'NOT' ] 'IN' expression ; */
     for (;;) {
         Token op = token();
-        int p = get_precedence(op);
+        /* Following an expression, `NOT` can only begin the operator `NOT IN`. */
+        int p = get_precedence(op == TK_Not ? TK_In : op.type);
         if (precedence_lhs > p) return lhs; // left operator has higher precedence_lhs
         consume();
 
+        if (op == TK_Not) {
+            Token in = token();
+            if (not expect(TK_In)) {
+                recover(follow_set_EXPRESSION);
+                return std::make_unique<ErrorExpr>(in);
+            }
+            auto rhs = parse_Expr(p + 1);
+            lhs = std::make_unique<UnaryExpr>(op, std::make_unique<BinaryExpr>(in, std::move(lhs), std::move(rhs)));
+            continue;
+        }
+
         auto rhs = parse_Expr(p + 1);
         lhs = std::make_unique<BinaryExpr>(op, std::move(lhs), std::move(rhs));
     }
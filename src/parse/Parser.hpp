@@ -24,6 +24,8 @@ struct M_EXPORT Parser
     private:
 
     Token tok_;
+    ///> the number of placeholders `?` parsed in the current statement; used to number the placeholders
+    unsigned num_placeholders_ = 0;
 
     public:
     explicit Parser(Lexer &lexer)
@@ -77,6 +79,7 @@ struct M_EXPORT Parser
     std::unique_ptr<Stmt> parse_CreateDatabaseStmt();
     std::unique_ptr<Stmt> parse_UseDatabaseStmt();
     std::unique_ptr<Stmt> parse_CreateTableStmt();
+    std::unique_ptr<Stmt> parse_CreateIndexStmt();
     std::unique_ptr<Stmt> parse_SelectStmt();
     std::unique_ptr<Stmt> parse_InsertStmt();
     std::unique_ptr<Stmt> parse_UpdateStmt();
@@ -14,12 +14,30 @@ using namespace m::ast;
 
 std::unique_ptr<DatabaseCommand> Sema::analyze(std::unique_ptr<ast::Command> ast)
 {
+    placeholders_.clear();
     (*this)(*ast); // perform semantic analysis
+    if (not placeholders_.empty()) {
+        /* There is no way to bind values to placeholders of a command.  Use `m::prepare_query()` instead. */
+        diag.e(placeholders_.front()->tok.pos) << "Placeholders are only allowed in prepared statements.\n";
+        command_.reset();
+    }
     if (command_)
         command_->ast(std::move(ast)); // move AST into DatabaseCommand instance
     return std::move(command_);
 }
 
+std::vector<const Type*> Sema::placeholder_types() const
+{
+    std::vector<const Type*> types;
+    for (auto p : placeholders_) {
+        const auto idx = p->placeholder_index();
+        if (idx >= types.size())
+            types.resize(idx + 1, nullptr);
+        types[idx] = p->type();
+    }
+    return types;
+}
+
 bool Sema::is_nested() const
 {
     return contexts_.size() > 1;
@@ -84,6 +102,29 @@ const char * Sema::make_unique_id_from_binding_path(context_stack_t::reverse_ite
     return C.pool(oss.str().c_str());
 }
 
+void Sema::bind_placeholder_type(Constant &placeholder, const Expr &other)
+{
+    M_insist(placeholder.is_placeholder());
+    M_insist(not placeholder.type_, "This placeholder has already been analyzed.");
+
+    if (other.type()->is_error()) {
+        placeholder.type_ = Type::Get_Error();
+        return;
+    }
+
+    /* The value of a placeholder is bound upon execution and must hence be of fixed size. */
+    auto pt = cast<const PrimitiveType>(other.type());
+    if (not pt or is<const CharacterSequence>(pt)) {
+        diag.e(placeholder.tok.pos) << "Cannot bind placeholder " << placeholder << " to " << other
+                                    << " of type " << *other.type() << ".\n";
+        placeholder.type_ = Type::Get_Error();
+        return;
+    }
+
+    placeholder.type_ = pt->as_scalar();
+    placeholders_.push_back(&placeholder);
+}
+
 bool Sema::is_composable_of(const ast::Expr &expr,
                             const std::vector<std::reference_wrapper<ast::Expr>> components)
 {
@@ -404,6 +445,14 @@ void Sema::operator()(Constant &e)
             e.type_ = Type::Get_None();
             break;
 
+        case TK_QMARK:
+            /* Placeholders that are operands of a binary expression are typed by `bind_placeholder_type()` and never
+             * reach this point. */
+            diag.e(e.tok.pos) << "Cannot infer the type of placeholder " << e
+                              << ", it must be an operand of a binary expression.\n";
+            e.type_ = Type::Get_Error();
+            break;
+
         case TK_STRING_LITERAL:
             e.type_ = Type::Get_Char(Type::TY_Scalar, interpret(e.tok.text).length());
             break;
@@ -719,6 +768,8 @@ void Sema::operator()(FnApplicationExpr &e)
 void Sema::operator()(UnaryExpr &e)
 {
     /* Analyze sub-expression. */
+    if (e.op() == TK_Exists)
+        exists_query_ = cast<const QueryExpr>(e.expr.get());
     (*this)(*e.expr);
 
     /* If the sub-expression is erroneous, so is this expression. */
@@ -739,6 +790,10 @@ void Sema::operator()(UnaryExpr &e)
             }
             break;
 
+        case TK_Exists:
+            M_insist(is<const QueryExpr>(*e.expr), "EXISTS requires a nested query");
+            break; // the nested query has boolean type
+
         case TK_PLUS:
         case TK_MINUS:
         case TK_TILDE:
@@ -755,9 +810,27 @@ void Sema::operator()(UnaryExpr &e)
 
 void Sema::operator()(BinaryExpr &e)
 {
-    /* Analyze sub-expressions. */
-    (*this)(*e.lhs);
-    (*this)(*e.rhs);
+    /* Analyze sub-expressions.  A placeholder adopts the type of the other operand.  The nested query of an `IN` is
+     * marked only right before analyzing the rhs, s.t. it is not mistaken for a nested query of the lhs. */
+    auto analyze_rhs = [&]() {
+        if (e.op() == TK_In)
+            in_query_ = cast<const QueryExpr>(e.rhs.get());
+        (*this)(*e.rhs);
+    };
+    auto lhs_placeholder = cast<Constant>(e.lhs.get());
+    auto rhs_placeholder = cast<Constant>(e.rhs.get());
+    if (lhs_placeholder and not lhs_placeholder->is_placeholder()) lhs_placeholder = nullptr;
+    if (rhs_placeholder and not rhs_placeholder->is_placeholder()) rhs_placeholder = nullptr;
+    if (lhs_placeholder and not rhs_placeholder) {
+        analyze_rhs();
+        bind_placeholder_type(*lhs_placeholder, *e.rhs);
+    } else if (rhs_placeholder and not lhs_placeholder) {
+        (*this)(*e.lhs);
+        bind_placeholder_type(*rhs_placeholder, *e.lhs);
+    } else {
+        (*this)(*e.lhs);
+        analyze_rhs();
+    }
 
     /* If at least one of the sub-expressions is erroneous, so is this expression. */
     if (e.lhs->type()->is_error() or e.rhs->type()->is_error()) {
@@ -889,6 +962,13 @@ void Sema::operator()(BinaryExpr &e)
             break;
         }
 
+        case TK_In:
+            if (not is<const QueryExpr>(*e.rhs)) {
+                diag.e(e.op().pos) << "Invalid expression " << e << ", right operand of IN must be a nested query.\n";
+                e.type_ = Type::Get_Error();
+                return;
+            }
+            /* fallthrough: `x IN (SELECT y ...)` compares `x` and `y` for equality */
         case TK_EQUAL:
         case TK_BANG_EQUAL: {
             if (not is_comparable(e.lhs->type(), e.rhs->type())) {
@@ -955,6 +1035,8 @@ void Sema::operator()(QueryExpr &e)
     M_insist(is<SelectStmt>(*e.query), "nested statements are always select statements");
 
     SemaContext &Ctx = get_context();
+    const bool is_exists = std::exchange(exists_query_, nullptr) == &e;
+    const bool is_in = std::exchange(in_query_, nullptr) == &e;
 
     /* Evaluate the nested statement in a fresh sema context. */
     push_context(*e.query, e.alias());
@@ -962,7 +1044,21 @@ void Sema::operator()(QueryExpr &e)
     M_insist(not contexts_.empty());
     SemaContext inner_ctx = pop_context();
 
-    /* TODO an EXISTS operator allows multiple results */
+    /* `EXISTS` and `IN` test for membership in the result of the nested statement, which may hence consist of any
+     * number of rows.  They are only supported as filters. */
+    if ((is_exists or is_in) and Ctx.stage != SemaContext::S_Where) {
+        diag.e(e.tok.pos) << "Invalid expression:\n" << e
+                           << ",\nnested statements of EXISTS and IN are only allowed in the WHERE clause.\n";
+        e.type_ = Type::Get_Error();
+        return;
+    }
+
+    /* An `EXISTS` only tests whether the nested statement returns any rows, regardless of their columns. */
+    if (is_exists) {
+        e.type_ = Type::Get_Boolean(Type::TY_Vector);
+        return;
+    }
+
     if (1 != inner_ctx.results.size()) {
         diag.e(e.tok.pos) << "Invalid expression:\n" << e << ",\nnested statement must return a single column.\n";
         e.type_ = Type::Get_Error();
@@ -979,6 +1075,10 @@ void Sema::operator()(QueryExpr &e)
     auto *pt = as<const PrimitiveType>(res.type_);
     e.type_ = pt;
 
+    /* An `IN` compares with each value of the single column returned by the nested statement. */
+    if (is_in)
+        return;
+
     switch (Ctx.stage) {
         default: {
             diag.e(e.tok.pos) << "Nested statements are not allowed in this stage.\n";
@@ -1497,7 +1597,7 @@ void Sema::operator()(CreateTableStmt &s)
 
         /* Check constraint definitions. */
         bool has_reference = false; ///< at most one reference allowed per attribute
-        bool is_unique = false, is_not_null = false;
+        bool is_unique = false, is_not_null = false, is_dictionary = false;
         get_context().stage = SemaContext::S_Where;
         for (auto &c : attr->constraints) {
             if (is<PrimaryKeyConstraint>(c)) {
@@ -1522,6 +1622,18 @@ void Sema::operator()(CreateTableStmt &s)
                 T->at(attr->name.text).not_nullable = true;
             }
 
+            if (is<DictionaryConstraint>(c)) {
+                if (is_dictionary)
+                    diag.w(c->tok.pos) << "Duplicate definition of attribute " << attr->name.text
+                                       << " as DICTIONARY.\n";
+                is_dictionary = true;
+                if (ty->is_character_sequence())
+                    T->at(attr->name.text).encode_by_dictionary();
+                else
+                    diag.e(c->tok.pos) << "Attribute " << attr->name.text << " of type " << *ty
+                                       << " cannot be dictionary encoded.\n";
+            }
+
             if (auto check = cast<CheckConditionConstraint>(c)) {
                 /* Verify that the type of the condition is boolean. */
                 /* TODO if the condition uses already mentioned attributes, we must add them to the sema context before
@@ -1561,6 +1673,53 @@ void Sema::operator()(CreateTableStmt &s)
         command_ = std::make_unique<CreateTable>(std::move(T));
 }
 
+void Sema::operator()(CreateIndexStmt &s)
+{
+    RequireContext RCtx(this, s);
+    Catalog &C = Catalog::Get();
+
+    if (not C.has_database_in_use()) {
+        diag.err() << "No database selected.\n";
+        return;
+    }
+    auto &DB = C.get_database_in_use();
+    const char *index_name = s.index_name.text;
+
+    /* Verify index does not yet exist. */
+    try {
+        DB.get_index(index_name);
+        diag.e(s.index_name.pos) << "Index " << index_name << " already exists in database " << DB.name << ".\n";
+        return;
+    } catch (std::out_of_range) {
+        /* nothing to be done */
+    }
+
+    /* Verify the indexed attribute exists and is of integral type. */
+    const Table *table;
+    try {
+        table = &DB.get_table(s.table_name.text);
+    } catch (std::out_of_range) {
+        diag.e(s.table_name.pos) << "Table " << s.table_name.text << " not found.\n";
+        return;
+    }
+    const Attribute *attr;
+    try {
+        attr = &table->at(s.attr_name.text);
+    } catch (std::out_of_range) {
+        diag.e(s.attr_name.pos) << "Attribute " << s.attr_name.text << " not found in table " << table->name
+                                << ".\n";
+        return;
+    }
+    if (not attr->type->is_integral()) {
+        diag.e(s.attr_name.pos) << "Attribute " << s.attr_name.text << " of type " << *attr->type
+                                << " cannot be indexed, only integral attributes are supported.\n";
+        return;
+    }
+
+    if (not is_nested())
+        command_ = std::make_unique<CreateIndex>(index_name, *attr);
+}
+
 void Sema::operator()(SelectStmt &s)
 {
     RequireContext RCtx(this, s);
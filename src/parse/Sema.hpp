@@ -109,6 +109,12 @@ struct M_EXPORT Sema : ASTVisitor
     std::ostringstream oss;
     ///> the command to execute when semantic analysis completes without errors
     std::unique_ptr<DatabaseCommand> command_;
+    ///> the placeholders `?` analyzed so far, in order of their analysis
+    std::vector<const Constant*> placeholders_;
+    ///> the nested query of the `EXISTS` currently analyzed, if any
+    const QueryExpr *exists_query_ = nullptr;
+    ///> the nested query of the `IN` currently analyzed, if any
+    const QueryExpr *in_query_ = nullptr;
 
     public:
     Sema(Diagnostic &diag) : diag(diag) { }
@@ -117,6 +123,9 @@ struct M_EXPORT Sema : ASTVisitor
      * errors occurred, `nullptr` otherwise. */
     std::unique_ptr<DatabaseCommand> analyze(std::unique_ptr<ast::Command> ast);
 
+    /** Returns the types of all placeholders `?` analyzed so far, indexed by `Constant::placeholder_index()`. */
+    std::vector<const Type*> placeholder_types() const;
+
     using ASTExprVisitor::operator();
     using ASTClauseVisitor::operator();
     using ASTCommandVisitor::operator();
@@ -193,6 +202,10 @@ struct M_EXPORT Sema : ASTVisitor
      * the elements in \p components. */
     void compose_of(std::unique_ptr<ast::Expr> &ptr, const std::vector<std::reference_wrapper<ast::Expr>> components);
 
+    /** Assigns the scalar type of \p other to \p placeholder, where \p other is the second operand of the binary
+     * expression \p placeholder is an operand of. */
+    void bind_placeholder_type(Constant &placeholder, const Expr &other);
+
     /** Creates a unique ID from a sequence of `SemaContext`s by concatenating their aliases. */
     const char * make_unique_id_from_binding_path(context_stack_t::reverse_iterator current_ctx,
                                                   context_stack_t::reverse_iterator binding_ctx);
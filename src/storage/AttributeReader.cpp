@@ -0,0 +1,56 @@
+#include "storage/AttributeReader.hpp"
+
+#include <cstring>
+#include <mutable/catalog/Schema.hpp>
+#include <mutable/storage/Store.hpp>
+
+
+using namespace m;
+using namespace m::storage;
+
+
+AttributeReader::AttributeReader(const Attribute &attr)
+    : attr_id_(attr.id)
+    , base_address_(reinterpret_cast<const uint8_t*>(attr.table.store().memory().addr()))
+{
+    M_insist(attr.dictionary or attr.type->is_integral() or attr.type->is_date() or attr.type->is_date_time(),
+             "attribute must be of integral representation or dictionary encoded");
+
+    /*----- Find the leaves of the attribute and the NULL bitmap. -----*/
+    bool has_value_leaf = false;
+    attr.table.layout().for_sibling_leaves([&](const std::vector<DataLayout::leaf_info_t> &leaves,
+                                               const DataLayout::level_info_stack_t &levels,
+                                               uint64_t inode_offset_in_bits)
+    {
+        for (auto &leaf_info : leaves) {
+            if (leaf_info.leaf.index() == attr.id) {
+                value_leaf_ = leaf_access_t{ levels, inode_offset_in_bits, leaf_info.offset_in_bits,
+                                             leaf_info.stride_in_bits };
+                size_in_bytes_ = leaf_info.leaf.type()->size() / 8;
+                reference_ = leaf_info.leaf.reference().value_or(0);
+                has_value_leaf = true;
+            } else if (leaf_info.leaf.index() == attr.table.num_attrs()) {
+                null_bitmap_leaf_ = leaf_access_t{ levels, inode_offset_in_bits, leaf_info.offset_in_bits,
+                                                   leaf_info.stride_in_bits };
+                has_null_bitmap_ = not attr.not_nullable;
+            }
+        }
+    });
+    M_insist(has_value_leaf, "attribute not found in data layout");
+    M_insist(value_leaf_.offset_in_bits % 8 == 0 and value_leaf_.stride_in_bits % 8 == 0,
+             "attribute must be byte aligned");
+}
+
+int64_t AttributeReader::read(std::size_t row_id) const
+{
+    const uint8_t *ptr = base_address_ + value_leaf_.offset_of(row_id) / 8;
+    /* Add the frame of reference in unsigned arithmetic, s.t. the sum wraps around just like it did when compressing. */
+    auto decompress = [this](int64_t v) -> int64_t { return uint64_t(reference_) + uint64_t(v); };
+    switch (size_in_bytes_) {
+        default: M_unreachable("invalid integral size");
+        case 1: { int8_t v;  std::memcpy(&v, ptr, sizeof(v)); return decompress(v); }
+        case 2: { int16_t v; std::memcpy(&v, ptr, sizeof(v)); return decompress(v); }
+        case 4: { int32_t v; std::memcpy(&v, ptr, sizeof(v)); return decompress(v); }
+        case 8: { int64_t v; std::memcpy(&v, ptr, sizeof(v)); return decompress(v); }
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <mutable/storage/DataLayout.hpp>
+
+
+namespace m {
+
+/*----- forward declarations -----------------------------------------------------------------------------------------*/
+struct Attribute;
+
+namespace storage {
+
+/** Reads the values of a single attribute of integral representation, i.e.\ of integral, `Date`, or `DateTime` type,
+ * or the codes of a dictionary encoded attribute, and their NULL bits directly from the memory of the attribute's
+ * store.  Decompresses the values of compressed attributes.  Computes the addresses like the Wasm point access does.
+ * The reader must be recreated if the store has moved or the data layout has changed. */
+struct AttributeReader
+{
+    private:
+    /** Describes how to compute the address of the values of a single leaf of a `DataLayout`. */
+    struct leaf_access_t
+    {
+        DataLayout::level_info_stack_t levels;
+        uint64_t inode_offset_in_bits = 0;
+        uint64_t offset_in_bits = 0;
+        uint64_t stride_in_bits = 0;
+
+        /** Returns the offset in bits of the value of the row with ID \p row_id. */
+        uint64_t offset_of(std::size_t row_id) const {
+            uint64_t offset = inode_offset_in_bits;
+            for (auto &level : levels) {
+                offset += (row_id / level.num_tuples) * level.stride_in_bits;
+                row_id %= level.num_tuples;
+            }
+            return offset + offset_in_bits + row_id * stride_in_bits;
+        }
+    };
+
+    std::size_t attr_id_; ///< the ID of the attribute, i.e.\ the index of its NULL bit in the NULL bitmap
+    std::size_t size_in_bytes_ = 0; ///< the size of a stored value in bytes
+    int64_t reference_ = 0; ///< the value added to each stored value, i.e.\ the frame of reference if compressed
+    const uint8_t *base_address_; ///< the address of the store's memory
+    leaf_access_t value_leaf_; ///< the leaf of the attribute's values
+    leaf_access_t null_bitmap_leaf_; ///< the leaf of the NULL bitmap
+    bool has_null_bitmap_ = false; ///< whether the attribute may be NULL and the layout has a NULL bitmap
+
+    public:
+    /** Creates a reader of the values of \p attr.  Requires \p attr to be of integral representation or dictionary
+     * encoded and byte aligned in the data layout of its table. */
+    explicit AttributeReader(const Attribute &attr);
+
+    /** Returns the address of the store's memory at the time this reader was created. */
+    const void * base_address() const { return base_address_; }
+
+    /** Returns `true` iff the value of the row with ID \p row_id is NULL. */
+    bool is_null(std::size_t row_id) const {
+        if (not has_null_bitmap_)
+            return false;
+        const auto null_bit = null_bitmap_leaf_.offset_of(row_id) + attr_id_;
+        return (base_address_[null_bit / 8] >> (null_bit % 8)) & 0x1;
+    }
+
+    /** Returns the value of the row with ID \p row_id, sign-extended to 64 bits and decompressed.  The value is
+     * unspecified if it is NULL. */
+    int64_t read(std::size_t row_id) const;
+};
+
+}
+
+}
@@ -0,0 +1,163 @@
+#include "storage/Compression.hpp"
+
+#include "backend/Interpreter.hpp"
+#include "storage/AttributeReader.hpp"
+#include <algorithm>
+#include <limits>
+#include <mutable/catalog/Catalog.hpp>
+#include <mutable/catalog/Schema.hpp>
+#include <mutable/IR/Tuple.hpp>
+#include <optional>
+#include <vector>
+
+
+using namespace m;
+using namespace m::storage;
+
+
+namespace {
+
+/** Returns `true` iff the values of \p attr can be compressed by frame of reference. */
+bool is_compressible(const Attribute &attr)
+{
+    return attr.type->is_integral() and not attr.dictionary;
+}
+
+/** Returns `true` iff \p value fits into the frame of reference \p frame. */
+bool fits(const Attribute::frame_of_reference_t &frame, int64_t value)
+{
+    const auto bits = frame.type->size();
+    const uint64_t min = uint64_t(frame.reference) - (uint64_t(1) << (bits - 1));
+    return uint64_t(value) - min < (uint64_t(1) << bits);
+}
+
+/** Returns the narrowest frame of reference of \p attr that fits all values in the closed interval [\p min, \p max],
+ * or `std::nullopt` if no frame narrower than the attribute's type fits. */
+std::optional<Attribute::frame_of_reference_t> frame_of_reference(const Attribute &attr, int64_t min, int64_t max)
+{
+    const uint64_t range = uint64_t(max) - uint64_t(min);
+    for (std::size_t bytes : { 1UL, 2UL, 4UL }) {
+        if (8 * bytes >= attr.type->size())
+            break;
+        if (range < (uint64_t(1) << (8 * bytes))) {
+            /* Center the frame s.t. the smallest value is stored as the smallest value of the signed type. */
+            const int64_t reference = int64_t(uint64_t(min) + (uint64_t(1) << (8 * bytes - 1)));
+            return Attribute::frame_of_reference_t{ Type::Get_Integer(Type::TY_Vector, bytes), reference };
+        }
+    }
+    return std::nullopt;
+}
+
+/** Changes the frames of reference of the attributes of \p table to \p frames, changes the data layout accordingly,
+ * and rewrites all rows of the table's store in place.  The rows keep their IDs and the store keeps its memory, hence
+ * indexes and zone maps remain valid. */
+void relayout(Table &table, const std::vector<std::optional<Attribute::frame_of_reference_t>> &frames)
+{
+    auto &store = table.store();
+    const std::size_t num_rows = store.num_rows();
+
+    /*----- Read all rows with the current data layout. -----*/
+    Schema S;
+    for (auto &attr : table)
+        S.add({table.name, attr.name}, attr.type);
+    std::vector<Tuple> rows;
+    rows.reserve(num_rows);
+    if (num_rows) {
+        auto loader = Interpreter::compile_load(S, store.memory().addr(), table.layout(), S);
+        for (std::size_t row_id = 0; row_id != num_rows; ++row_id) {
+            Tuple *args[] = { &rows.emplace_back(S) };
+            loader(args);
+        }
+    }
+
+    /*----- Change the data layout and rewrite all rows. -----*/
+    for (auto &attr : table) {
+        if (is_compressible(attr))
+            table.at(attr.id).frame_of_reference = frames[attr.id];
+    }
+    table.layout(Catalog::Get().data_layout());
+    if (num_rows) {
+        auto writer = Interpreter::compile_store(S, store.memory().addr(), table.layout(), S);
+        for (auto &row : rows) {
+            Tuple *args[] = { &row };
+            writer(args);
+        }
+    }
+}
+
+}
+
+std::size_t m::storage::compress(Table &table, const Tuple *pending)
+{
+    auto &store = table.store();
+    const std::size_t num_rows = store.num_rows();
+
+    /*----- Compute the frame of reference of each compressible attribute. -----*/
+    std::vector<std::optional<Attribute::frame_of_reference_t>> frames(table.num_attrs());
+    std::size_t num_changed = 0;
+    for (auto &attr : table) {
+        frames[attr.id] = attr.frame_of_reference;
+        if (not is_compressible(attr))
+            continue;
+        int64_t min = std::numeric_limits<int64_t>::max();
+        int64_t max = std::numeric_limits<int64_t>::min();
+        if (num_rows) {
+            const AttributeReader reader(attr);
+            for (std::size_t row_id = 0; row_id != num_rows; ++row_id) {
+                if (reader.is_null(row_id))
+                    continue;
+                const auto value = reader.read(row_id);
+                min = std::min(min, value);
+                max = std::max(max, value);
+            }
+        }
+        if (pending and not pending->is_null(attr.id)) {
+            const auto value = (*pending)[attr.id].as_i();
+            min = std::min(min, value);
+            max = std::max(max, value);
+        }
+        if (min <= max) // otherwise, there are no values, keep the current frame
+            frames[attr.id] = frame_of_reference(attr, min, max);
+        num_changed += frames[attr.id] != attr.frame_of_reference;
+    }
+    if (num_changed)
+        relayout(table, frames);
+    return num_changed;
+}
+
+std::size_t m::storage::widen_frames_of_reference(Table &table, const Tuple &tup)
+{
+    /*----- Widen the frame of each attribute whose value in `tup` does not fit to the narrowest frame that covers
+     * both the current frame and the value.  Since the current frame is exhausted, the new frame is at least twice as
+     * wide, hence each attribute is widened at most three times. -----*/
+    std::vector<std::optional<Attribute::frame_of_reference_t>> frames(table.num_attrs());
+    std::size_t num_changed = 0;
+    for (auto &attr : table) {
+        frames[attr.id] = attr.frame_of_reference;
+        if (not attr.frame_of_reference or tup.is_null(attr.id))
+            continue;
+        auto &frame = *attr.frame_of_reference;
+        const auto value = tup[attr.id].as_i();
+        if (fits(frame, value))
+            continue;
+        const auto half = int64_t(uint64_t(1) << (frame.type->size() - 1));
+        const int64_t min = frame.reference - half;
+        const int64_t max = frame.reference > std::numeric_limits<int64_t>::max() - (half - 1)
+                            ? std::numeric_limits<int64_t>::max() : frame.reference + (half - 1);
+        frames[attr.id] = frame_of_reference(attr, std::min(min, value), std::max(max, value));
+        ++num_changed;
+    }
+    if (num_changed)
+        relayout(table, frames);
+    return num_changed;
+}
+
+bool m::storage::fits_frames_of_reference(const Table &table, const Tuple &tup)
+{
+    for (auto &attr : table) {
+        if (attr.frame_of_reference and not tup.is_null(attr.id) and
+            not fits(*attr.frame_of_reference, tup[attr.id].as_i()))
+            return false;
+    }
+    return true;
+}
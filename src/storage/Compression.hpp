@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+
+
+namespace m {
+
+/*----- forward declarations -----------------------------------------------------------------------------------------*/
+struct Table;
+struct Tuple;
+
+namespace storage {
+
+/** Compresses the integral attributes of \p table by *frame of reference*: the data layout stores the difference of
+ * each value to a per-attribute reference value in the narrowest signed type of 8, 16, or 32 bits that fits the range
+ * of the attribute's values, see `Attribute::frame_of_reference`.  Considers the values of all rows of the table's
+ * store and, if given, the values of the tuple \p pending, which is about to be appended.  If the frames of reference
+ * change, changes the data layout of \p table and rewrites all rows of its store in place.  Returns the number of
+ * attributes whose frame of reference changed. */
+std::size_t compress(Table &table, const Tuple *pending = nullptr);
+
+/** Widens the frame of reference of each attribute of \p table whose value in \p tup, a tuple of the attributes of \p
+ * table, does not fit into it, s.t. \p tup can be appended to the store of \p table.  In contrast to `compress()`, the
+ * new frames are derived from the current frames rather than from the stored values, and each attribute is widened
+ * to at least twice its width, s.t. repeated appends rewrite the rows of the store at most three times per attribute.
+ * Changes the data layout of \p table and rewrites all rows of its store in place if a frame changes.  Returns the
+ * number of attributes whose frame of reference changed. */
+std::size_t widen_frames_of_reference(Table &table, const Tuple &tup);
+
+/** Returns `true` iff all values of \p tup, a tuple of the attributes of \p table, fit into the frames of reference of
+ * their attributes, i.e.\ iff \p tup can be appended to the store of \p table without recompressing. */
+bool fits_frames_of_reference(const Table &table, const Tuple &tup);
+
+}
+
+}
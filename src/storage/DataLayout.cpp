@@ -2,6 +2,7 @@
 
 #include <mutable/catalog/Schema.hpp>
 #include <mutable/catalog/Type.hpp>
+#include <mutable/storage/Dictionary.hpp>
 
 
 using namespace m;
@@ -119,6 +120,10 @@ void DataLayout::INode::print(std::ostream &out, unsigned int indentation) const
         if (auto child_leaf = cast<const Leaf>(child.ptr.get())) {
             out << "Leaf " << child_leaf->index() << " of type " << *child_leaf->type() << " with bit offset "
                 << child.offset_in_bits << " and bit stride " << child.stride_in_bits;
+            if (auto dict = child_leaf->dictionary())
+                out << " encoded by dictionary " << dict->id;
+            if (auto reference = child_leaf->reference())
+                out << " compressed relative to " << *reference;
         } else {
             auto child_inode = as<const INode>(child.ptr.get());
             out << "INode of " << child_inode->num_tuples() << " tuple(s) with bit offset " << child.offset_in_bits
@@ -156,6 +161,46 @@ DataLayout::INode & DataLayout::add_inode(size_type num_tuples, uint64_t stride_
     return *inode;
 }
 
+void DataLayout::encode(size_type idx, Dictionary &dictionary)
+{
+    auto encode_impl = [&](INode &inode, auto &rec) -> bool {
+        for (auto &child : inode.children_) {
+            if (auto child_leaf = cast<Leaf>(child.ptr.get())) {
+                if (child_leaf->index() == idx) {
+                    M_insist(*child_leaf->type() == *Dictionary::Code_Type(), "leaf must store codes");
+                    child_leaf->dictionary_ = &dictionary;
+                    return true;
+                }
+            } else if (rec(as<INode>(*child.ptr), rec)) {
+                return true;
+            }
+        }
+        return false;
+    };
+    if (not encode_impl(inode_, encode_impl))
+        throw m::invalid_argument("no leaf with the given index");
+}
+
+void DataLayout::compress(size_type idx, int64_t reference)
+{
+    auto compress_impl = [&](INode &inode, auto &rec) -> bool {
+        for (auto &child : inode.children_) {
+            if (auto child_leaf = cast<Leaf>(child.ptr.get())) {
+                if (child_leaf->index() == idx) {
+                    M_insist(child_leaf->type()->is_integral(), "leaf must be of integral type");
+                    child_leaf->reference_ = reference;
+                    return true;
+                }
+            } else if (rec(as<INode>(*child.ptr), rec)) {
+                return true;
+            }
+        }
+        return false;
+    };
+    if (not compress_impl(inode_, compress_impl))
+        throw m::invalid_argument("no leaf with the given index");
+}
+
 void DataLayout::accept(ConstDataLayoutVisitor &v) const { v(*this); }
 
 void DataLayout::for_sibling_leaves(DataLayout::callback_leaves_t callback) const
@@ -216,7 +261,7 @@ bool m::storage::supports_simd(const DataLayout &layout, const Schema &layout_sc
                 auto tuple_it = tuple_schema.find(layout_schema[child_leaf.index()].id);
                 if (tuple_it == tuple_schema.end())
                     continue; // entry not contained in tuple schema
-                M_insist(*tuple_it->type == *child_leaf.type());
+                M_insist(child_leaf.dictionary() or child_leaf.reference() or *tuple_it->type == *child_leaf.type());
 
                 if (bit_stride) {
                     if (child.stride_in_bits != 1)
@@ -0,0 +1,60 @@
+#include <mutable/storage/Dictionary.hpp>
+
+#include <cstring>
+#include <limits>
+#include <mutable/catalog/Type.hpp>
+#include <stdexcept>
+
+
+using namespace m;
+
+
+/*======================================================================================================================
+ * Dictionary
+ *====================================================================================================================*/
+
+Dictionary::Dictionary(const CharacterSequence &type)
+    : id(next_id_++)
+    , type_(type)
+    , data_(allocator_.allocate(ALLOCATION_SIZE))
+{ }
+
+const PrimitiveType * Dictionary::Code_Type() { return Type::Get_Integer(Type::TY_Vector, sizeof(code_type)); }
+
+std::size_t Dictionary::entry_size() const { return type_.size() / 8; }
+
+Dictionary::code_type Dictionary::encode(const char *str)
+{
+    M_insist(str, "cannot encode NULL");
+    const std::string_view key(str, strnlen(str, type_.length));
+    if (auto it = codes_.find(key); it != codes_.end())
+        return it->second;
+
+    if ((size_ + 1) * entry_size() > ALLOCATION_SIZE)
+        throw std::length_error("dictionary exceeds its allocation");
+    M_insist(size_ <= std::numeric_limits<code_type>::max(), "code out of range");
+
+    /*----- Append the string as a new entry, padded with NUL bytes. -----*/
+    char *entry = data_.as<char*>() + size_ * entry_size();
+    std::memset(entry, 0, entry_size());
+    std::memcpy(entry, key.data(), key.size());
+    const code_type code = size_++;
+    codes_.emplace(std::string_view(entry, key.size()), code);
+    return code;
+}
+
+std::optional<Dictionary::code_type> Dictionary::find(const char *str) const
+{
+    M_insist(str, "cannot find NULL");
+    if (auto it = codes_.find(std::string_view(str, strnlen(str, type_.length))); it != codes_.end())
+        return it->second;
+    return std::nullopt;
+}
+
+M_LCOV_EXCL_START
+void Dictionary::dump(std::ostream &out) const
+{
+    out << "Dictionary " << id << " of " << type_ << ": " << size_ << " entries" << std::endl;
+}
+void Dictionary::dump() const { dump(std::cerr); }
+M_LCOV_EXCL_STOP
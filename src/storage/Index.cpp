@@ -0,0 +1,88 @@
+#include <mutable/storage/Index.hpp>
+
+#include "storage/AttributeReader.hpp"
+#include <algorithm>
+#include <mutable/catalog/Schema.hpp>
+#include <mutable/storage/Store.hpp>
+#include <stdexcept>
+
+
+using namespace m;
+using namespace m::storage;
+
+
+/*======================================================================================================================
+ * Index
+ *====================================================================================================================*/
+
+Index::Index(const char *name, const Attribute &attr)
+    : id(next_id_++)
+    , name(M_notnull(name))
+    , attr(attr)
+{
+    if (not attr.type->is_integral())
+        throw std::invalid_argument("indexed attribute must be of integral type");
+}
+
+const Table & Index::table() const { return attr.table; }
+
+void Index::update()
+{
+    const auto &store = table().store();
+    const auto num_rows = store.num_rows();
+    const auto *base_address = reinterpret_cast<const uint8_t*>(store.memory().addr());
+
+    if (num_rows < num_rows_indexed_ or base_address != store_addr_) { // rows dropped or store moved, rebuild
+        entries_.clear();
+        num_rows_indexed_ = 0;
+        store_addr_ = base_address;
+    }
+    if (num_rows == num_rows_indexed_)
+        return;
+
+    /*----- Collect the entries of all rows appended since the last update. -----*/
+    const AttributeReader reader(attr);
+    const auto num_entries_before = entries_.size();
+    entries_.reserve(num_entries_before + (num_rows - num_rows_indexed_));
+    for (std::size_t row_id = num_rows_indexed_; row_id != num_rows; ++row_id) {
+        if (reader.is_null(row_id))
+            continue; // NULL keys are not indexed
+        entries_.emplace_back(reader.read(row_id), uint32_t(row_id));
+    }
+    num_rows_indexed_ = num_rows;
+
+    /*----- Sort the new entries and merge them with the existing ones. -----*/
+    const auto middle = entries_.begin() + num_entries_before;
+    std::sort(middle, entries_.end());
+    std::inplace_merge(entries_.begin(), middle, entries_.end());
+}
+
+std::size_t Index::lower_bound(key_type key) const
+{
+    auto it = std::lower_bound(entries_.cbegin(), entries_.cend(), key,
+                               [](const entry_type &e, key_type key) { return e.first < key; });
+    return std::distance(entries_.cbegin(), it);
+}
+
+std::size_t Index::upper_bound(key_type key) const
+{
+    auto it = std::upper_bound(entries_.cbegin(), entries_.cend(), key,
+                               [](key_type key, const entry_type &e) { return key < e.first; });
+    return std::distance(entries_.cbegin(), it);
+}
+
+void Index::row_ids(std::size_t begin, std::size_t end, uint32_t *out) const
+{
+    M_insist(begin <= end and end <= entries_.size());
+    for (auto it = entries_.cbegin() + begin, it_end = entries_.cbegin() + end; it != it_end; ++it)
+        *out++ = it->second;
+}
+
+M_LCOV_EXCL_START
+void Index::dump(std::ostream &out) const
+{
+    out << "Index " << name << " on " << table().name << '.' << attr.name << ": " << entries_.size() << " entries, "
+        << num_rows_indexed_ << " rows indexed" << std::endl;
+}
+void Index::dump() const { dump(std::cerr); }
+M_LCOV_EXCL_STOP
@@ -1,6 +1,7 @@
 #include "storage/Store.hpp"
 
 #include <cmath>
+#include <mutable/storage/ZoneMap.hpp>
 
 
 using namespace m;
@@ -10,6 +11,18 @@ using namespace m;
  * Store
  *====================================================================================================================*/
 
+Store::Store(const Table &table) : table_(table) { }
+
+Store::~Store() { }
+
+const ZoneMap & Store::zone_map() const
+{
+    if (not zone_map_)
+        zone_map_ = std::make_unique<ZoneMap>(table_);
+    zone_map_->update(); // catch up with rows appended since the zone map was last used
+    return *zone_map_;
+}
+
 M_LCOV_EXCL_START
 void Store::dump() const { dump(std::cerr); }
 M_LCOV_EXCL_STOP
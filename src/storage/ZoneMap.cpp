@@ -0,0 +1,104 @@
+#include <mutable/storage/ZoneMap.hpp>
+
+#include "storage/AttributeReader.hpp"
+#include <mutable/catalog/Schema.hpp>
+#include <mutable/storage/Store.hpp>
+
+
+using namespace m;
+using namespace m::storage;
+
+
+namespace {
+
+/** Returns the number of rows of a zone of \p table, i.e.\ the smallest whole multiple of the number of rows of a
+ * block of the table's data layout which is at least `ZoneMap::MIN_ZONE_SIZE` and a whole multiple of
+ * `ZoneMap::ZONE_SIZE_ALIGNMENT`. */
+std::size_t compute_zone_size(const Table &table)
+{
+    M_insist(not table.layout().is_finite(), "zone maps require an infinite data layout");
+    const std::size_t num_rows_per_block = table.layout().child().num_tuples();
+    std::size_t zone_size = num_rows_per_block;
+    while (zone_size < ZoneMap::MIN_ZONE_SIZE or zone_size % ZoneMap::ZONE_SIZE_ALIGNMENT != 0)
+        zone_size += num_rows_per_block;
+    return zone_size;
+}
+
+}
+
+
+/*======================================================================================================================
+ * ZoneMap
+ *====================================================================================================================*/
+
+ZoneMap::ZoneMap(const Table &table)
+    : table_(table)
+    , summaries_(table.num_attrs())
+{ }
+
+bool ZoneMap::Is_Summarized(const Type &ty) { return ty.is_integral() or ty.is_date() or ty.is_date_time(); }
+
+const ZoneMap::summary_t & ZoneMap::summary(const Attribute &attr, std::size_t zone) const
+{
+    M_insist(&attr.table == &table_, "attribute does not belong to the summarized table");
+    M_insist(Is_Summarized(*attr.type), "attribute is not summarized");
+    M_insist(zone < summaries_[attr.id].size());
+    return summaries_[attr.id][zone];
+}
+
+void ZoneMap::update()
+{
+    const auto &store = table_.store();
+    const auto num_rows = store.num_rows();
+    const auto zone_size = compute_zone_size(table_);
+
+    if (num_rows < num_rows_summarized_ or store.memory().addr() != store_addr_ or zone_size != zone_size_) {
+        /* Rows dropped, store moved, or data layout changed, rebuild. */
+        for (auto &summaries : summaries_)
+            summaries.clear();
+        num_rows_summarized_ = 0;
+        store_addr_ = store.memory().addr();
+        zone_size_ = zone_size;
+    }
+    if (num_rows == num_rows_summarized_)
+        return;
+
+    /*----- Summarize the values of all rows appended since the last update, attribute by attribute. -----*/
+    const std::size_t num_zones = (num_rows + zone_size_ - 1) / zone_size_;
+    for (auto &attr : table_) {
+        if (not Is_Summarized(*attr.type))
+            continue;
+
+        const AttributeReader reader(attr);
+        auto &summaries = summaries_[attr.id];
+        summaries.resize(num_zones);
+        for (std::size_t row_id = num_rows_summarized_; row_id != num_rows; ++row_id) {
+            auto &s = summaries[row_id / zone_size_];
+            if (reader.is_null(row_id)) {
+                ++s.num_nulls;
+            } else {
+                const auto value = reader.read(row_id);
+                s.min = std::min(s.min, value);
+                s.max = std::max(s.max, value);
+            }
+        }
+    }
+    num_rows_summarized_ = num_rows;
+}
+
+M_LCOV_EXCL_START
+void ZoneMap::dump(std::ostream &out) const
+{
+    out << "ZoneMap of " << table_.name << ": " << num_zones() << " zones of " << zone_size_ << " rows, "
+        << num_rows_summarized_ << " rows summarized" << std::endl;
+    for (auto &attr : table_) {
+        if (summaries_[attr.id].empty())
+            continue;
+        out << "  " << attr.name << ':';
+        for (auto &s : summaries_[attr.id])
+            out << " [" << s.min << ", " << s.max << "; " << s.num_nulls << " NULLs]";
+        out << std::endl;
+    }
+}
+void ZoneMap::dump() const { dump(std::cerr); }
+M_LCOV_EXCL_STOP
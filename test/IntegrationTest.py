@@ -6,6 +6,7 @@ import glob
 import itertools
 import math
 import os
+import shlex
 import subprocess
 import yamale
 import yaml
@@ -263,7 +264,7 @@ def lexer_command(test_case):
     binary = BINARIES['lex']
     command = [binary, '-']
     if test_case.cli_args:
-        command.append(test_case.cli_args)
+        command.extend(shlex.split(test_case.cli_args))
     return [ command ]
 
 
@@ -271,7 +272,7 @@ def parser_command(test_case):
     binary = BINARIES['parse']
     command = [binary, '-']
     if test_case.cli_args:
-        command.append(test_case.cli_args)
+        command.extend(shlex.split(test_case.cli_args))
     return [ command ]
 
 
@@ -280,7 +281,7 @@ def sema_command(test_case):
     setup = os.path.join(os.path.dirname(test_case.filename), 'data', 'schema.sql')
     command = [binary, '--quiet', setup, '-']
     if test_case.cli_args:
-        command.append(test_case.cli_args)
+        command.extend(shlex.split(test_case.cli_args))
     return [ command ]
 
 
@@ -289,7 +290,7 @@ def end2end_command(test_case):
     setup = os.path.join(os.path.dirname(test_case.filename), 'data', 'schema.sql')
     command = [binary, '--quiet', '--noprompt', setup, '-']
     if test_case.cli_args:
-        command.append(test_case.cli_args)
+        command.extend(shlex.split(test_case.cli_args))
     configurations = list()
     data_layout_options = enumerate_feature_options('data-layout')
     backend_options = enumerate_feature_options('backend')
@@ -29,7 +29,22 @@ CREATE TABLE D (
     rdatetime DATETIME NOT NULL
 );
 
+CREATE TABLE N (
+    key INT(2) NOT NULL,
+    nkey INT(4),
+    nfloat DOUBLE,
+    nstring CHAR(15)
+);
+
+CREATE TABLE E (
+    key INT(2) NOT NULL,
+    estring CHAR(10) NOT NULL DICTIONARY,
+    nestring VARCHAR(10) DICTIONARY
+);
+
 IMPORT INTO R DSV "test/ours/data/R.csv" HAS HEADER SKIP HEADER;
 IMPORT INTO S DSV "test/ours/data/S.csv" HAS HEADER SKIP HEADER;
 IMPORT INTO T DSV "test/ours/data/T.csv" HAS HEADER SKIP HEADER;
 IMPORT INTO D DSV "test/ours/data/D.csv" HAS HEADER SKIP HEADER;
+IMPORT INTO N DSV "test/ours/data/N.csv" HAS HEADER SKIP HEADER;
+IMPORT INTO E DSV "test/ours/data/E.csv" HAS HEADER SKIP HEADER;
@@ -1437,6 +1437,138 @@ TEST_CASE("GraphBuilder/SelectStmt", "[core][IR][unit]")
 #endif
     }
 
+    SECTION("test semi-joins of EXISTS and IN in WHERE clause")
+    {
+        SECTION("test uncorrelated EXISTS")
+        {
+            const char *query = "SELECT id \
+                                 FROM A \
+                                 WHERE EXISTS (SELECT B.id FROM B);";
+            auto stmt = as<SelectStmt>(m::statement_from_string(diag, query));
+            auto graph = QueryGraph::Build(*stmt);
+
+            REQUIRE(graph->sources().size() == 1);
+            REQUIRE(graph->sources()[0]->name() == c_A);
+            REQUIRE(graph->sources()[0]->filter().empty());
+            REQUIRE(graph->joins().empty());
+            REQUIRE(graph->projections().size() == 1);
+
+            REQUIRE(graph->semi_joins().size() == 1);
+            auto &sj = *graph->semi_joins()[0];
+            REQUIRE(sj.kind() == SemiJoin::SJ_Semi);
+            REQUIRE_FALSE(sj.is_anti());
+            REQUIRE(sj.alias());
+            REQUIRE(sj.condition().empty());
+            REQUIRE(sj.query_graph().sources().size() == 1);
+            REQUIRE(sj.query_graph().sources()[0]->name() == c_B);
+        }
+
+        SECTION("test correlated NOT EXISTS")
+        {
+            const char *query = "SELECT id \
+                                 FROM A \
+                                 WHERE NOT EXISTS (SELECT B.id FROM B WHERE B.val = A.val AND B.bool);";
+            auto stmt = as<SelectStmt>(m::statement_from_string(diag, query));
+            auto graph = QueryGraph::Build(*stmt);
+
+            REQUIRE(graph->sources().size() == 1);
+            REQUIRE(graph->sources()[0]->filter().empty());
+            REQUIRE(graph->semi_joins().size() == 1);
+            auto &sj = *graph->semi_joins()[0];
+            REQUIRE(sj.kind() == SemiJoin::SJ_Anti);
+            REQUIRE(sj.is_anti());
+
+            /* the correlated clause becomes the condition, the uncorrelated clause remains a filter */
+            REQUIRE(sj.condition().size() == 1);
+            auto cond = cast<const BinaryExpr>(&sj.condition()[0][0].expr());
+            REQUIRE(cond);
+            REQUIRE(streq(to_string(*cond->lhs).c_str(), "B.val"));
+            REQUIRE(streq(to_string(*cond->rhs).c_str(), "A.val"));
+            auto &nested = sj.query_graph();
+            REQUIRE(nested.sources().size() == 1);
+            REQUIRE(nested.sources()[0]->filter().size() == 1);
+
+            /* the attribute of the nested query referenced by the condition is projected */
+            REQUIRE(nested.projections().size() == 2);
+            REQUIRE(streq(to_string(nested.projections()[1].first.get()).c_str(), "B.val"));
+        }
+
+        SECTION("test IN")
+        {
+            const char *query = "SELECT id \
+                                 FROM A \
+                                 WHERE val IN (SELECT B.val FROM B);";
+            auto stmt = as<SelectStmt>(m::statement_from_string(diag, query));
+            auto graph = QueryGraph::Build(*stmt);
+
+            REQUIRE(graph->sources().size() == 1);
+            REQUIRE(graph->sources()[0]->filter().empty());
+            REQUIRE(graph->semi_joins().size() == 1);
+            auto &sj = *graph->semi_joins()[0];
+            REQUIRE(sj.kind() == SemiJoin::SJ_Semi);
+
+            /* the condition is the `IN` predicate, comparing with the value projected as `$res` */
+            REQUIRE(sj.condition().size() == 1);
+            auto in = cast<const BinaryExpr>(&sj.condition()[0][0].expr());
+            REQUIRE(in);
+            REQUIRE(in->op().type == TK_In);
+            REQUIRE(streq(to_string(*in->lhs).c_str(), "val"));
+            REQUIRE(sj.query_graph().projections().size() == 1);
+            REQUIRE(sj.query_graph().projections()[0].second == C.pool("$res"));
+        }
+
+        SECTION("test NOT IN and a filter")
+        {
+            const char *query = "SELECT id \
+                                 FROM A \
+                                 WHERE A.bool AND val NOT IN (SELECT B.val FROM B);";
+            auto stmt = as<SelectStmt>(m::statement_from_string(diag, query));
+            auto graph = QueryGraph::Build(*stmt);
+
+            REQUIRE(graph->sources().size() == 1);
+            REQUIRE(graph->sources()[0]->filter().size() == 1);
+            REQUIRE(graph->semi_joins().size() == 1);
+            auto &sj = *graph->semi_joins()[0];
+            REQUIRE(sj.kind() == SemiJoin::SJ_NullAwareAnti);
+            REQUIRE(sj.is_anti());
+            REQUIRE(sj.condition().size() == 1);
+        }
+
+        SECTION("test two semi-joins")
+        {
+            const char *query = "SELECT id \
+                                 FROM A \
+                                 WHERE EXISTS (SELECT B.id FROM B WHERE B.id = A.id) \
+                                   AND val IN (SELECT C.val FROM C);";
+            auto stmt = as<SelectStmt>(m::statement_from_string(diag, query));
+            auto graph = QueryGraph::Build(*stmt);
+
+            REQUIRE(graph->sources().size() == 1);
+            REQUIRE(graph->semi_joins().size() == 2);
+            REQUIRE(graph->semi_joins()[0]->query_graph().sources()[0]->name() == c_B);
+            REQUIRE(graph->semi_joins()[1]->query_graph().sources()[0]->name() == c_C);
+            REQUIRE(graph->semi_joins()[0]->alias() != graph->semi_joins()[1]->alias());
+        }
+
+        SECTION("test unsupported EXISTS and IN")
+        {
+            const char *queries[] = {
+                /* not a conjunct of the WHERE clause */
+                "SELECT id FROM A WHERE A.bool OR EXISTS (SELECT B.id FROM B);",
+                "SELECT id FROM A WHERE A.bool OR val IN (SELECT B.val FROM B);",
+                /* correlated nested query with grouping or LIMIT */
+                "SELECT id FROM A WHERE EXISTS (SELECT MIN(B.id) FROM B WHERE B.val = A.val GROUP BY B.bool);",
+                "SELECT id FROM A WHERE EXISTS (SELECT B.id FROM B WHERE B.val = A.val LIMIT 1);",
+            };
+
+            for (auto q : queries) {
+                auto stmt = as<SelectStmt>(m::statement_from_string(diag, q));
+                REQUIRE(stmt);
+                CHECK_THROWS_AS(QueryGraph::Build(*stmt), m::invalid_argument);
+            }
+        }
+    }
+
 #if 0
     SECTION("test nested queries in WHERE clause")
     {
@@ -0,0 +1,130 @@
+#include "catch2/catch.hpp"
+
+#include <cstring>
+#include <mutable/catalog/Catalog.hpp>
+#include <mutable/IR/Operator.hpp>
+#include <mutable/IR/Optimizer.hpp>
+#include <mutable/IR/QueryGraph.hpp>
+#include <mutable/IR/ResultBatch.hpp>
+#include <mutable/mutable.hpp>
+#include <mutable/util/ADT.hpp>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+using namespace m;
+
+
+namespace {
+
+/** Executes the SQL statement \p sql and requires it to succeed. */
+void execute(const std::string &sql)
+{
+    std::ostringstream out, err;
+    Diagnostic diag(false, out, err);
+    auto stmt = statement_from_string(diag, sql);
+    REQUIRE(stmt);
+    execute_statement(diag, *stmt);
+    REQUIRE(diag.num_errors() == 0);
+    REQUIRE(err.str().empty());
+}
+
+/** A result tuple with a `std::nullopt` for each NULL value. */
+struct row_t
+{
+    std::optional<int32_t> k;
+    std::optional<double> f;
+    std::optional<bool> b;
+    std::optional<std::string> s;
+
+    bool operator==(const row_t&) const = default;
+};
+
+/** Returns the rows of \p batch with the columns k, f, b, and s. */
+std::vector<row_t> rows_of(const ResultBatch &batch)
+{
+    REQUIRE(batch.num_columns() == 4);
+    auto k = batch.values<int32_t>(0);
+    auto f = batch.values<double>(1);
+    std::vector<row_t> rows;
+    for (std::size_t row = 0; row != batch.num_tuples(); ++row) {
+        row_t &r = rows.emplace_back();
+        if (not batch.is_null(0, row)) r.k = k[row];
+        if (not batch.is_null(1, row)) r.f = f[row];
+        if (not batch.is_null(2, row)) r.b = batch.as_bool(2, row);
+        if (not batch.is_null(3, row)) {
+            const char *str = batch.as_string(3, row);
+            r.s = std::string(str, strnlen(str, 4));
+        }
+    }
+    return rows;
+}
+
+}
+
+
+TEST_CASE("ResultBatch", "[core][IR][resultbatch]")
+{
+    Catalog::Clear();
+    Catalog &C = Catalog::Get();
+    auto &DB = C.add_database(C.pool("db"));
+    C.set_database_in_use(DB);
+
+    execute("CREATE TABLE t (k INT(4), f DOUBLE, b BOOL, s CHAR(4));");
+    execute("INSERT INTO t VALUES "
+            "(0, 0.5, TRUE, \"a\"), "
+            "(1, NULL, FALSE, \"bb\"), "
+            "(NULL, 2.5, NULL, \"cccc\"), "
+            "(3, 3.5, TRUE, NULL), "
+            "(NULL, NULL, NULL, NULL), "
+            "(5, 5.5, FALSE, \"\"), "
+            "(6, NULL, TRUE, \"g\");");
+    const std::vector<row_t> expected{
+        { 0,            0.5,          true,         "a"          },
+        { 1,            std::nullopt, false,        "bb"         },
+        { std::nullopt, 2.5,          std::nullopt, "cccc"       },
+        { 3,            3.5,          true,         std::nullopt },
+        { std::nullopt, std::nullopt, std::nullopt, std::nullopt },
+        { 5,            5.5,          false,        ""           },
+        { 6,            std::nullopt, true,         "g"          },
+    };
+
+    std::ostringstream out, err;
+    Diagnostic diag(false, out, err);
+    auto stmt = statement_from_string(diag, "SELECT k, f, b, s FROM t;");
+    REQUIRE(stmt);
+    auto query_graph = QueryGraph::Build(*stmt);
+    Optimizer Opt(C.plan_enumerator(), C.cost_function());
+
+    /* Every backend must pass the same values and NULL bits in batches of exactly the requested size. */
+    for (auto &backend : range(C.backends_cbegin(), C.backends_cend())) {
+        DYNAMIC_SECTION("backend " << backend.first)
+        {
+            std::vector<std::size_t> batch_sizes;
+            std::vector<row_t> rows;
+            auto callback = std::make_unique<CallbackOperator>([&](const Schema &schema, const ResultBatch &batch) {
+                REQUIRE(schema.num_entries() == 4);
+                batch_sizes.push_back(batch.num_tuples());
+                for (auto &r : rows_of(batch))
+                    rows.push_back(std::move(r));
+
+                /* a slice of the batch must agree with the batch */
+                if (batch.num_tuples() >= 2) {
+                    auto all = rows_of(batch);
+                    CHECK(rows_of(batch.slice(1, 1)) == std::vector<row_t>{ all[1] });
+                    CHECK(rows_of(batch.slice(1, batch.num_tuples() - 1)) ==
+                          std::vector<row_t>(all.begin() + 1, all.end()));
+                }
+            }, 3);
+            callback->add_child(Opt(*query_graph).release());
+            C.create_backend(backend.first)->execute(*callback);
+
+            CHECK(batch_sizes == std::vector<std::size_t>{ 3, 3, 1 });
+            CHECK(rows == expected);
+        }
+    }
+
+    Catalog::Clear();
+}
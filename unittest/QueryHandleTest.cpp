@@ -0,0 +1,157 @@
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <mutable/catalog/Catalog.hpp>
+#include <mutable/IR/ResultBatch.hpp>
+#include <mutable/mutable.hpp>
+#include <mutable/util/ADT.hpp>
+#include <mutable/util/fn.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+using namespace m;
+using namespace m::ast;
+
+
+namespace {
+
+/** Executes the SQL statement \p sql and requires it to succeed. */
+void execute(const std::string &sql)
+{
+    std::ostringstream out, err;
+    Diagnostic diag(false, out, err);
+    auto stmt = statement_from_string(diag, sql);
+    REQUIRE(stmt);
+    execute_statement(diag, *stmt);
+    REQUIRE(diag.num_errors() == 0);
+    REQUIRE(err.str().empty());
+}
+
+}
+
+
+TEST_CASE("QueryHandle", "[core][queryhandle]")
+{
+    Catalog::Clear();
+    Catalog &C = Catalog::Get();
+    auto &DB = C.add_database(C.pool("db"));
+    C.set_database_in_use(DB);
+
+    execute("CREATE TABLE t (k INT(4) NOT NULL);");
+    execute("INSERT INTO t VALUES (0), (1), (2), (3), (4), (5), (6), (7), (8), (9);");
+
+    std::ostringstream out, err;
+    Diagnostic diag(false, out, err);
+    auto stmt = statement_from_string(diag, "SELECT k FROM t;");
+    REQUIRE(stmt);
+    auto &select = as<const SelectStmt>(*stmt);
+
+    SECTION("passes all results in batches")
+    {
+        auto handle = open_query(diag, select, 4);
+        REQUIRE(handle->schema().num_entries() == 1);
+
+        std::vector<std::size_t> batch_sizes;
+        std::vector<int32_t> keys;
+        while (auto batch = handle->next_batch()) {
+            batch_sizes.push_back(batch->num_tuples());
+            for (auto k : batch->values<int32_t>(0))
+                keys.push_back(k);
+        }
+        CHECK(batch_sizes == std::vector<std::size_t>{ 4, 4, 2 });
+        CHECK(keys == std::vector<int32_t>{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 });
+        CHECK(handle->next_batch() == nullptr);
+    }
+
+    SECTION("another query may run while a query is suspended")
+    {
+        auto first = open_query(diag, select, 4);
+        auto second = open_query(diag, select, 8);
+
+        auto batch = first->next_batch();
+        REQUIRE(batch);
+        CHECK(batch->num_tuples() == 4);
+
+        std::size_t num_tuples = 0;
+        while (auto b = second->next_batch())
+            num_tuples += b->num_tuples();
+        CHECK(num_tuples == 10);
+
+        batch = first->next_batch();
+        REQUIRE(batch);
+        CHECK(batch->values<int32_t>(0)[0] == 4);
+    }
+
+    SECTION("cancel() aborts the query")
+    {
+        auto handle = open_query(diag, select, 4);
+        REQUIRE(handle->next_batch());
+        handle->cancel();
+        CHECK(handle->next_batch() == nullptr);
+    }
+
+    SECTION("a query may be cancelled before it started")
+    {
+        auto handle = open_query(diag, select, 4);
+        handle->cancel();
+        CHECK(handle->next_batch() == nullptr);
+    }
+
+    SECTION("the batch size must not be 0")
+    {
+        CHECK_THROWS_AS(open_query(diag, select, 0), invalid_argument);
+    }
+
+    Catalog::Clear();
+}
+
+TEST_CASE("QueryHandle/WasmV8", "[core][queryhandle][wasm][v8]")
+{
+    Catalog::Clear();
+    Catalog &C = Catalog::Get();
+    auto &DB = C.add_database(C.pool("db"));
+    C.set_database_in_use(DB);
+
+    auto backends = range(C.backends_cbegin(), C.backends_cend());
+    const bool has_v8 = std::any_of(backends.begin(), backends.end(), [](const auto &backend) {
+        return streq(backend.first, "WasmV8");
+    });
+    if (not has_v8) {
+        Catalog::Clear();
+        return;
+    }
+    const char *saved_default_backend = C.default_backend_name();
+    C.default_backend("WasmV8");
+
+    execute("CREATE TABLE t (k INT(4) NOT NULL);");
+    execute("INSERT INTO t VALUES (0), (1), (2), (3), (4), (5), (6), (7), (8), (9);");
+
+    std::ostringstream out, err;
+    Diagnostic diag(false, out, err);
+    auto stmt = statement_from_string(diag, "SELECT k FROM t;");
+    REQUIRE(stmt);
+    auto &select = as<const SelectStmt>(*stmt);
+
+    /* Cancelling unwinds the execution of the Wasm module.  This must release the `WasmContext` and leave the isolate,
+     * s.t. subsequent queries can be executed. */
+    for (unsigned i = 0; i != 100; ++i) {
+        auto handle = open_query(diag, select, 4);
+        REQUIRE(handle->next_batch());
+        handle->cancel();
+        CHECK(handle->next_batch() == nullptr);
+    }
+
+    /* a query after the cancelled ones passes all results */
+    {
+        auto handle = open_query(diag, select, 4);
+        std::size_t num_tuples = 0;
+        while (auto batch = handle->next_batch())
+            num_tuples += batch->num_tuples();
+        CHECK(num_tuples == 10);
+    }
+
+    C.default_backend(saved_default_backend);
+    Catalog::Clear();
+}
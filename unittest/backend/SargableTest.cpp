@@ -0,0 +1,262 @@
+#include "catch2/catch.hpp"
+
+#include "backend/Interpreter.hpp"
+#include "backend/Sargable.hpp"
+#include <limits>
+#include <mutable/catalog/Catalog.hpp>
+#include <mutable/catalog/Schema.hpp>
+#include <mutable/IR/CNF.hpp>
+#include <mutable/mutable.hpp>
+#include <mutable/storage/DataLayoutFactory.hpp>
+#include <mutable/storage/ZoneMap.hpp>
+#include <mutable/util/fn.hpp>
+#include <sstream>
+#include <string>
+
+
+using namespace m;
+
+
+namespace {
+
+/** Parses and analyzes the SQL statement \p sql, which must be a `SelectStmt`. */
+std::unique_ptr<ast::SelectStmt> select(const std::string &sql)
+{
+    std::ostringstream out, err;
+    Diagnostic diag(false, out, err);
+    auto stmt = as<ast::SelectStmt>(statement_from_string(diag, sql));
+    REQUIRE(diag.num_errors() == 0);
+    REQUIRE(stmt->where);
+    return stmt;
+}
+
+/** Returns the CNF of the WHERE clause of \p stmt. */
+cnf::CNF where_CNF(const ast::SelectStmt &stmt)
+{
+    return cnf::to_CNF(*as<const ast::WhereClause>(*stmt.where).where);
+}
+
+/** Executes the SQL statement \p sql and requires it to succeed. */
+void execute(const std::string &sql)
+{
+    std::ostringstream out, err;
+    Diagnostic diag(false, out, err);
+    auto stmt = statement_from_string(diag, sql);
+    execute_statement(diag, *stmt);
+    REQUIRE(diag.num_errors() == 0);
+}
+
+}
+
+
+TEST_CASE("sargable_comparison", "[core][backend][sargable]")
+{
+    Catalog::Clear();
+    Catalog &C = Catalog::Get();
+    auto &DB = C.add_database(C.pool("db"));
+    C.set_database_in_use(DB);
+    execute("CREATE TABLE t (k INT(4), l INT(8), f DOUBLE, d DATE);");
+    auto &table = DB.get_table(C.pool("t"));
+
+    /* Checks that the only predicate of the WHERE clause of \p SQL is the comparison `ATTR OP KEY`. */
+#define CHECK_SARGABLE(SQL, ATTR, OP, KEY) { \
+    auto stmt = select(SQL); \
+    auto cnf = where_CNF(*stmt); \
+    REQUIRE(cnf.size() == 1); \
+    REQUIRE(cnf[0].size() == 1); \
+    auto cmp = sargable_comparison(cnf[0][0]); \
+    REQUIRE(cmp); \
+    CHECK(&cmp->attr == &table.at(C.pool(ATTR))); \
+    CHECK(cmp->op == (OP)); \
+    CHECK(Interpreter::eval(cmp->constant).as_i() == (KEY)); \
+}
+
+    /* Checks that the only predicate of the WHERE clause of \p SQL is not sargable. */
+#define CHECK_NOT_SARGABLE(SQL) { \
+    auto stmt = select(SQL); \
+    auto cnf = where_CNF(*stmt); \
+    REQUIRE(cnf.size() == 1); \
+    REQUIRE(cnf[0].size() == 1); \
+    CHECK_FALSE(sargable_comparison(cnf[0][0])); \
+}
+
+    SECTION("attribute on the left-hand side")
+    {
+        CHECK_SARGABLE("SELECT * FROM t WHERE k = 42;",  "k", TK_EQUAL,         42);
+        CHECK_SARGABLE("SELECT * FROM t WHERE k < 42;",  "k", TK_LESS,          42);
+        CHECK_SARGABLE("SELECT * FROM t WHERE k <= 42;", "k", TK_LESS_EQUAL,    42);
+        CHECK_SARGABLE("SELECT * FROM t WHERE k > 42;",  "k", TK_GREATER,       42);
+        CHECK_SARGABLE("SELECT * FROM t WHERE l >= 42;", "l", TK_GREATER_EQUAL, 42);
+    }
+
+    SECTION("attribute on the right-hand side is mirrored")
+    {
+        CHECK_SARGABLE("SELECT * FROM t WHERE 42 = k;",  "k", TK_EQUAL,         42);
+        CHECK_SARGABLE("SELECT * FROM t WHERE 42 < k;",  "k", TK_GREATER,       42);
+        CHECK_SARGABLE("SELECT * FROM t WHERE 42 <= k;", "k", TK_GREATER_EQUAL, 42);
+        CHECK_SARGABLE("SELECT * FROM t WHERE 42 > k;",  "k", TK_LESS,          42);
+        CHECK_SARGABLE("SELECT * FROM t WHERE 42 >= k;", "k", TK_LESS_EQUAL,    42);
+    }
+
+    SECTION("negated comparisons are inverted")
+    {
+        CHECK_SARGABLE("SELECT * FROM t WHERE NOT k != 42;", "k", TK_EQUAL,         42);
+        CHECK_SARGABLE("SELECT * FROM t WHERE NOT k < 42;",  "k", TK_GREATER_EQUAL, 42);
+        CHECK_SARGABLE("SELECT * FROM t WHERE NOT k <= 42;", "k", TK_GREATER,       42);
+        CHECK_SARGABLE("SELECT * FROM t WHERE NOT k > 42;",  "k", TK_LESS_EQUAL,    42);
+        CHECK_SARGABLE("SELECT * FROM t WHERE NOT k >= 42;", "k", TK_LESS,          42);
+        CHECK_SARGABLE("SELECT * FROM t WHERE NOT 42 < k;",  "k", TK_LESS_EQUAL,    42);
+    }
+
+    SECTION("dates compare by their integral representation")
+    {
+        auto stmt = select("SELECT * FROM t WHERE d >= d'2020-01-01';");
+        auto cnf = where_CNF(*stmt);
+        auto cmp = sargable_comparison(cnf[0][0]);
+        REQUIRE(cmp);
+        CHECK(&cmp->attr == &table.at(C.pool("d")));
+        CHECK(cmp->op == TK_GREATER_EQUAL);
+    }
+
+    SECTION("not sargable")
+    {
+        CHECK_NOT_SARGABLE("SELECT * FROM t WHERE k != 42;");
+        CHECK_NOT_SARGABLE("SELECT * FROM t WHERE NOT k = 42;");
+        CHECK_NOT_SARGABLE("SELECT * FROM t WHERE k < l;");
+        CHECK_NOT_SARGABLE("SELECT * FROM t WHERE k + 1 < 42;");
+        CHECK_NOT_SARGABLE("SELECT * FROM t WHERE f < 42.5;");
+        CHECK_NOT_SARGABLE("SELECT * FROM t WHERE 13 < 42;");
+    }
+
+#undef CHECK_NOT_SARGABLE
+#undef CHECK_SARGABLE
+
+    Catalog::Clear();
+}
+
+TEST_CASE("restrict_range", "[core][backend][sargable]")
+{
+    constexpr int64_t MIN = std::numeric_limits<int64_t>::lowest();
+    constexpr int64_t MAX = std::numeric_limits<int64_t>::max();
+    int64_t lower = MIN, upper = MAX;
+
+    SECTION("each operator")
+    {
+        restrict_range(lower, upper, TK_GREATER_EQUAL, -5);
+        CHECK(lower == -5);
+        CHECK(upper == MAX);
+        restrict_range(lower, upper, TK_GREATER, -5);
+        CHECK(lower == -4);
+        restrict_range(lower, upper, TK_LESS_EQUAL, 10);
+        CHECK(upper == 10);
+        restrict_range(lower, upper, TK_LESS, 10);
+        CHECK(upper == 9);
+        restrict_range(lower, upper, TK_EQUAL, 3);
+        CHECK(lower == 3);
+        CHECK(upper == 3);
+    }
+
+    SECTION("looser bounds do not widen the range")
+    {
+        restrict_range(lower, upper, TK_GREATER_EQUAL, 0);
+        restrict_range(lower, upper, TK_LESS_EQUAL, 100);
+        restrict_range(lower, upper, TK_GREATER, -10);
+        restrict_range(lower, upper, TK_LESS, 1000);
+        CHECK(lower == 0);
+        CHECK(upper == 100);
+    }
+
+    SECTION("contradicting comparisons make the range empty")
+    {
+        restrict_range(lower, upper, TK_EQUAL, 3);
+        restrict_range(lower, upper, TK_EQUAL, 4);
+        CHECK(lower > upper);
+    }
+
+    SECTION("`< MIN` is empty")
+    {
+        restrict_range(lower, upper, TK_LESS, MIN);
+        CHECK(lower > upper);
+    }
+
+    SECTION("`> MAX` is empty")
+    {
+        restrict_range(lower, upper, TK_GREATER, MAX);
+        CHECK(lower > upper);
+    }
+
+    SECTION("`<= MIN` and `>= MAX` are not empty")
+    {
+        int64_t lower2 = MIN, upper2 = MAX;
+        restrict_range(lower, upper, TK_LESS_EQUAL, MIN);
+        CHECK(lower == MIN);
+        CHECK(upper == MIN);
+        restrict_range(lower2, upper2, TK_GREATER_EQUAL, MAX);
+        CHECK(lower2 == MAX);
+        CHECK(upper2 == MAX);
+    }
+}
+
+TEST_CASE("qualifying_zones", "[core][backend][sargable]")
+{
+    Catalog::Clear();
+    Catalog &C = Catalog::Get();
+    auto &DB = C.add_database(C.pool("db"));
+    C.set_database_in_use(DB);
+
+    /* Use a row layout, s.t. a zone has the minimal number of rows, and insert three zones where `n` is NULL in every
+     * row of the first zone. */
+    execute("CREATE TABLE t (k INT(4) NOT NULL, n INT(4), f DOUBLE);");
+    auto &table = DB.get_table(C.pool("t"));
+    table.layout(storage::RowLayoutFactory());
+    table.store(C.create_store(table));
+    constexpr int ZONE_SIZE = ZoneMap::MIN_ZONE_SIZE;
+    std::ostringstream sql;
+    sql << "INSERT INTO t VALUES ";
+    for (int i = 0; i != 3 * ZONE_SIZE; ++i) {
+        if (i != 0) sql << ", ";
+        sql << '(' << i << ", ";
+        if (i < ZONE_SIZE) sql << "NULL";
+        else               sql << i % 100;
+        sql << ", 0.5)";
+    }
+    sql << ';';
+    execute(sql.str());
+
+    SECTION("prunable filters")
+    {
+        {
+            auto stmt = select("SELECT * FROM t WHERE k >= 1500;");
+            auto cnf = where_CNF(*stmt);
+            REQUIRE(is_prunable_by_zone_map(cnf, table));
+            CHECK(qualifying_zones(cnf, table) == std::vector<bool>{ false, true, true });
+        }
+        {
+            auto stmt = select("SELECT * FROM t WHERE k < 1500 AND n = 42;");
+            auto cnf = where_CNF(*stmt);
+            REQUIRE(is_prunable_by_zone_map(cnf, table));
+            CHECK(qualifying_zones(cnf, table) == std::vector<bool>{ false, true, false });
+        }
+        {
+            /* clauses of multiple predicates are ignored */
+            auto stmt = select("SELECT * FROM t WHERE k > 5000 AND (k < 10 OR f < 1.0);");
+            auto cnf = where_CNF(*stmt);
+            REQUIRE(is_prunable_by_zone_map(cnf, table));
+            CHECK(qualifying_zones(cnf, table) == std::vector<bool>{ false, false, false });
+        }
+    }
+
+    SECTION("filters that are not prunable")
+    {
+        {
+            auto stmt = select("SELECT * FROM t WHERE f < 1.0;");
+            CHECK_FALSE(is_prunable_by_zone_map(where_CNF(*stmt), table));
+        }
+        {
+            auto stmt = select("SELECT * FROM t WHERE k < 10 OR n = 42;");
+            CHECK_FALSE(is_prunable_by_zone_map(where_CNF(*stmt), table));
+        }
+    }
+
+    Catalog::Clear();
+}
@@ -537,6 +537,75 @@ TEST_CASE("StackMachine/emit_St_Tup/emit_St_Tup_Null", "[core][backend]")
     REQUIRE(res.is_null(0));
 }
 
+TEST_CASE("StackMachine/NULL operands", "[core][backend]")
+{
+    StackMachine SM;
+    Tuple res({ Type::Get_Boolean(Type::TY_Scalar) });
+    Tuple *args[] = { &res };
+
+    SECTION("Comparison with NULL is NULL")
+    {
+        SM.emit_Push_Null();
+        SM.add_and_emit_load(int64_t(42));
+        SM.emit_Eq_i();
+        SM.emit_St_Tup_b(0, 0);
+        SM(args);
+        REQUIRE(res.is_null(0));
+    }
+
+    SECTION("String comparison with NULL is NULL")
+    {
+        char str[] = "abc";
+        SM.add_and_emit_load(str);
+        SM.emit_Push_Null();
+        SM.emit_Eq_s();
+        SM.emit_St_Tup_b(0, 0);
+        SM(args);
+        REQUIRE(res.is_null(0));
+    }
+
+    SECTION("Negation of NULL is NULL")
+    {
+        SM.emit_Push_Null();
+        SM.emit_Not_b();
+        SM.emit_St_Tup_b(0, 0);
+        SM(args);
+        REQUIRE(res.is_null(0));
+    }
+
+    SECTION("NULL AND FALSE is FALSE")
+    {
+        SM.emit_Push_Null();
+        SM.add_and_emit_load(false);
+        SM.emit_And_b();
+        SM.emit_St_Tup_b(0, 0);
+        SM(args);
+        REQUIRE(not res.is_null(0));
+        REQUIRE(not res[0].as_b());
+    }
+
+    SECTION("NULL OR TRUE is TRUE")
+    {
+        SM.add_and_emit_load(true);
+        SM.emit_Push_Null();
+        SM.emit_Or_b();
+        SM.emit_St_Tup_b(0, 0);
+        SM(args);
+        REQUIRE(not res.is_null(0));
+        REQUIRE(res[0].as_b());
+    }
+
+    SECTION("NULL OR FALSE is NULL")
+    {
+        SM.emit_Push_Null();
+        SM.add_and_emit_load(false);
+        SM.emit_Or_b();
+        SM.emit_St_Tup_b(0, 0);
+        SM(args);
+        REQUIRE(res.is_null(0));
+    }
+}
+
 TEST_CASE("StackMachine/emit_Print", "[core][backend]")
 {
     StackMachine SM;
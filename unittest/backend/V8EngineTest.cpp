@@ -0,0 +1,201 @@
+#include "catch2/catch.hpp"
+
+#include "backend/PhysicalOperator.hpp"
+#include "backend/WasmOperator.hpp"
+#include "backend/WasmUtil.hpp"
+#include <algorithm>
+#include <mutable/catalog/Catalog.hpp>
+#include <mutable/IR/Operator.hpp>
+#include <mutable/IR/Optimizer.hpp>
+#include <mutable/IR/QueryGraph.hpp>
+#include <mutable/IR/Tuple.hpp>
+#include <mutable/mutable.hpp>
+#include <mutable/util/Timer.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+using namespace m;
+
+
+namespace {
+
+/** Executes the SQL statement \p sql and requires it to succeed. */
+void execute(const std::string &sql)
+{
+    std::ostringstream out, err;
+    Diagnostic diag(false, out, err);
+    auto stmt = statement_from_string(diag, sql);
+    REQUIRE(stmt);
+    execute_statement(diag, *stmt);
+    REQUIRE(diag.num_errors() == 0);
+    REQUIRE(err.str().empty());
+}
+
+/** Returns `true` iff the `Timer` of the `Catalog` holds a finished measurement named \p name. */
+bool has_measurement(const char *name)
+{
+    auto &T = Catalog::Get().timer();
+    return std::any_of(T.begin(), T.end(), [name](const Timer::Measurement &M) {
+        return M.name == name and M.is_finished();
+    });
+}
+
+/** Appends \p num_rows rows to the table named \p name without writing any values.  Only meant for queries which are
+ * planned but not executed. */
+void append_rows(const char *name, std::size_t num_rows)
+{
+    Catalog &C = Catalog::Get();
+    auto &table = C.get_database_in_use().get_table(C.pool(name));
+    for (std::size_t i = 0; i != num_rows; ++i)
+        table.store().append();
+}
+
+/** Returns the physical plan the WasmV8 backend chooses for the query \p sql, without executing it. */
+std::string physical_plan(const char *sql)
+{
+    Catalog &C = Catalog::Get();
+    std::ostringstream out, err;
+    Diagnostic diag(false, out, err);
+    auto stmt = statement_from_string(diag, sql);
+    REQUIRE(stmt);
+    auto query_graph = QueryGraph::Build(*stmt);
+    Optimizer Opt(C.plan_enumerator(), C.cost_function());
+    auto callback = std::make_unique<CallbackOperator>([](const Schema&, const Tuple&) { });
+    callback->add_child(Opt(*query_graph).release());
+
+    PhysicalOptimizer phys_opt;
+#define REGISTER(CLASS) phys_opt.register_operator<wasm::CLASS>();
+    M_WASM_OPERATOR_LIST(REGISTER)
+#undef REGISTER
+
+    wasm::Module::Init();
+    wasm::CodeGenContext::Init();
+    phys_opt.cover(*callback);
+    std::ostringstream plan;
+    phys_opt.dump_plan(*callback, plan);
+    wasm::CodeGenContext::Dispose();
+    wasm::Module::Dispose();
+    return plan.str();
+}
+
+/** Returns `true` iff \p plan contains the physical operator named \p op. */
+bool contains_operator(const std::string &plan, const char *op) { return plan.find(op) != std::string::npos; }
+
+}
+
+
+TEST_CASE("V8Engine/compilation cache", "[core][wasm][v8]")
+{
+    Catalog::Clear();
+    Catalog &C = Catalog::Get();
+    auto &DB = C.add_database(C.pool("db"));
+    C.set_database_in_use(DB);
+
+    execute("CREATE TABLE t (k INT(4) NOT NULL);");
+    execute("INSERT INTO t VALUES (4), (8), (1), (6), (3);");
+
+    const char *argv[] = { "unittest", "--wasm-compilation-cache", nullptr };
+    C.arg_parser().parse_args(2, argv);
+
+    /* The cache belongs to the backend, hence all queries must be executed by the same backend. */
+    auto backend = C.create_backend("WasmV8");
+
+    /* Executes the query \p sql and returns the values of its single column. */
+    auto run = [&](const char *sql) {
+        std::ostringstream out, err;
+        Diagnostic diag(false, out, err);
+        auto stmt = statement_from_string(diag, sql);
+        REQUIRE(stmt);
+        auto query_graph = QueryGraph::Build(*stmt);
+        Optimizer Opt(C.plan_enumerator(), C.cost_function());
+
+        std::vector<int64_t> values;
+        auto callback = std::make_unique<CallbackOperator>([&](const Schema&, const Tuple &tup) {
+            values.push_back(tup[0].as_i());
+        });
+        callback->add_child(Opt(*query_graph).release());
+
+        C.timer().clear();
+        backend->execute(*callback);
+        std::sort(values.begin(), values.end());
+        return values;
+    };
+
+    /* the first execution compiles the plan */
+    CHECK(run("SELECT k FROM t WHERE k < 5;") == std::vector<int64_t>{ 1, 3, 4 });
+    CHECK(has_measurement("Compile to WebAssembly"));
+    CHECK_FALSE(has_measurement("Reuse cached Wasm module"));
+
+    /* a query with an equal plan reuses the compiled module */
+    CHECK(run("SELECT k FROM t WHERE k < 5;") == std::vector<int64_t>{ 1, 3, 4 });
+    CHECK(has_measurement("Reuse cached Wasm module"));
+    CHECK_FALSE(has_measurement("Compile to WebAssembly"));
+
+    /* a query with a different constant must not reuse the compiled module */
+    CHECK(run("SELECT k FROM t WHERE k < 7;") == std::vector<int64_t>{ 1, 3, 4, 6 });
+    CHECK(has_measurement("Compile to WebAssembly"));
+    CHECK_FALSE(has_measurement("Reuse cached Wasm module"));
+
+    /* a reused module must read the current rows of the table */
+    execute("INSERT INTO t VALUES (2), (9);");
+    CHECK(run("SELECT k FROM t WHERE k < 5;") == std::vector<int64_t>{ 1, 2, 3, 4 });
+
+    Catalog::Clear();
+}
+
+TEST_CASE("V8Engine/physical operator selection", "[core][wasm][v8]")
+{
+    Catalog::Clear();
+    Catalog &C = Catalog::Get();
+    auto &DB = C.add_database(C.pool("db"));
+    C.set_database_in_use(DB);
+
+    SECTION("hash joins")
+    {
+        execute("CREATE TABLE small_r (k INT(4) NOT NULL, v INT(4) NOT NULL);");
+        execute("CREATE TABLE small_s (k INT(4) NOT NULL, v INT(4) NOT NULL);");
+        execute("CREATE TABLE large_r (k INT(4) NOT NULL, v INT(4) NOT NULL);");
+        execute("CREATE TABLE large_s (k INT(4) NOT NULL, v INT(4) NOT NULL);");
+        append_rows("small_r", 100);
+        append_rows("small_s", 100);
+        append_rows("large_r", 200000);
+        append_rows("large_s", 200000);
+
+        /* the hash table of a small build side fits into the cache, hence partitioning does not pay off */
+        auto plan = physical_plan("SELECT small_r.v, small_s.v FROM small_r, small_s WHERE small_r.k = small_s.k;");
+        CHECK(contains_operator(plan, "wasm::SimpleHashJoin"));
+        CHECK_FALSE(contains_operator(plan, "wasm::RadixPartitionedHashJoin"));
+
+        /* the hash table of a large build side exceeds the cache, hence partitioning pays off */
+        plan = physical_plan("SELECT large_r.v, large_s.v FROM large_r, large_s WHERE large_r.k = large_s.k;");
+        CHECK(contains_operator(plan, "wasm::RadixPartitionedHashJoin"));
+        CHECK_FALSE(contains_operator(plan, "wasm::SimpleHashJoin"));
+    }
+
+    SECTION("groupings")
+    {
+        execute("CREATE TABLE dense (k INT(4) NOT NULL, n INT(4), v INT(4) NOT NULL);");
+        execute("CREATE TABLE sparse (k INT(4) NOT NULL, v INT(4) NOT NULL);");
+        execute("INSERT INTO dense VALUES (-2, 1, 1), (3, NULL, 2), (-2, 3, 3), (0, 1, 4);");
+        execute("INSERT INTO sparse VALUES (0, 1), (100000000, 2);");
+
+        /* a non-NULL key of small domain is directly addressed */
+        auto plan = physical_plan("SELECT k, SUM(v) FROM dense GROUP BY k;");
+        CHECK(contains_operator(plan, "wasm::IdentityHashGrouping"));
+        CHECK_FALSE(contains_operator(plan, "wasm::HashBasedGrouping"));
+
+        /* a key of large domain would require a too large array */
+        plan = physical_plan("SELECT k, SUM(v) FROM sparse GROUP BY k;");
+        CHECK(contains_operator(plan, "wasm::HashBasedGrouping"));
+        CHECK_FALSE(contains_operator(plan, "wasm::IdentityHashGrouping"));
+
+        /* a nullable key has no slot for NULL */
+        plan = physical_plan("SELECT n, SUM(v) FROM dense GROUP BY n;");
+        CHECK(contains_operator(plan, "wasm::HashBasedGrouping"));
+        CHECK_FALSE(contains_operator(plan, "wasm::IdentityHashGrouping"));
+    }
+
+    Catalog::Clear();
+}
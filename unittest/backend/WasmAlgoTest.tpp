@@ -0,0 +1,115 @@
+/* vim: set filetype=cpp: */
+#include "backend/WasmAlgo.hpp"
+
+#ifndef BACKEND_NAME
+#error "must define BACKEND_NAME before including this file"
+#endif
+
+using namespace m::wasm;
+
+
+TEST_CASE("Wasm/" BACKEND_NAME "/open addressing hash table with control bytes", "[core][wasm]")
+{
+    Module::Init();
+    CodeGenContext::Init();
+
+    /* A hash table mapping an INT(4) key to an INT(8) value.  Its initial capacity is far too small for the inserted
+     * keys, s.t. inserting them rehashes the table several times. */
+    const m::Schema::Identifier k("k"), v("v");
+    m::Schema ht_schema;
+    ht_schema.add(k, m::Type::Get_Integer(m::Type::TY_Vector, 4), m::Schema::entry_type::NOT_NULLABLE);
+    ht_schema.add(v, m::Type::Get_Integer(m::Type::TY_Vector, 8), m::Schema::entry_type::NOT_NULLABLE);
+    constexpr int32_t NUM_KEYS = 100;
+
+    /* Inserts the keys 0, ..., NUM_KEYS - 1 with the value 2 * key twice, where the second insertion must find the
+     * key inserted first. */
+    auto insert_keys = [&](LocalOpenAddressingInPlaceHashTable &ht) {
+        for (int32_t round = 0; round != 2; ++round) {
+            Var<I32x1> i(0);
+            WHILE (i < NUM_KEYS) {
+                std::vector<SQL_t> key;
+                key.emplace_back(_I32x1(i));
+                auto [entry, inserted] = ht.try_emplace(std::move(key));
+                if (round == 0) {
+                    WASM_CHECK(std::move(inserted), "key must be inserted");
+                    entry.extract<_I64x1>(v) = _I64x1(i.to<int64_t>() * 2L);
+                } else {
+                    WASM_CHECK(not std::move(inserted), "key must already exist");
+                }
+                i += 1;
+            }
+        }
+    };
+
+    SECTION("rehashing keeps all entries")
+    {
+        CHECK_RESULT_INLINE(int64_t(NUM_KEYS * (NUM_KEYS - 1)), int64_t(void), {
+            LocalOpenAddressingInPlaceHashTable ht(ht_schema, { 0 }, 4);
+            ht.set_control_bytes();
+            ht.setup();
+            ht.set_high_watermark(0.7);
+            insert_keys(ht);
+
+            Var<I64x1> sum(0);
+            Var<I32x1> i(0);
+            WHILE (i < NUM_KEYS) {
+                std::vector<SQL_t> key;
+                key.emplace_back(_I32x1(i));
+                auto [entry, found] = ht.find(std::move(key));
+                WASM_CHECK(std::move(found), "key must be found after rehashing");
+                sum += _I64x1(entry.get<_I64x1>(v)).insist_not_null();
+                i += 1;
+            }
+
+            std::vector<SQL_t> missing;
+            missing.emplace_back(_I32x1(NUM_KEYS));
+            WASM_CHECK(not ht.find(std::move(missing)).second, "key must not be found");
+
+            ht.teardown();
+            RETURN(sum);
+        });
+    }
+
+    SECTION("predicated lookups")
+    {
+        /* Look up every key under predication, where only the keys that are a multiple of 3 fulfill the predicate.
+         * Thus, exactly these keys must be found and all others must not. */
+        CHECK_RESULT_INLINE(int64_t(34), int64_t(void), {
+            LocalOpenAddressingInPlaceHashTable ht(ht_schema, { 0 }, 4);
+            ht.set_control_bytes();
+            ht.setup();
+            ht.set_high_watermark(0.7);
+            insert_keys(ht);
+
+            Var<I64x1> num_found(0);
+            Var<I64x1> num_matches(0);
+            Var<I32x1> i(0);
+            WHILE (i < NUM_KEYS) {
+                {
+                    auto S = CodeGenContext::Get().scoped_environment();
+                    CodeGenContext::Get().env().add_predicate(_Boolx1(i % 3 == 0));
+                    std::vector<SQL_t> key;
+                    key.emplace_back(_I32x1(i));
+                    num_found += ht.find(std::move(key)).second.to<int64_t>();
+                }
+                {
+                    auto S = CodeGenContext::Get().scoped_environment();
+                    CodeGenContext::Get().env().add_predicate(_Boolx1(i % 3 == 0));
+                    std::vector<SQL_t> key;
+                    key.emplace_back(_I32x1(i));
+                    ht.for_each_in_equal_range(std::move(key), [&](HashTable::const_entry_t){
+                        num_matches += 1L;
+                    });
+                }
+                i += 1;
+            }
+            WASM_CHECK(num_found == num_matches, "find and for_each_in_equal_range must agree");
+
+            ht.teardown();
+            RETURN(num_found);
+        });
+    }
+
+    CodeGenContext::Dispose();
+    Module::Dispose();
+}
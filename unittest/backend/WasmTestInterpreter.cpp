@@ -127,6 +127,7 @@ struct invoke_interpreter<void(PrimitiveExpr<ParamTypes, ParamLs>...)>
 
 #define BACKEND_NAME "Interpreter"
 
+#include "WasmAlgoTest.tpp"
 #include "WasmDSLTest.tpp"
 #include "WasmOperatorTest.tpp"
 #include "WasmUtilTest.tpp"
@@ -248,6 +248,7 @@ struct invoke_v8<void(PrimitiveExpr<ParamTypes, ParamLs>...)>
 
 #define BACKEND_NAME "V8"
 
+#include "WasmAlgoTest.tpp"
 #include "WasmDSLTest.tpp"
 #include "WasmOperatorTest.tpp"
 #include "WasmUtilTest.tpp"
@@ -624,3 +624,59 @@ TEMPLATE_TEST_CASE("Wasm/" BACKEND_NAME "/Decimal", "[core][wasm]",
 #undef I
     Module::Dispose();
 }
+
+TEST_CASE("Wasm/" BACKEND_NAME "/predicated SIMD lanes", "[core][wasm]")
+{
+    Module::Init();
+    CodeGenContext::Init();
+
+    /* Emulate a SIMDfied scan of INT(2), INT(4), and INT(8) attributes followed by a predicated filter.  Lane i holds
+     * the values i, 10 * i, and 100 * i.  The lanes 0, 3, 6, 9, 12, and 15 fulfill the filter but lane 15 is NULL. */
+    const m::Schema::Identifier i16("i16"), i32("i32"), i64("i64");
+    auto add_batch = [&](Environment &env) {
+        env.add(i16, _I16x16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+        env.add(i32, _I32x16(0, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120, 130, 140, 150));
+        env.add(i64, _I64x16(0, 100, 200, 300, 400, 500, 600, 700, 800, 900, 1000, 1100, 1200, 1300, 1400, 1500));
+        env.add_predicate(_Boolx16(
+            Boolx16(true, false, false, true, false, false, true, false, false, true, false, false, true, false, false, true),
+            Boolx16(false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, true)
+        ));
+    };
+
+    SECTION("num_qualifying_tuples")
+    {
+        CHECK_RESULT_INLINE(5U, uint32_t(void), {
+            auto S = CodeGenContext::Get().scoped_environment();
+            CodeGenContext::Get().set_num_simd_lanes(16);
+            add_batch(CodeGenContext::Get().env());
+            U32x1 num_tuples = num_qualifying_tuples(CodeGenContext::Get().env().extract_predicate());
+            CodeGenContext::Get().set_num_simd_lanes(1);
+            RETURN(num_tuples);
+        });
+    }
+
+    SECTION("execute_per_lane")
+    {
+        CHECK_RESULT_INLINE(3330, int64_t(void), {
+            auto S = CodeGenContext::Get().scoped_environment();
+            CodeGenContext::Get().set_num_simd_lanes(16);
+            add_batch(CodeGenContext::Get().env());
+            Var<I64x1> sum(0);
+            execute_per_lane([&](){
+                CHECK(CodeGenContext::Get().num_simd_lanes() == 1);
+                auto &env = CodeGenContext::Get().env();
+                IF (env.extract_predicate<_Boolx1>().is_true_and_not_null()) {
+                    sum += env.get<_I16x1>(i16).insist_not_null().to<int64_t>() +
+                           env.get<_I32x1>(i32).insist_not_null().to<int64_t>() +
+                           env.get<_I64x1>(i64).insist_not_null();
+                };
+            });
+            CHECK(CodeGenContext::Get().num_simd_lanes() == 16);
+            CodeGenContext::Get().set_num_simd_lanes(1);
+            RETURN(sum);
+        });
+    }
+
+    CodeGenContext::Dispose();
+    Module::Dispose();
+}
@@ -46,6 +46,7 @@ TEST_CASE("Lexer::next()", "[core][lex][unit]")
             { ">=", TK_GREATER_EQUAL, ">=", TK_EOF },
             { ",", TK_COMMA, ",", TK_EOF },
             { ";", TK_SEMICOL, ";", TK_EOF },
+            { "?", TK_QMARK, "?", TK_EOF },
             { ".", TK_DOT, ".", TK_EOF },
             { "..", TK_DOTDOT, "..", TK_EOF },
 
@@ -167,7 +168,7 @@ TEST_CASE("Lexer::next()", "[core][lex][unit]")
         SECTION("invalid characters")
         {
             const char *chars[] = {
-                ":", "!", "§", "$", "&", "{", "}", "[", "]", "?", "#", "|", "ä", "ö", "ü", "Ä", "Ö", "Ü",
+                ":", "!", "§", "$", "&", "{", "}", "[", "]", "#", "|", "ä", "ö", "ü", "Ä", "Ö", "Ü",
                 "\u0080", "\u00FF", "\u00BF", "\u00C0", "\u0001", "\u0006", "\u0007", "\u007F"
             };
 
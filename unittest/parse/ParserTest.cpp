@@ -243,6 +243,7 @@ TEST_CASE("Parser::parse_Expr()", "[core][parse][unit]")
             { "0xA.", "0xA.", TK_EOF },
             { "d'2021-01-29'", "d'2021-01-29'", TK_EOF },
             { "d'2021-01-29 12:17:49'", "d'2021-01-29 12:17:49'", TK_EOF },
+            { "?", "?1", TK_EOF },
         };
 
         for (auto triple : triples)
@@ -281,7 +282,13 @@ TEST_CASE("Parser::parse_Expr()", "[core][parse][unit]")
             /* logical NOT expression */
             { "NOT a", "(NOT a)", TK_EOF },
             { "NOT NOT a", "(NOT (NOT a))", TK_EOF },
-            { "NOT NOT a=b", "(NOT (NOT (a = b)))", TK_EOF }
+            { "NOT NOT a=b", "(NOT (NOT (a = b)))", TK_EOF },
+            /* EXISTS and NOT IN */
+            { "EXISTS (SELECT a FROM t)", "(EXISTS (SELECT a\nFROM t;))", TK_EOF },
+            { "NOT EXISTS (SELECT a FROM t WHERE a = b)", "(NOT (EXISTS (SELECT a\nFROM t\nWHERE (a = b);)))", TK_EOF },
+            { "a NOT IN (SELECT b FROM t)", "(NOT (a IN (SELECT b\nFROM t;)))", TK_EOF },
+            { "NOT a IN (SELECT b FROM t)", "(NOT (a IN (SELECT b\nFROM t;)))", TK_EOF },
+            { "a + 1 NOT IN (SELECT b FROM t)", "(NOT ((a + 1) IN (SELECT b\nFROM t;)))", TK_EOF },
         };
 
         for (auto triple : triples)
@@ -325,7 +332,16 @@ TEST_CASE("Parser::parse_Expr()", "[core][parse][unit]")
             { "a OR b", "(a OR b)", TK_EOF },
             { "a OR b OR c", "((a OR b) OR c)", TK_EOF },
             { "a OR (b OR c)", "(a OR (b OR c))", TK_EOF },
-            { "a AND b OR c AND d OR e AND f", "(((a AND b) OR (c AND d)) OR (e AND f))", TK_EOF }
+            { "a AND b OR c AND d OR e AND f", "(((a AND b) OR (c AND d)) OR (e AND f))", TK_EOF },
+            /* IN expression */
+            { "a IN (SELECT b FROM t)", "(a IN (SELECT b\nFROM t;))", TK_EOF },
+            { "a + 1 IN (SELECT b FROM t)", "((a + 1) IN (SELECT b\nFROM t;))", TK_EOF },
+            { "a IN (SELECT b FROM t) AND c", "((a IN (SELECT b\nFROM t;)) AND c)", TK_EOF },
+            { "a IN (SELECT b FROM t) AND EXISTS (SELECT c FROM s)",
+              "((a IN (SELECT b\nFROM t;)) AND (EXISTS (SELECT c\nFROM s;)))", TK_EOF },
+            { "a = b IN (SELECT c FROM t)", "((a = b) IN (SELECT c\nFROM t;))", TK_EOF },
+            /* placeholders */
+            { "a = ? AND b < ?", "((a = ?1) AND (b < ?2))", TK_EOF }
         };
 
         for (auto triple : triples)
@@ -350,6 +366,8 @@ TEST_CASE("Parser::parse_Expr() sanity tests", "[core][parse][unit]")
         "=", "a=", "a=(", "a==b", "a!", "a=<b",
         /* logical NOT expression */
         "NOT", "NOT NOT", "NOT NOT (", "NOT +",
+        /* EXISTS and IN expression */
+        "EXISTS", "EXISTS a", "EXISTS (", "EXISTS (SELECT a FROM t", "a IN", "a NOT", "a NOT b", "a NOT IN",
         /* logical AND expression */
         "AND", "a AND", "AND a", "a AND AND b",
         /* logical OR expression */
@@ -1181,6 +1199,50 @@ TEST_CASE("Parser::parse_CreateTableStmt() sanity tests", "[core][parse][unit]")
     }
 }
 
+TEST_CASE("Parser::parse_CreateIndexStmt()", "[core][parse][unit]")
+{
+    test_triple_t triples[] = {
+        /* { create index statement, fully-parenthesized create index statement, next token } */
+
+        { "INDEX i ON t ( a )", "CREATE INDEX i ON t (a);", TK_EOF },
+        { "INDEX i ON t ( a ) ;", "CREATE INDEX i ON t (a);", TK_SEMICOL },
+    };
+
+    auto parse = [](ast::Parser &p) { return p.parse_CreateIndexStmt(); };
+    for (auto triple : triples)
+        test_parse_positive<ast::CreateIndexStmt, ast::Stmt>(triple, parse);
+}
+
+TEST_CASE("Parser::parse_CreateIndexStmt() sanity tests", "[core][parse][unit]")
+{
+    const char * statements[] = {
+        "",
+        "CREATE INDEX i ON t ( a )",
+        "TABLE i ON t ( a )",
+        "INDEX ON t ( a )",
+        "INDEX 0 ON t ( a )",
+        "INDEX i t ( a )",
+        "INDEX i ON ( a )",
+        "INDEX i ON t a )",
+        "INDEX i ON t ( )",
+        "INDEX i ON t ( a, b )",
+        "INDEX i ON t ( a "
+    };
+
+    for (auto s : statements) {
+        LEXER(s);
+        ast::Parser parser(lexer);
+        auto ast = parser.parse_CreateIndexStmt();
+        if (diag.num_errors() == 0)
+            std::cerr << "UNEXPECTED PASS for input \"" << s << '"' << std::endl;
+        CHECK(diag.num_errors() > 0);
+        CHECK_FALSE(err.str().empty());
+        if (not is<ast::ErrorStmt>(ast))
+            std::cerr << "Input \"" << s << "\" is not parsed as ErrorStmt" << std::endl;
+        CHECK(is<ast::ErrorStmt>(ast));
+    }
+}
+
 TEST_CASE("Parser::parse_InsertStmt()", "[core][parse][unit]")
 {
     test_triple_t triples[] = {
@@ -1487,6 +1549,11 @@ TEST_CASE("Parser::parse_Stmt()", "[core][parse][unit]")
         test_parse_positive<CreateTableStmt, Stmt>(triple, parse);
     }
 
+    {
+        test_triple_t triple = { "CREATE INDEX i ON A ( key );", "CREATE INDEX i ON A (key);", TK_EOF };
+        test_parse_positive<CreateIndexStmt, Stmt>(triple, parse);
+    }
+
     {
         test_triple_t triple = { "SELECT * FROM A;", "SELECT *\nFROM A;", TK_EOF };
         test_parse_positive<SelectStmt, Stmt>(triple, parse);
@@ -1521,6 +1588,7 @@ TEST_CASE("Parser::parse_Stmt() sanity tests", "[core][parse][unit]")
             "CREATE DATABASE d",
             "USE d", "USE d",
             "CREATE TABLE A ( key INT(32) )",
+            "CREATE INDEX i ON A ( key )",
             "SELECT * FROM A",
             "INSERT INTO A VALUES (42)",
             "UPDATE A SET key = 17",
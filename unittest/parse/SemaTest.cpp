@@ -1571,6 +1571,97 @@ TEST_CASE("Sema/Clauses/Where", "[core][parse][sema]")
 
 }
 
+TEST_CASE("Sema/Expressions/Placeholders", "[core][parse][sema]")
+{
+    Catalog::Clear();
+
+    /* Create a dummy DB and a dummy table. */
+    Catalog &C = Catalog::Get();
+    const char *db_name = "mydb";
+    auto &DB = C.add_database(db_name);
+    C.set_database_in_use(DB);
+    auto &table = DB.add_table(C.pool("mytable"));
+    table.push_back(C.pool("i"), Type::Get_Integer(Type::TY_Vector, 8));
+    table.push_back(C.pool("d"), Type::Get_Double(Type::TY_Vector));
+    table.push_back(C.pool("s"), Type::Get_Char(Type::TY_Vector, 42));
+
+    SECTION("Placeholders adopt the scalar type of the other operand.")
+    {
+        LEXER("SELECT * FROM mytable WHERE i = ? AND ? < d + 1;");
+        Parser parser(lexer);
+        auto stmt = as<SelectStmt>(parser.parse());
+        REQUIRE(diag.num_errors() == 0);
+        REQUIRE(err.str().empty());
+        Sema sema(diag);
+        sema(*stmt);
+
+        REQUIRE(diag.num_errors() == 0);
+        REQUIRE(err.str().empty());
+
+        auto types = sema.placeholder_types();
+        REQUIRE(types.size() == 2);
+        CHECK(types[0] == Type::Get_Integer(Type::TY_Scalar, 8));
+        CHECK(types[1] == Type::Get_Double(Type::TY_Scalar));
+    }
+
+    SECTION("Placeholder without other operand.")
+    {
+        LEXER("SELECT ? FROM mytable;");
+        Parser parser(lexer);
+        auto stmt = as<SelectStmt>(parser.parse());
+        REQUIRE(diag.num_errors() == 0);
+        REQUIRE(err.str().empty());
+        Sema sema(diag);
+        sema(*stmt);
+
+        REQUIRE(diag.num_errors() > 0);
+        REQUIRE(not err.str().empty());
+    }
+
+    SECTION("Placeholders as both operands.")
+    {
+        LEXER("SELECT * FROM mytable WHERE ? = ?;");
+        Parser parser(lexer);
+        auto stmt = as<SelectStmt>(parser.parse());
+        REQUIRE(diag.num_errors() == 0);
+        REQUIRE(err.str().empty());
+        Sema sema(diag);
+        sema(*stmt);
+
+        REQUIRE(diag.num_errors() > 0);
+        REQUIRE(not err.str().empty());
+    }
+
+    SECTION("Placeholder of string type.")
+    {
+        LEXER("SELECT * FROM mytable WHERE s = ?;");
+        Parser parser(lexer);
+        auto stmt = as<SelectStmt>(parser.parse());
+        REQUIRE(diag.num_errors() == 0);
+        REQUIRE(err.str().empty());
+        Sema sema(diag);
+        sema(*stmt);
+
+        REQUIRE(diag.num_errors() == 1);
+        REQUIRE(not err.str().empty());
+    }
+
+    SECTION("Placeholders are rejected outside of prepared statements.")
+    {
+        LEXER("SELECT * FROM mytable WHERE i = ?;");
+        Parser parser(lexer);
+        auto stmt = parser.parse();
+        REQUIRE(diag.num_errors() == 0);
+        REQUIRE(err.str().empty());
+        Sema sema(diag);
+        auto cmd = sema.analyze(std::move(stmt));
+
+        CHECK_FALSE(cmd);
+        REQUIRE(diag.num_errors() == 1);
+        REQUIRE(not err.str().empty());
+    }
+}
+
 TEST_CASE("Sema/Clauses/GroupBy", "[core][parse][sema]")
 {
     Catalog::Clear();
@@ -2236,6 +2327,113 @@ TEST_CASE("Sema/Statements/CreateTable", "[core][parse][sema]")
     }
 }
 
+TEST_CASE("Sema/Statements/CreateIndex", "[core][parse][sema]")
+{
+    Catalog::Clear();
+
+    /* Create a dummy DB and a dummy table with an integral and a floating-point attribute. */
+    Catalog &C = Catalog::Get();
+    const char *db_name = "mydb";
+    auto &DB = C.add_database(db_name);
+    auto &table = DB.add_table(C.pool("mytable"));
+    table.push_back(C.pool("k"), Type::Get_Integer(Type::TY_Vector, 4));
+    table.push_back(C.pool("f"), Type::Get_Double(Type::TY_Vector));
+
+    SECTION("Create index without database selected")
+    {
+        LEXER("CREATE INDEX my_index ON mytable (k);");
+        Parser parser(lexer);
+        auto stmt = as<CreateIndexStmt>(parser.parse());
+        REQUIRE(diag.num_errors() == 0);
+        REQUIRE(err.str().empty());
+        Sema sema(diag);
+        sema(*stmt);
+
+        REQUIRE(diag.num_errors() == 1);
+        REQUIRE(not err.str().empty());
+    }
+
+    SECTION("With database selected")
+    {
+        C.set_database_in_use(DB);
+
+        SECTION("Create index statement which is ok")
+        {
+            LEXER("CREATE INDEX my_index ON mytable (k);");
+            Parser parser(lexer);
+            auto stmt = as<CreateIndexStmt>(parser.parse());
+            REQUIRE(diag.num_errors() == 0);
+            REQUIRE(err.str().empty());
+            Sema sema(diag);
+            sema(*stmt);
+
+            REQUIRE(diag.num_errors() == 0);
+            REQUIRE(err.str().empty());
+        }
+
+        SECTION("Create index on a table which does not exist")
+        {
+            LEXER("CREATE INDEX my_index ON other_table (k);");
+            Parser parser(lexer);
+            auto stmt = as<CreateIndexStmt>(parser.parse());
+            REQUIRE(diag.num_errors() == 0);
+            REQUIRE(err.str().empty());
+            Sema sema(diag);
+            sema(*stmt);
+
+            REQUIRE(diag.num_errors() == 1);
+            REQUIRE(not err.str().empty());
+        }
+
+        SECTION("Create index on an attribute which does not exist")
+        {
+            LEXER("CREATE INDEX my_index ON mytable (x);");
+            Parser parser(lexer);
+            auto stmt = as<CreateIndexStmt>(parser.parse());
+            REQUIRE(diag.num_errors() == 0);
+            REQUIRE(err.str().empty());
+            Sema sema(diag);
+            sema(*stmt);
+
+            REQUIRE(diag.num_errors() == 1);
+            REQUIRE(not err.str().empty());
+        }
+
+        SECTION("Create index on a non-integral attribute")
+        {
+            LEXER("CREATE INDEX my_index ON mytable (f);");
+            Parser parser(lexer);
+            auto stmt = as<CreateIndexStmt>(parser.parse());
+            REQUIRE(diag.num_errors() == 0);
+            REQUIRE(err.str().empty());
+            Sema sema(diag);
+            sema(*stmt);
+
+            REQUIRE(diag.num_errors() == 1);
+            REQUIRE(not err.str().empty());
+        }
+
+        SECTION("Create index with a name which already exists")
+        {
+            /* Adding an index builds it from the table's store. */
+            table.layout(C.data_layout());
+            table.store(C.create_store(table));
+            DB.add_index(C.pool("my_index"), table.at(C.pool("k")));
+
+            LEXER("CREATE INDEX my_index ON mytable (k);");
+            Parser parser(lexer);
+            auto stmt = as<CreateIndexStmt>(parser.parse());
+            REQUIRE(diag.num_errors() == 0);
+            REQUIRE(err.str().empty());
+            Sema sema(diag);
+            sema(*stmt);
+
+            REQUIRE(diag.num_errors() == 1);
+            REQUIRE(not err.str().empty());
+        }
+    }
+}
+
 TEST_CASE("Sema/Statements/Select", "[core][parse][sema]")
 {
     Catalog::Clear();
@@ -2696,6 +2894,68 @@ TEST_CASE("Sema/Nested Queries", "[core][parse][sema]")
         }
     }
 
+    SECTION("EXISTS and IN")
+    {
+        const char* queries[] = {
+            "SELECT v FROM B WHERE EXISTS (SELECT v FROM A);",
+            "SELECT v FROM B WHERE EXISTS (SELECT 17, A.v FROM A);",
+            "SELECT v FROM B WHERE NOT EXISTS (SELECT A.v FROM A WHERE A.v = B.v);",
+            "SELECT v FROM B WHERE v IN (SELECT A.v FROM A);",
+            "SELECT v FROM B WHERE v + 1 IN (SELECT MIN(A.v) FROM A GROUP BY A.v);",
+            "SELECT v FROM B WHERE v NOT IN (SELECT w FROM C WHERE w < v);",
+            "SELECT v FROM B WHERE v IN (SELECT w FROM C WHERE w IN (SELECT A.v FROM A));",
+            /* a scalar nested query on the left-hand side of IN */
+            "SELECT v FROM B WHERE (SELECT MIN(A.v) FROM A) IN (SELECT w FROM C);",
+        };
+
+        for (auto q : queries) {
+            LEXER(q);
+            Parser parser(lexer);
+            auto stmt = as<SelectStmt>(parser.parse());
+            CHECK(diag.num_errors() == 0);
+            CHECK(err.str().empty());
+            Sema sema(diag);
+            sema(*stmt);
+
+            if (diag.num_errors() != 0 or not err.str().empty())
+                std::cerr << "ERROR for input \"" << q << "\": " << err.str() << std::endl;
+            CHECK(diag.num_errors() == 0);
+            CHECK(err.str().empty());
+        }
+    }
+
+    SECTION("EXISTS and IN sanity tests")
+    {
+        const char* queries[] = {
+            /* invalid number of columns */
+            "SELECT v FROM B WHERE v IN (SELECT 17, 29);",
+            "SELECT v FROM B WHERE v IN (SELECT A.v, A.v FROM A);",
+            /* right-hand side of IN is no nested query */
+            "SELECT v FROM B WHERE v IN 17;",
+            /* incomparable types */
+            "SELECT v FROM B WHERE v IN (SELECT TRUE);",
+            /* invalid position for EXISTS and IN */
+            "SELECT EXISTS (SELECT v FROM A) FROM B;",
+            "SELECT v FROM B GROUP BY v HAVING v IN (SELECT A.v FROM A);",
+            "SELECT v FROM B GROUP BY v HAVING EXISTS (SELECT A.v FROM A);",
+        };
+
+        for (auto q : queries) {
+            LEXER(q);
+            Parser parser(lexer);
+            auto stmt = as<SelectStmt>(parser.parse());
+            CHECK(diag.num_errors() == 0);
+            CHECK(err.str().empty());
+            Sema sema(diag);
+            sema(*stmt);
+
+            if (diag.num_errors() == 0)
+                std::cerr << "UNEXPECTED PASS for input \"" << q << '"' << std::endl;
+            CHECK_FALSE(diag.num_errors() == 0);
+            CHECK_FALSE(err.str().empty());
+        }
+    }
+
     SECTION("Santity tests")
     {
         const char* queries[] = {
@@ -0,0 +1,130 @@
+#include "catch2/catch.hpp"
+
+#include "storage/AttributeReader.hpp"
+#include "storage/Compression.hpp"
+#include <limits>
+#include <mutable/catalog/Catalog.hpp>
+#include <mutable/catalog/Schema.hpp>
+#include <mutable/mutable.hpp>
+#include <mutable/storage/Store.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+using namespace m;
+using namespace m::storage;
+
+
+namespace {
+
+/** Executes the SQL statement \p sql and requires it to succeed. */
+void execute(const std::string &sql)
+{
+    std::ostringstream out, err;
+    Diagnostic diag(false, out, err);
+    auto stmt = statement_from_string(diag, sql);
+    REQUIRE(stmt);
+    execute_statement(diag, *stmt);
+    REQUIRE(diag.num_errors() == 0);
+    REQUIRE(err.str().empty());
+}
+
+/** Returns the values of \p attr in all rows of its table, where NULL is represented by the smallest `int64_t`. */
+std::vector<int64_t> values_of(const Attribute &attr)
+{
+    const AttributeReader reader(attr);
+    std::vector<int64_t> values;
+    for (std::size_t row_id = 0; row_id != attr.table.store().num_rows(); ++row_id)
+        values.push_back(reader.is_null(row_id) ? std::numeric_limits<int64_t>::lowest() : reader.read(row_id));
+    return values;
+}
+
+}
+
+
+TEST_CASE("Compression/frame of reference", "[core][storage][compression]")
+{
+    constexpr int64_t NULL_VALUE = std::numeric_limits<int64_t>::lowest();
+
+    Catalog::Clear();
+    Catalog &C = Catalog::Get();
+    auto &DB = C.add_database(C.pool("db"));
+    C.set_database_in_use(DB);
+
+    execute("CREATE TABLE t (k INT(4), v INT(8) NOT NULL);");
+    execute("INSERT INTO t VALUES (100, 1000), (NULL, 1010), (50, 1100);");
+    auto &table = DB.get_table(C.pool("t"));
+    auto &k = table.at(C.pool("k"));
+    auto &v = table.at(C.pool("v"));
+
+    REQUIRE(storage::compress(table) == 2);
+    REQUIRE(k.frame_of_reference);
+    CHECK(k.frame_of_reference->type->size() == 8);
+    REQUIRE(v.frame_of_reference);
+    CHECK(v.frame_of_reference->type->size() == 8);
+    CHECK(values_of(k) == std::vector<int64_t>{ 100, NULL_VALUE, 50 });
+    CHECK(values_of(v) == std::vector<int64_t>{ 1000, 1010, 1100 });
+
+    SECTION("compress() is idempotent")
+    {
+        CHECK(storage::compress(table) == 0);
+    }
+
+    SECTION("appending values that fit keeps the frames and the data layout")
+    {
+        const auto *layout = &table.layout();
+        execute("INSERT INTO t VALUES (300, 1050), (NULL, 1100);");
+        CHECK(&table.layout() == layout);
+        CHECK(k.frame_of_reference->type->size() == 8);
+        CHECK(v.frame_of_reference->type->size() == 8);
+        CHECK(values_of(k) == std::vector<int64_t>{ 100, NULL_VALUE, 50, 300, NULL_VALUE });
+    }
+
+    SECTION("appending a value that does not fit widens only its attribute's frame")
+    {
+        execute("INSERT INTO t VALUES (-70, 1001);");
+        REQUIRE(k.frame_of_reference);
+        CHECK(k.frame_of_reference->type->size() == 16);
+        CHECK(v.frame_of_reference->type->size() == 8);
+        CHECK(values_of(k) == std::vector<int64_t>{ 100, NULL_VALUE, 50, -70 });
+        CHECK(values_of(v) == std::vector<int64_t>{ 1000, 1010, 1100, 1001 });
+
+        /* values within the widened frame do not widen it again */
+        execute("INSERT INTO t VALUES (20000, 1002), (60000, 1003);");
+        CHECK(k.frame_of_reference->type->size() == 16);
+        CHECK(values_of(k) == std::vector<int64_t>{ 100, NULL_VALUE, 50, -70, 20000, 60000 });
+    }
+
+    SECTION("each widening at least doubles the width until the attribute is no longer compressed")
+    {
+        execute("INSERT INTO t VALUES (1, 100000);");
+        REQUIRE(v.frame_of_reference);
+        CHECK(v.frame_of_reference->type->size() == 32);
+        execute("INSERT INTO t VALUES (2, 10000000000);");
+        CHECK_FALSE(v.frame_of_reference);
+        execute("INSERT INTO t VALUES (3, -10000000000);");
+        CHECK_FALSE(v.frame_of_reference);
+        CHECK(values_of(v) == std::vector<int64_t>{ 1000, 1010, 1100, 100000, 10000000000, -10000000000 });
+        CHECK(values_of(k) == std::vector<int64_t>{ 100, NULL_VALUE, 50, 1, 2, 3 });
+    }
+
+    SECTION("widen_frames_of_reference()")
+    {
+        Tuple tup({ k.type, v.type });
+        tup.null(0);
+        tup.set(1, int64_t(1050));
+        CHECK(widen_frames_of_reference(table, tup) == 0); // NULL never widens a frame
+
+        tup.set(0, int64_t(-1000));
+        tup.set(1, int64_t(-1000));
+        CHECK(widen_frames_of_reference(table, tup) == 2);
+        CHECK(fits_frames_of_reference(table, tup));
+        CHECK(k.frame_of_reference->type->size() == 16);
+        CHECK(v.frame_of_reference->type->size() == 16);
+        CHECK(values_of(k) == std::vector<int64_t>{ 100, NULL_VALUE, 50 });
+        CHECK(values_of(v) == std::vector<int64_t>{ 1000, 1010, 1100 });
+    }
+
+    Catalog::Clear();
+}
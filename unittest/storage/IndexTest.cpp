@@ -0,0 +1,138 @@
+#include "catch2/catch.hpp"
+
+#include <mutable/catalog/Catalog.hpp>
+#include <mutable/catalog/Schema.hpp>
+#include <mutable/mutable.hpp>
+#include <mutable/storage/Index.hpp>
+#include <mutable/storage/Store.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+
+using namespace m;
+
+
+namespace {
+
+/** Executes the SQL statement \p sql and requires it to succeed. */
+void execute(const std::string &sql)
+{
+    std::ostringstream out, err;
+    Diagnostic diag(false, out, err);
+    auto stmt = statement_from_string(diag, sql);
+    REQUIRE(stmt);
+    execute_statement(diag, *stmt);
+    REQUIRE(diag.num_errors() == 0);
+    REQUIRE(err.str().empty());
+}
+
+/** Returns the row IDs of the entries of \p index at the positions in [\p begin, \p end). */
+std::vector<uint32_t> row_ids(const Index &index, std::size_t begin, std::size_t end)
+{
+    std::vector<uint32_t> ids(end - begin);
+    index.row_ids(begin, end, ids.data());
+    return ids;
+}
+
+}
+
+
+TEST_CASE("Index", "[core][storage][index]")
+{
+    Catalog::Clear();
+    Catalog &C = Catalog::Get();
+    auto &DB = C.add_database(C.pool("db"));
+    C.set_database_in_use(DB);
+
+    execute("CREATE TABLE t (k INT(4), v INT(4) NOT NULL);");
+    execute("INSERT INTO t VALUES (5, 0), (3, 1), (NULL, 2), (5, 3), (-1, 4);");
+    auto &table = DB.get_table(C.pool("t"));
+
+    SECTION("c'tor requires an integral attribute")
+    {
+        execute("CREATE TABLE s (f DOUBLE);");
+        auto &s = DB.get_table(C.pool("s"));
+        REQUIRE_THROWS_AS(Index(C.pool("s_f"), s.at(C.pool("f"))), std::invalid_argument);
+    }
+
+    SECTION("update() indexes all rows except NULL keys")
+    {
+        Index index(C.pool("t_k"), table.at(C.pool("k")));
+        CHECK(index.size() == 0);
+        CHECK(index.num_rows_indexed() == 0);
+
+        index.update();
+        CHECK(index.num_rows_indexed() == 5);
+        REQUIRE(index.size() == 4);
+
+        /* entries are sorted by key and then by row ID */
+        CHECK(row_ids(index, 0, index.size()) == std::vector<uint32_t>{ 4, 1, 0, 3 });
+
+        CHECK(index.lower_bound(-5) == 0);
+        CHECK(index.lower_bound(-1) == 0);
+        CHECK(index.upper_bound(-1) == 1);
+        CHECK(index.lower_bound(4) == 2);
+        CHECK(index.upper_bound(4) == 2);
+        CHECK(index.lower_bound(5) == 2);
+        CHECK(index.upper_bound(5) == 4);
+        CHECK(index.lower_bound(6) == 4);
+        CHECK(row_ids(index, index.lower_bound(5), index.upper_bound(5)) == std::vector<uint32_t>{ 0, 3 });
+    }
+
+    SECTION("update() after inserts merges the appended rows")
+    {
+        Index index(C.pool("t_k"), table.at(C.pool("k")));
+        index.update();
+        REQUIRE(index.size() == 4);
+
+        execute("INSERT INTO t VALUES (4, 5), (3, 6), (NULL, 7), (-1, 8);");
+        CHECK(index.num_rows_indexed() == 5); // not yet updated
+
+        index.update();
+        CHECK(index.num_rows_indexed() == 9);
+        REQUIRE(index.size() == 7);
+        CHECK(row_ids(index, 0, index.size()) == std::vector<uint32_t>{ 4, 8, 1, 6, 5, 0, 3 });
+        CHECK(row_ids(index, index.lower_bound(3), index.upper_bound(4)) == std::vector<uint32_t>{ 1, 6, 5 });
+
+        /* a second update without appended rows changes nothing */
+        index.update();
+        CHECK(index.num_rows_indexed() == 9);
+        CHECK(index.size() == 7);
+    }
+
+    SECTION("update() rebuilds the index after rows were dropped")
+    {
+        Index index(C.pool("t_k"), table.at(C.pool("k")));
+        index.update();
+        REQUIRE(index.size() == 4);
+
+        /* drop the last two rows, (5, 3) and (-1, 4), and append a new row */
+        table.store().drop();
+        table.store().drop();
+        execute("INSERT INTO t VALUES (7, 3);");
+
+        index.update();
+        CHECK(index.num_rows_indexed() == 4);
+        REQUIRE(index.size() == 3);
+        CHECK(row_ids(index, 0, index.size()) == std::vector<uint32_t>{ 1, 0, 3 });
+        CHECK(index.lower_bound(-1) == 0);
+        CHECK(index.upper_bound(-1) == 0);
+        CHECK(index.lower_bound(7) == 2);
+        CHECK(index.upper_bound(7) == 3);
+    }
+
+    SECTION("CREATE INDEX adds an up-to-date index to the database")
+    {
+        execute("CREATE INDEX t_k ON t (k);");
+        auto &index = DB.get_index(C.pool("t_k"));
+        CHECK(&index.attr == &table.at(C.pool("k")));
+        CHECK(index.size() == 4);
+        CHECK(DB.get_index(index.id).name == index.name);
+        REQUIRE(DB.indexes_of(table).size() == 1);
+        CHECK(DB.indexes_of(table)[0] == &index);
+        CHECK_THROWS_AS(DB.add_index(C.pool("t_k"), table.at(C.pool("v"))), std::invalid_argument);
+    }
+
+    Catalog::Clear();
+}
@@ -0,0 +1,150 @@
+#include "catch2/catch.hpp"
+
+#include <limits>
+#include <mutable/catalog/Catalog.hpp>
+#include <mutable/catalog/Schema.hpp>
+#include <mutable/mutable.hpp>
+#include <mutable/storage/DataLayoutFactory.hpp>
+#include <mutable/storage/Store.hpp>
+#include <mutable/storage/ZoneMap.hpp>
+#include <sstream>
+#include <string>
+
+
+using namespace m;
+
+
+namespace {
+
+/** Executes the SQL statement \p sql and requires it to succeed. */
+void execute(const std::string &sql)
+{
+    std::ostringstream out, err;
+    Diagnostic diag(false, out, err);
+    auto stmt = statement_from_string(diag, sql);
+    REQUIRE(stmt);
+    execute_statement(diag, *stmt);
+    REQUIRE(diag.num_errors() == 0);
+    REQUIRE(err.str().empty());
+}
+
+/** Inserts the rows [\p begin, \p end) into table `t`, where row `i` is `(i, n, i)` and `n` is NULL if \p null_n and
+ * `i % 100` otherwise. */
+void insert_rows(int begin, int end, bool null_n)
+{
+    std::ostringstream sql;
+    sql << "INSERT INTO t VALUES ";
+    for (int i = begin; i != end; ++i) {
+        if (i != begin) sql << ", ";
+        sql << '(' << i << ", ";
+        if (null_n) sql << "NULL";
+        else        sql << i % 100;
+        sql << ", " << i << ')';
+    }
+    sql << ';';
+    execute(sql.str());
+}
+
+}
+
+
+TEST_CASE("ZoneMap", "[core][storage][zonemap]")
+{
+    Catalog::Clear();
+    Catalog &C = Catalog::Get();
+    auto &DB = C.add_database(C.pool("db"));
+    C.set_database_in_use(DB);
+
+    /* Use a row layout, i.e.\ blocks of a single row, s.t. a zone has the minimal number of rows. */
+    execute("CREATE TABLE t (k INT(4) NOT NULL, n INT(4), f DOUBLE);");
+    auto &table = DB.get_table(C.pool("t"));
+    table.layout(storage::RowLayoutFactory());
+    table.store(C.create_store(table));
+    auto &k = table.at(C.pool("k"));
+    auto &n = table.at(C.pool("n"));
+    auto &f = table.at(C.pool("f"));
+
+    /* Attribute `n` is NULL in each row of the first zone. */
+    constexpr int ZONE_SIZE = ZoneMap::MIN_ZONE_SIZE;
+    insert_rows(0, ZONE_SIZE, true);
+    insert_rows(ZONE_SIZE, 2 * ZONE_SIZE + 452, false);
+
+    ZoneMap zone_map(table);
+    CHECK(zone_map.zone_size() == 0);
+    CHECK(zone_map.num_zones() == 0);
+    zone_map.update();
+
+    SECTION("summaries")
+    {
+        CHECK(ZoneMap::Is_Summarized(*k.type));
+        CHECK_FALSE(ZoneMap::Is_Summarized(*f.type));
+
+        REQUIRE(zone_map.zone_size() == ZONE_SIZE);
+        CHECK(zone_map.zone_size() % ZoneMap::ZONE_SIZE_ALIGNMENT == 0);
+        CHECK(zone_map.num_rows_summarized() == 2 * ZONE_SIZE + 452);
+        REQUIRE(zone_map.num_zones() == 3);
+        CHECK(zone_map.num_rows_of(0) == ZONE_SIZE);
+        CHECK(zone_map.num_rows_of(2) == 452);
+
+        CHECK(zone_map.summary(k, 0).min == 0);
+        CHECK(zone_map.summary(k, 0).max == ZONE_SIZE - 1);
+        CHECK(zone_map.summary(k, 0).num_nulls == 0);
+        CHECK(zone_map.summary(k, 2).min == 2 * ZONE_SIZE);
+        CHECK(zone_map.summary(k, 2).max == 2 * ZONE_SIZE + 451);
+
+        CHECK(zone_map.summary(n, 0).num_nulls == ZONE_SIZE);
+        CHECK(zone_map.summary(n, 1).min == 0);
+        CHECK(zone_map.summary(n, 1).max == 99);
+        CHECK(zone_map.summary(n, 1).num_nulls == 0);
+    }
+
+    SECTION("may_contain()")
+    {
+        CHECK(zone_map.may_contain(k, 1, ZONE_SIZE, ZONE_SIZE));
+        CHECK(zone_map.may_contain(k, 1, 2 * ZONE_SIZE - 1, std::numeric_limits<int64_t>::max()));
+        CHECK(zone_map.may_contain(k, 1, std::numeric_limits<int64_t>::lowest(), ZONE_SIZE));
+        CHECK_FALSE(zone_map.may_contain(k, 1, 2 * ZONE_SIZE, std::numeric_limits<int64_t>::max()));
+        CHECK_FALSE(zone_map.may_contain(k, 1, std::numeric_limits<int64_t>::lowest(), ZONE_SIZE - 1));
+        CHECK_FALSE(zone_map.may_contain(k, 1, ZONE_SIZE + 1, ZONE_SIZE)); // empty interval
+
+        /* A zone in which the attribute is NULL in every row contains no value of any interval. */
+        CHECK_FALSE(zone_map.may_contain(n, 0, std::numeric_limits<int64_t>::lowest(),
+                                         std::numeric_limits<int64_t>::max()));
+        CHECK(zone_map.may_contain(n, 1, 42, 42));
+        CHECK_FALSE(zone_map.may_contain(n, 1, 100, 200));
+    }
+
+    SECTION("update() after inserts")
+    {
+        /* Fill the partial last zone and start a new one, where `n` is NULL in all new rows. */
+        insert_rows(2 * ZONE_SIZE + 452, 3 * ZONE_SIZE + 10, true);
+        CHECK(zone_map.num_rows_summarized() == 2 * ZONE_SIZE + 452); // not yet updated
+
+        zone_map.update();
+        CHECK(zone_map.num_rows_summarized() == 3 * ZONE_SIZE + 10);
+        REQUIRE(zone_map.num_zones() == 4);
+        CHECK(zone_map.num_rows_of(3) == 10);
+        CHECK(zone_map.summary(k, 2).max == 3 * ZONE_SIZE - 1);
+        CHECK(zone_map.summary(n, 2).num_nulls == ZONE_SIZE - 452);
+        CHECK(zone_map.summary(n, 2).max == 99);
+        CHECK_FALSE(zone_map.may_contain(n, 3, std::numeric_limits<int64_t>::lowest(),
+                                         std::numeric_limits<int64_t>::max()));
+        CHECK(zone_map.may_contain(n, 2, 0, 0));
+
+        /* The store's zone map catches up on use. */
+        CHECK(table.store().zone_map().num_zones() == 4);
+    }
+
+    SECTION("update() rebuilds the zone map after rows were dropped")
+    {
+        for (int i = 0; i != 452; ++i)
+            table.store().drop();
+
+        zone_map.update();
+        CHECK(zone_map.num_rows_summarized() == 2 * ZONE_SIZE);
+        REQUIRE(zone_map.num_zones() == 2);
+        CHECK(zone_map.summary(k, 1).max == 2 * ZONE_SIZE - 1);
+    }
+
+    Catalog::Clear();
+}